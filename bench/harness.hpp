@@ -0,0 +1,314 @@
+/**
+ * @file    harness.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the microbenchmark harness of measurements_bench: calibration, warmup, repetitions,
+ *          median and median absolute deviation of the time per operation
+ * @date    2023-02-03
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+#include "perf.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace bench {
+
+
+    /// @brief Prevent the compiler from optimizing away a value
+    template <typename T>
+    inline void do_not_optimize(const T& value) noexcept {
+
+        asm volatile("" : : "r,m"(value) : "memory");
+
+    }
+
+
+    /// @brief Prevent the compiler from reordering the memory accesses around this point
+    inline void clobber() noexcept {
+
+        asm volatile("" : : : "memory");
+
+    }
+
+
+    /// @brief Options of the harness
+    struct options {
+
+        unsigned warmup{3}; ///< Number of repetitions run before measuring
+
+        unsigned repetitions{15}; ///< Number of measured repetitions
+
+        double min_time_ns{2e6}; ///< Minimum duration of a repetition, the iterations are calibrated to reach it
+
+        std::string filter{}; ///< Run only the benchmarks whose name contains this string
+
+        std::string json{}; ///< Path of the JSON file where the results are written, empty if none
+
+        std::string compare{}; ///< Path of a JSON file of saved results to compare with, empty if none
+
+        double threshold{0.05}; ///< Relative slowdown below which a difference is not reported as a regression
+
+        double alpha{0.01}; ///< Significance level of the comparison
+
+        bool perf{false}; ///< Count the hardware events of the measured repetitions with perf_event_open
+
+
+        /**
+         * @brief Parse the options from the command line, as --warmup=3 --repetitions=15 --min-time-ms=2 --filter=add
+         *        --json=results.json --compare=baseline.json --threshold=0.05 --alpha=0.01 --perf
+         *
+         * @return options
+         *
+         * @note It throws on unknown arguments
+         */
+        static options parse(int argc, char** argv) {
+
+            options opts;
+            for (int i{1}; i < argc; ++i) {
+
+                const std::string_view arg(argv[i]);
+                const std::size_t equal = arg.find('=');
+                const std::string_view key = arg.substr(0, equal);
+                const std::string value(equal == std::string_view::npos ? std::string_view() : arg.substr(equal + 1));
+
+                if (key == "--warmup")
+                    opts.warmup = static_cast<unsigned>(std::stoul(value));
+                else if (key == "--repetitions")
+                    opts.repetitions = std::max(1u, static_cast<unsigned>(std::stoul(value)));
+                else if (key == "--min-time-ms")
+                    opts.min_time_ns = std::stod(value) * 1e6;
+                else if (key == "--filter")
+                    opts.filter = value;
+                else if (key == "--json")
+                    opts.json = value;
+                else if (key == "--compare")
+                    opts.compare = value;
+                else if (key == "--threshold")
+                    opts.threshold = std::stod(value);
+                else if (key == "--alpha")
+                    opts.alpha = std::stod(value);
+                else if (key == "--perf" && equal == std::string_view::npos)
+                    opts.perf = true;
+                else
+                    throw std::invalid_argument("Unknown argument " + std::string(arg));
+
+            }
+
+            return opts;
+
+        }
+
+    };
+
+
+    /// @brief Statistics of a benchmark
+    struct result {
+
+        std::string name; ///< Name of the benchmark
+
+        std::string baseline; ///< Name of the benchmark used as baseline, empty if none
+
+        std::size_t batch{1}; ///< Number of operations of a call of the body
+
+        std::size_t iterations{0}; ///< Calls of the body in a repetition
+
+        double median{0.0}; ///< Median time per operation, in ns
+
+        double mad{0.0}; ///< Median absolute deviation of the time per operation, in ns
+
+        double overhead{0.0}; ///< Ratio of the median to the median of the baseline, 0 if there is no baseline
+
+        std::vector<double> samples{}; ///< Time per operation of each repetition, in ns
+
+        counts hardware{}; ///< Hardware events per operation over all the repetitions, NaN if they were not counted
+
+    };
+
+
+    /// @brief Median of a vector, which is reordered
+    inline double median(std::vector<double>& values) {
+
+        const std::size_t middle = values.size() / 2;
+        std::nth_element(values.begin(), values.begin() + middle, values.end());
+        const double upper = values[middle];
+        if (values.size() % 2)
+            return upper;
+
+        return (upper + *std::max_element(values.begin(), values.begin() + middle)) / 2.0;
+
+    }
+
+
+    /**
+     * @brief Runner of the benchmarks, which collects and prints their results
+     */
+    class runner {
+
+
+        public:
+
+            explicit runner(const options& opts) : opts_(opts) {
+
+                if (this->opts_.perf) {
+
+                    this->perf_ = std::make_unique<perf_counters>();
+                    if (!this->perf_->available()) {
+
+                        std::cerr << "perf_event_open is not available (check /proc/sys/kernel/perf_event_paranoid), reporting wall time only\n";
+                        this->perf_.reset();
+
+                    }
+
+                }
+
+            }
+
+
+            /**
+             * @brief Run a benchmark
+             *
+             * @param name: name of the benchmark, as "measurement_add/measurement/64", the filter is matched against it
+             * @param batch: number of operations of a call of the body
+             * @param body: callable as body(), running batch operations
+             * @param baseline: name of a benchmark already run, the overhead is the ratio of the two medians
+             *
+             * @return const result*, nullptr if the benchmark is filtered out, valid until the next run
+             */
+            template <typename Body>
+            const result* run(const std::string& name, const std::size_t& batch, Body&& body, const std::string& baseline = {}) {
+
+                if (!this->opts_.filter.empty() && name.find(this->opts_.filter) == std::string::npos)
+                    return nullptr;
+
+                // calibrate the number of iterations of a repetition
+                std::size_t iterations{1};
+                while (true) {
+
+                    const double elapsed = runner::time(body, iterations);
+                    if (elapsed >= this->opts_.min_time_ns || iterations >= (std::size_t{1} << 40))
+                        break;
+
+                    iterations = (elapsed <= 0.0) ? iterations * 16 :
+                        std::max(iterations + 1, static_cast<std::size_t>(static_cast<double>(iterations) * 1.2 * this->opts_.min_time_ns / elapsed));
+
+                }
+
+                for (unsigned i{0}; i < this->opts_.warmup; ++i)
+                    runner::time(body, iterations);
+
+                // the hardware events are counted over all the measured repetitions, outside the timed regions
+                std::vector<double> samples(this->opts_.repetitions);
+                if (this->perf_)
+                    this->perf_->start();
+                for (double& sample : samples)
+                    sample = runner::time(body, iterations) / static_cast<double>(iterations * batch);
+                const counts hardware = this->perf_ ? this->perf_->stop(static_cast<double>(iterations * batch * samples.size())) : counts();
+
+                result res{ name, baseline, batch, iterations, 0.0, 0.0, 0.0, samples, hardware };
+                res.median = bench::median(samples);
+                for (double& sample : samples)
+                    sample = std::abs(sample - res.median);
+                res.mad = bench::median(samples);
+
+                if (const result* base = this->find(baseline); base != nullptr && base->median > 0.0)
+                    res.overhead = res.median / base->median;
+
+                this->results_.push_back(res);
+                this->print(res);
+
+                return &this->results_.back();
+
+            }
+
+
+            /// @brief Find the result of a benchmark already run
+            const result* find(const std::string& name) const noexcept {
+
+                for (const result& res : this->results_)
+                    if (res.name == name)
+                        return &res;
+
+                return nullptr;
+
+            }
+
+
+            /// @brief Get the results of the benchmarks run
+            const std::vector<result>& results() const noexcept { return this->results_; }
+
+
+            /// @brief Print the header of the table of the results, with the columns of the hardware events if they are counted
+            void print_header() const {
+
+                std::printf("%-44s %10s %12s %10s %10s", "benchmark", "batch", "ns/op", "mad", "overhead");
+                if (this->perf_)
+                    std::printf(" %11s %6s %11s %11s %11s", "cycles/op", "IPC", "br-miss/op", "L1-miss/op", "LLC-miss/op");
+                std::printf("\n");
+
+            }
+
+
+            /// @brief Print a row of the table of the results
+            void print(const result& res) const {
+
+                std::printf("%-44s %10zu %12.3f %10.3f", res.name.c_str(), res.batch, res.median, res.mad);
+                if (res.overhead > 0.0)
+                    std::printf(" %9.2fx", res.overhead);
+                else
+                    std::printf(" %10s", "-");
+                if (this->perf_)
+                    std::printf(" %11.2f %6.2f %11.4f %11.4f %11.4f", res.hardware[event::cycles], res.hardware.ipc(),
+                                res.hardware[event::branch_misses], res.hardware[event::l1d_misses], res.hardware[event::llc_misses]);
+                std::printf("\n");
+                std::fflush(stdout);
+
+            }
+
+
+        private:
+
+            /// @brief Time a number of calls of the body, in ns
+            template <typename Body>
+            static double time(Body& body, const std::size_t& iterations) {
+
+                const auto start = std::chrono::steady_clock::now();
+                for (std::size_t i{0}; i < iterations; ++i) {
+
+                    body();
+                    clobber();
+
+                }
+                const auto stop = std::chrono::steady_clock::now();
+
+                return std::chrono::duration<double, std::nano>(stop - start).count();
+
+            }
+
+
+            options opts_; ///< Options of the harness
+
+            std::vector<result> results_; ///< Results of the benchmarks run, in order
+
+            std::unique_ptr<perf_counters> perf_{}; ///< Hardware counters, null if they are not requested or not available
+
+
+    }; // class runner
+
+
+} // namespace bench
@@ -0,0 +1,298 @@
+/**
+ * @file    main.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the benchmarks of the hot paths of the measurements library, each one compared with
+ *          the same operation on raw doubles
+ * @date    2023-02-03
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include "measurements.hpp"
+#include "harness.hpp"
+#include "report.hpp"
+
+#include <sstream>
+
+
+using namespace measurements;
+
+
+namespace {
+
+
+    constexpr std::size_t batches[] = { 1, 64, 4096 }; ///< Number of operations of a call of the bodies
+
+
+    /// @brief Deterministic values in [1, 2)
+    std::vector<scalar> make_values(const std::size_t& size, const uint64_t& seed) {
+
+        std::vector<scalar> values(size);
+        for (std::size_t i{0}; i < size; ++i)
+            values[i] = 1.0 + counter_rng::uniform(counter_rng::random(seed, 0, i));
+
+        return values;
+
+    }
+
+
+    /// @brief Name of a benchmark, as "measurement_add/measurement/64"
+    std::string name(const std::string& group, const std::string& variant, const std::size_t& batch) {
+
+        return group + "/" + variant + "/" + std::to_string(batch);
+
+    }
+
+
+    /**
+     * @brief Run the benchmarks of a binary operation on a batch of doubles and on a batch of objects of type T
+     *
+     * @param run: bench::runner
+     * @param group: name of the group of the benchmarks
+     * @param variant: name of the type T
+     * @param make: callable as make(scalar value, std::size_t index) returning a T
+     * @param op: callable applied to two doubles and to two Ts
+     */
+    template <typename T, typename Make, typename Op>
+    void binary(bench::runner& run, const std::string& group, const std::string& variant, Make&& make, Op&& op) {
+
+        for (const std::size_t& batch : batches) {
+
+            const std::vector<scalar> x = make_values(batch, 1), y = make_values(batch, 2);
+            std::vector<scalar> raw(batch);
+            run.run(name(group, "double", batch), batch, [&]() {
+
+                for (std::size_t i{0}; i < batch; ++i)
+                    raw[i] = op(x[i], y[i]);
+                bench::do_not_optimize(raw.data());
+
+            });
+
+            std::vector<T> a, b, out;
+            for (std::size_t i{0}; i < batch; ++i) {
+
+                a.push_back(make(x[i], 0));
+                b.push_back(make(y[i], 1));
+
+            }
+            out = a;
+            run.run(name(group, variant, batch), batch, [&]() {
+
+                for (std::size_t i{0}; i < batch; ++i)
+                    out[i] = op(a[i], b[i]);
+                bench::do_not_optimize(out.data());
+
+            }, name(group, "double", batch));
+
+        }
+
+    }
+
+
+    /// @brief Benchmarks of the arithmetic of measurement
+    void measurement_arithmetic(bench::runner& run) {
+
+        const auto same = [](const scalar& value, const std::size_t&) { return measurement(value, m); };
+        const auto mixed = [](const scalar& value, const std::size_t& operand) { return measurement(value, operand ? km : m); };
+
+        binary<measurement>(run, "measurement_add", "measurement", same, [](const auto& lhs, const auto& rhs) { return lhs + rhs; });
+        binary<measurement>(run, "measurement_add_convert", "measurement", mixed, [](const auto& lhs, const auto& rhs) { return lhs + rhs; });
+        binary<measurement>(run, "measurement_multiply", "measurement", mixed, [](const auto& lhs, const auto& rhs) { return lhs * rhs; });
+        binary<measurement>(run, "measurement_divide", "measurement", same, [](const auto& lhs, const auto& rhs) { return lhs / rhs; });
+
+    }
+
+
+    /// @brief Benchmarks of the algebra of unit_base and unit
+    void unit_algebra(bench::runner& run) {
+
+        const unit_base bases[] = { basis::metre, basis::second, basis::kilogram, basis::Ampere };
+        const auto base = [&](const scalar&, const std::size_t& index) { return bases[index % 4]; };
+        const auto units = [](const scalar&, const std::size_t& index) { return index ? km : s; };
+
+        binary<unit_base>(run, "unit_base_multiply", "unit_base", base, [](const auto& lhs, const auto& rhs) { return lhs * rhs; });
+        binary<unit_base>(run, "unit_base_divide", "unit_base", base, [](const auto& lhs, const auto& rhs) { return lhs / rhs; });
+        binary<unit>(run, "unit_multiply", "unit", units, [](const auto& lhs, const auto& rhs) { return lhs * rhs; });
+
+    }
+
+
+    /// @brief Benchmarks of the propagation of the uncertainties of umeasurement
+    void umeasurement_propagation(bench::runner& run) {
+
+        const auto make = [](const scalar& value, const std::size_t&) { return umeasurement(value, 0.01 * value, m); };
+
+        binary<umeasurement>(run, "umeasurement_add", "umeasurement", make, [](const auto& lhs, const auto& rhs) { return lhs + rhs; });
+        binary<umeasurement>(run, "umeasurement_multiply", "umeasurement", make, [](const auto& lhs, const auto& rhs) { return lhs * rhs; });
+        binary<umeasurement>(run, "umeasurement_divide", "umeasurement", make, [](const auto& lhs, const auto& rhs) { return lhs / rhs; });
+
+    }
+
+
+    /// @brief Benchmarks of the parsing of units and measurements, compared with std::from_chars of a double
+    void parsing(bench::runner& run) {
+
+        const std::string_view unit_strings[] = { "m", "km*s^-1", "kg*m/s^2", "mN/m^2" };
+        const std::string_view number_strings[] = { "1.5", "299792.458", "9.80665", "0.0012" };
+        const std::string_view measurement_strings[] = { "1.5 m", "299792.458 km*s^-1", "9.80665 kg*m/s^2", "0.0012 mN/m^2" };
+
+        for (const std::size_t& batch : batches) {
+
+            std::vector<scalar> values(batch);
+            run.run(name("parse", "double", batch), batch, [&]() {
+
+                for (std::size_t i{0}; i < batch; ++i) {
+
+                    const std::string_view str = number_strings[i % 4];
+                    std::from_chars(str.data(), str.data() + str.size(), values[i]);
+
+                }
+                bench::do_not_optimize(values.data());
+
+            });
+
+            std::vector<unit> units(batch);
+            run.run(name("parse", "unit", batch), batch, [&]() {
+
+                for (std::size_t i{0}; i < batch; ++i)
+                    units[i] = parse_unit(unit_strings[i % 4]).units;
+                bench::do_not_optimize(units.data());
+
+            }, name("parse", "double", batch));
+
+            std::vector<measurement> measurements(batch);
+            run.run(name("parse", "measurement_istream", batch), batch, [&]() {
+
+                for (std::size_t i{0}; i < batch; ++i) {
+
+                    std::istringstream is{std::string(measurement_strings[i % 4])};
+                    is >> measurements[i];
+
+                }
+                bench::do_not_optimize(measurements.data());
+
+            }, name("parse", "double", batch));
+
+        }
+
+    }
+
+
+    /// @brief Benchmarks of the formatting of measurements, compared with the same formatting of a double
+    void formatting(bench::runner& run) {
+
+        for (const std::size_t& batch : batches) {
+
+            const std::vector<scalar> x = make_values(batch, 3);
+            std::vector<measurement> meas;
+            std::vector<umeasurement> umeas;
+            for (const scalar& value : x) {
+
+                meas.emplace_back(value, km / s);
+                umeas.emplace_back(value, 0.01 * value, km / s);
+
+            }
+
+            char buffer[umeasurement::max_chars];
+
+            run.run(name("to_chars", "double", batch), batch, [&]() {
+
+                for (std::size_t i{0}; i < batch; ++i)
+                    bench::do_not_optimize(std::to_chars(buffer, buffer + sizeof(buffer), x[i]).ptr);
+
+            });
+
+            run.run(name("to_chars", "measurement", batch), batch, [&]() {
+
+                for (std::size_t i{0}; i < batch; ++i)
+                    bench::do_not_optimize(to_chars(buffer, buffer + sizeof(buffer), meas[i]).ptr);
+
+            }, name("to_chars", "double", batch));
+
+            run.run(name("to_chars", "umeasurement", batch), batch, [&]() {
+
+                for (std::size_t i{0}; i < batch; ++i)
+                    bench::do_not_optimize(to_chars(buffer, buffer + sizeof(buffer), umeas[i]).ptr);
+
+            }, name("to_chars", "double", batch));
+
+            std::ostringstream os;
+            run.run(name("ostream", "double", batch), batch, [&]() {
+
+                os.str({});
+                for (std::size_t i{0}; i < batch; ++i)
+                    os << x[i] << '\n';
+                bench::do_not_optimize(os);
+
+            });
+
+            run.run(name("ostream", "measurement", batch), batch, [&]() {
+
+                os.str({});
+                for (std::size_t i{0}; i < batch; ++i)
+                    os << meas[i] << '\n';
+                bench::do_not_optimize(os);
+
+            }, name("ostream", "double", batch));
+
+            run.run(name("ostream", "umeasurement", batch), batch, [&]() {
+
+                os.str({});
+                for (std::size_t i{0}; i < batch; ++i)
+                    os << umeas[i] << '\n';
+                bench::do_not_optimize(os);
+
+            }, name("ostream", "double", batch));
+
+        }
+
+    }
+
+
+} // namespace
+
+
+int main(int argc, char** argv) {
+
+    bench::options opts;
+    try {
+
+        opts = bench::options::parse(argc, argv);
+
+    } catch (const std::exception& error) {
+
+        std::cerr << error.what() << "\nusage: measurements_bench [--warmup=N] [--repetitions=N] [--min-time-ms=T] [--filter=NAME]"
+                                     " [--json=PATH] [--compare=PATH] [--threshold=R] [--alpha=P] [--perf]\n";
+        return 1;
+
+    }
+
+    bench::runner run(opts);
+    run.print_header();
+
+    measurement_arithmetic(run);
+    unit_algebra(run);
+    umeasurement_propagation(run);
+    parsing(run);
+    formatting(run);
+
+    try {
+
+        if (!opts.json.empty())
+            bench::write_json(opts.json, run.results());
+
+        // a non-zero exit code lets a script fail on regressions
+        if (!opts.compare.empty() && bench::compare(run.results(), bench::read_json(opts.compare), opts) != 0)
+            return 2;
+
+    } catch (const std::exception& error) {
+
+        std::cerr << error.what() << '\n';
+        return 1;
+
+    }
+
+    return 0;
+
+}
@@ -0,0 +1,210 @@
+/**
+ * @file    perf.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the hardware performance counters of measurements_bench, read with the Linux perf_event_open:
+ *          cycles, instructions, branch misses, L1 data cache misses and last level cache misses
+ * @date    2023-02-05
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#if __has_include(<linux/perf_event.h>)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+    #define MEASUREMENTS_BENCH_PERF
+#endif
+
+
+namespace bench {
+
+
+    /// @brief Hardware events counted by perf_counters
+    enum class event : uint8_t { cycles, instructions, branch_misses, l1d_misses, llc_misses, count_ };
+
+
+    constexpr std::size_t events{static_cast<std::size_t>(event::count_)}; ///< Number of hardware events
+
+
+    /// @brief Counts of the hardware events per operation, NaN for the events that could not be counted
+    struct counts {
+
+        std::array<double, events> per_op{ []() {
+
+            std::array<double, events> nans;
+            nans.fill(std::numeric_limits<double>::quiet_NaN());
+            return nans;
+
+        }() };
+
+
+        /// @brief Get the count of an event per operation
+        double operator[](const event& e) const noexcept { return this->per_op[static_cast<std::size_t>(e)]; }
+
+        /// @brief Check if at least one event was counted
+        bool valid() const noexcept {
+
+            for (const double& count : this->per_op)
+                if (!std::isnan(count))
+                    return true;
+
+            return false;
+
+        }
+
+        /// @brief Instructions per cycle, NaN if they were not counted
+        double ipc() const noexcept { return (*this)[event::instructions] / (*this)[event::cycles]; }
+
+    };
+
+
+    /**
+     * @brief Group of hardware counters of the calling thread, opened with perf_event_open
+     *
+     * @note The kernel and the hypervisor are excluded, so that the counters can be opened with perf_event_paranoid <= 2
+     * @note The events that the CPU or the kernel do not support are skipped, when none can be opened available() is false
+     *       and the harness reports wall time only
+     * @note The counts are scaled by the fraction of time the group was scheduled, in case the PMU is multiplexed
+     */
+    class perf_counters {
+
+
+        public:
+
+            perf_counters() noexcept {
+
+                #ifdef MEASUREMENTS_BENCH_PERF
+
+                    constexpr uint64_t l1d_miss = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+                    const std::array<std::pair<uint32_t, uint64_t>, events> configs{{
+                        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+                        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+                        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+                        { PERF_TYPE_HW_CACHE, l1d_miss },
+                        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES }
+                    }};
+
+                    for (std::size_t i{0}; i < events; ++i) {
+
+                        perf_event_attr attr;
+                        std::memset(&attr, 0, sizeof(attr));
+                        attr.size = sizeof(attr);
+                        attr.type = configs[i].first;
+                        attr.config = configs[i].second;
+                        attr.disabled = (this->leader_ == -1);
+                        attr.exclude_kernel = 1;
+                        attr.exclude_hv = 1;
+                        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+                        const int fd = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, this->leader_, 0));
+                        if (fd == -1)
+                            continue;
+
+                        if (this->leader_ == -1)
+                            this->leader_ = fd;
+                        this->fds_[this->opened_] = fd;
+                        this->slots_[this->opened_++] = i;
+
+                    }
+
+                #endif
+
+            }
+
+
+            perf_counters(const perf_counters&) = delete;
+
+            perf_counters& operator=(const perf_counters&) = delete;
+
+
+            ~perf_counters() {
+
+                #ifdef MEASUREMENTS_BENCH_PERF
+                    for (std::size_t i{0}; i < this->opened_; ++i)
+                        ::close(this->fds_[i]);
+                #endif
+
+            }
+
+
+            /// @brief Check if at least one event can be counted
+            bool available() const noexcept { return this->opened_ > 0; }
+
+
+            /// @brief Reset and start the counters
+            void start() noexcept {
+
+                #ifdef MEASUREMENTS_BENCH_PERF
+                    if (this->available()) {
+
+                        ::ioctl(this->leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+                        ::ioctl(this->leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+
+                    }
+                #endif
+
+            }
+
+
+            /**
+             * @brief Stop the counters and get the counts since start
+             *
+             * @param operations: number of operations run since start, the counts are divided by it
+             *
+             * @return counts
+             */
+            counts stop(const double& operations) noexcept {
+
+                counts result;
+
+                #ifdef MEASUREMENTS_BENCH_PERF
+                    if (!this->available())
+                        return result;
+
+                    ::ioctl(this->leader_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+                    // layout of PERF_FORMAT_GROUP: number of events, time enabled, time running, values
+                    std::array<uint64_t, 3 + events> buffer{};
+                    if (::read(this->leader_, buffer.data(), sizeof(buffer)) < static_cast<ssize_t>((3 + this->opened_) * sizeof(uint64_t)) || buffer[2] == 0)
+                        return result;
+
+                    const double scale = static_cast<double>(buffer[1]) / static_cast<double>(buffer[2]);
+                    for (std::size_t i{0}; i < this->opened_; ++i)
+                        result.per_op[this->slots_[i]] = static_cast<double>(buffer[3 + i]) * scale / operations;
+
+                #else
+                    (void)operations;
+                #endif
+
+                return result;
+
+            }
+
+
+        private:
+
+            int leader_{-1}; ///< File descriptor of the leader of the group, -1 if no event was opened
+
+            std::array<int, events> fds_{}; ///< File descriptors of the opened events, in the order of the group
+
+            std::array<std::size_t, events> slots_{}; ///< Event of each opened file descriptor
+
+            std::size_t opened_{0}; ///< Number of opened events
+
+
+    }; // class perf_counters
+
+
+} // namespace bench
@@ -0,0 +1,451 @@
+/**
+ * @file    report.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the JSON output of the results of measurements_bench and the comparison with saved results,
+ *          which flags the statistically significant slowdowns
+ * @date    2023-02-04
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+#include "harness.hpp"
+
+#include <charconv>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+
+namespace bench {
+
+
+    namespace json {
+
+
+        /// @brief A parsed JSON value
+        struct value {
+
+            enum class kind { null, boolean, number, string, array, object };
+
+            kind type{kind::null};
+
+            bool boolean{false};
+
+            double number{0.0};
+
+            std::string string{};
+
+            std::vector<value> array{};
+
+            std::vector<std::pair<std::string, value>> object{};
+
+
+            /// @brief Get a member of an object, nullptr if it is missing
+            const value* find(const std::string_view& key) const noexcept {
+
+                for (const auto& [name, member] : this->object)
+                    if (name == key)
+                        return &member;
+
+                return nullptr;
+
+            }
+
+        };
+
+
+        /// @brief Recursive descent parser of JSON
+        class parser {
+
+
+            public:
+
+                explicit parser(std::string_view text) noexcept : text_(text) {}
+
+
+                /// @brief Parse the whole text, it throws on syntax errors
+                value parse() {
+
+                    value result = this->parse_value();
+                    this->skip_spaces();
+                    if (this->pos_ != this->text_.size())
+                        this->fail("unexpected trailing characters");
+
+                    return result;
+
+                }
+
+
+            private:
+
+                [[noreturn]] void fail(const char* what) const {
+
+                    throw std::runtime_error("Invalid JSON at offset " + std::to_string(this->pos_) + ": " + what);
+
+                }
+
+
+                void skip_spaces() noexcept {
+
+                    while (this->pos_ < this->text_.size() && (this->text_[this->pos_] == ' ' || this->text_[this->pos_] == '\n' ||
+                                                               this->text_[this->pos_] == '\r' || this->text_[this->pos_] == '\t'))
+                        ++this->pos_;
+
+                }
+
+
+                void expect(const char& c) {
+
+                    this->skip_spaces();
+                    if (this->pos_ >= this->text_.size() || this->text_[this->pos_] != c)
+                        this->fail("unexpected character");
+                    ++this->pos_;
+
+                }
+
+
+                bool consume(const std::string_view& literal) noexcept {
+
+                    if (this->text_.substr(this->pos_, literal.size()) != literal)
+                        return false;
+                    this->pos_ += literal.size();
+
+                    return true;
+
+                }
+
+
+                std::string parse_string() {
+
+                    this->expect('"');
+                    std::string result;
+                    while (this->pos_ < this->text_.size() && this->text_[this->pos_] != '"') {
+
+                        char c = this->text_[this->pos_++];
+                        if (c == '\\') {
+
+                            if (this->pos_ >= this->text_.size())
+                                this->fail("unterminated escape");
+                            c = this->text_[this->pos_++];
+                            switch (c) {
+                                case 'n': c = '\n'; break;
+                                case 't': c = '\t'; break;
+                                case 'r': c = '\r'; break;
+                                case 'b': c = '\b'; break;
+                                case 'f': c = '\f'; break;
+                                case '"': case '\\': case '/': break;
+                                default: this->fail("unsupported escape");
+                            }
+
+                        }
+                        result.push_back(c);
+
+                    }
+                    this->expect('"');
+
+                    return result;
+
+                }
+
+
+                value parse_value() {
+
+                    this->skip_spaces();
+                    if (this->pos_ >= this->text_.size())
+                        this->fail("unexpected end");
+
+                    value result;
+                    const char c = this->text_[this->pos_];
+                    if (c == '{') {
+
+                        result.type = value::kind::object;
+                        ++this->pos_;
+                        this->skip_spaces();
+                        if (this->consume("}"))
+                            return result;
+                        do {
+
+                            std::string key = this->parse_string();
+                            this->expect(':');
+                            result.object.emplace_back(std::move(key), this->parse_value());
+                            this->skip_spaces();
+
+                        } while (this->consume(","));
+                        this->expect('}');
+
+                    } else if (c == '[') {
+
+                        result.type = value::kind::array;
+                        ++this->pos_;
+                        this->skip_spaces();
+                        if (this->consume("]"))
+                            return result;
+                        do {
+
+                            result.array.push_back(this->parse_value());
+                            this->skip_spaces();
+
+                        } while (this->consume(","));
+                        this->expect(']');
+
+                    } else if (c == '"') {
+
+                        result.type = value::kind::string;
+                        result.string = this->parse_string();
+
+                    } else if (this->consume("true") || this->consume("false")) {
+
+                        result.type = value::kind::boolean;
+                        result.boolean = (c == 't');
+
+                    } else if (this->consume("null")) {
+
+                        result.type = value::kind::null;
+
+                    } else {
+
+                        result.type = value::kind::number;
+                        const char* first = this->text_.data() + this->pos_;
+                        const std::from_chars_result parsed = std::from_chars(first, this->text_.data() + this->text_.size(), result.number);
+                        if (parsed.ec != std::errc())
+                            this->fail("invalid number");
+                        this->pos_ += static_cast<std::size_t>(parsed.ptr - first);
+
+                    }
+
+                    return result;
+
+                }
+
+
+                std::string_view text_; ///< Text to parse
+
+                std::size_t pos_{0}; ///< Position of the next character
+
+
+        }; // class parser
+
+
+        /// @brief Write a string as a JSON string
+        inline void write_string(std::ostream& os, const std::string_view& str) {
+
+            os << '"';
+            for (const char& c : str) {
+
+                if (c == '"' || c == '\\')
+                    os << '\\' << c;
+                else if (c == '\n')
+                    os << "\\n";
+                else
+                    os << c;
+
+            }
+            os << '"';
+
+        }
+
+
+    } // namespace json
+
+
+    /**
+     * @brief Write the results in a JSON file
+     *
+     * @param path: path of the file
+     * @param results: results of the benchmarks
+     *
+     * @note The file keeps the samples of every benchmark, so that it can be used as baseline by compare
+     * @note The hardware events per operation are written only when they were counted
+     */
+    inline void write_json(const std::string& path, const std::vector<result>& results) {
+
+        std::ofstream file(path);
+        if (!file)
+            throw std::runtime_error("Cannot open " + path);
+
+        file.precision(17);
+        file << "{\n  \"benchmarks\": [";
+        for (std::size_t i{0}; i < results.size(); ++i) {
+
+            const result& res = results[i];
+            file << (i ? ",\n" : "\n") << "    {\"name\": ";
+            json::write_string(file, res.name);
+            file << ", \"baseline\": ";
+            json::write_string(file, res.baseline);
+            file << ", \"batch\": " << res.batch << ", \"iterations\": " << res.iterations
+                 << ", \"median_ns\": " << res.median << ", \"mad_ns\": " << res.mad << ", \"overhead\": " << res.overhead
+                 << ", \"samples_ns\": [";
+            for (std::size_t j{0}; j < res.samples.size(); ++j)
+                file << (j ? ", " : "") << res.samples[j];
+            file << "]";
+
+            // the events that were not counted are left out, JSON has no NaN
+            constexpr const char* names[events] = { "cycles_per_op", "instructions_per_op", "branch_misses_per_op", "l1d_misses_per_op", "llc_misses_per_op" };
+            for (std::size_t j{0}; j < events; ++j)
+                if (!std::isnan(res.hardware.per_op[j]))
+                    file << ", \"" << names[j] << "\": " << res.hardware.per_op[j];
+            file << "}";
+
+        }
+        file << "\n  ]\n}\n";
+
+    }
+
+
+    /**
+     * @brief Read the results written by write_json
+     *
+     * @param path: path of the file
+     *
+     * @return std::vector<result>
+     */
+    inline std::vector<result> read_json(const std::string& path) {
+
+        std::ifstream file(path);
+        if (!file)
+            throw std::runtime_error("Cannot open " + path);
+
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        const std::string text = buffer.str();
+        const json::value root = json::parser(text).parse();
+
+        const json::value* benchmarks = root.find("benchmarks");
+        if (benchmarks == nullptr || benchmarks->type != json::value::kind::array)
+            throw std::runtime_error(path + " has no benchmarks array");
+
+        std::vector<result> results;
+        for (const json::value& entry : benchmarks->array) {
+
+            const json::value* name = entry.find("name");
+            const json::value* median = entry.find("median_ns");
+            if (name == nullptr || median == nullptr)
+                throw std::runtime_error(path + " has a benchmark without name or median_ns");
+
+            result res;
+            res.name = name->string;
+            res.median = median->number;
+            if (const json::value* mad = entry.find("mad_ns"))
+                res.mad = mad->number;
+            if (const json::value* batch = entry.find("batch"))
+                res.batch = static_cast<std::size_t>(batch->number);
+            if (const json::value* samples = entry.find("samples_ns"))
+                for (const json::value& sample : samples->array)
+                    res.samples.push_back(sample.number);
+
+            results.push_back(std::move(res));
+
+        }
+
+        return results;
+
+    }
+
+
+    /**
+     * @brief One-sided Mann-Whitney U test that the samples of current are larger than the samples of baseline
+     *
+     * @param current: samples of the current run
+     * @param baseline: samples of the saved run
+     *
+     * @return double, p-value from the normal approximation with the correction for ties
+     */
+    inline double slower_p_value(const std::vector<double>& current, const std::vector<double>& baseline) {
+
+        const double n1 = static_cast<double>(current.size()), n2 = static_cast<double>(baseline.size());
+        if (current.empty() || baseline.empty())
+            return 1.0;
+
+        std::vector<std::pair<double, bool>> pooled;
+        for (const double& sample : current)
+            pooled.emplace_back(sample, true);
+        for (const double& sample : baseline)
+            pooled.emplace_back(sample, false);
+        std::sort(pooled.begin(), pooled.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+        // sum of the ranks of current, ties get the mean of their ranks
+        double ranks{0.0}, ties{0.0};
+        for (std::size_t i{0}; i < pooled.size();) {
+
+            std::size_t j{i};
+            while (j < pooled.size() && pooled[j].first == pooled[i].first)
+                ++j;
+            const double rank = 0.5 * static_cast<double>(i + j + 1);
+            const double count = static_cast<double>(j - i);
+            ties += count * count * count - count;
+            for (std::size_t k{i}; k < j; ++k)
+                if (pooled[k].second)
+                    ranks += rank;
+            i = j;
+
+        }
+
+        const double n = n1 + n2;
+        const double u = ranks - n1 * (n1 + 1.0) / 2.0;
+        const double variance = n1 * n2 / 12.0 * ((n + 1.0) - ties / (n * (n - 1.0)));
+        if (variance <= 0.0)
+            return 1.0;
+
+        const double z = (u - n1 * n2 / 2.0 - 0.5) / std::sqrt(variance);
+
+        return 0.5 * std::erfc(z / std::sqrt(2.0));
+
+    }
+
+
+    /**
+     * @brief Compare the results with saved results and print a table with the ratio of the medians and the confidence
+     *
+     * @param results: results of the current run
+     * @param saved: results of the saved run
+     * @param opts: options, with the threshold and the significance level
+     *
+     * @return std::size_t, number of regressions: slowdowns larger than the threshold with p-value below alpha
+     */
+    inline std::size_t compare(const std::vector<result>& results, const std::vector<result>& saved, const options& opts) {
+
+        std::printf("\n%-44s %12s %12s %8s %11s  %s\n", "benchmark", "saved ns/op", "ns/op", "ratio", "confidence", "status");
+
+        std::size_t regressions{0};
+        for (const result& res : results) {
+
+            const auto base = std::find_if(saved.begin(), saved.end(), [&](const result& other) { return other.name == res.name; });
+            if (base == saved.end() || base->median <= 0.0)
+                continue;
+
+            const double ratio = res.median / base->median;
+            const double slower = slower_p_value(res.samples, base->samples);
+            const double faster = slower_p_value(base->samples, res.samples);
+
+            const char* status = "";
+            double confidence{0.0};
+            if (ratio > 1.0 + opts.threshold && slower < opts.alpha) {
+
+                status = "REGRESSION";
+                confidence = 1.0 - slower;
+                ++regressions;
+
+            } else if (ratio < 1.0 - opts.threshold && faster < opts.alpha) {
+
+                status = "improvement";
+                confidence = 1.0 - faster;
+
+            } else
+                confidence = 1.0 - std::min(slower, faster);
+
+            std::printf("%-44s %12.3f %12.3f %7.3fx %10.2f%%  %s\n", res.name.c_str(), base->median, res.median, ratio, 100.0 * confidence, status);
+
+        }
+
+        std::printf("\n%zu regression%s over %.0f%% at alpha %g\n", regressions, regressions == 1 ? "" : "s", 100.0 * opts.threshold, opts.alpha);
+
+        return regressions;
+
+    }
+
+
+} // namespace bench
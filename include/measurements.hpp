@@ -11,24 +11,86 @@
 #define SCIPP_MEASUREMENTS_HPP
 
     
-    using scalar = double;
+    namespace measurements {
 
+        using scalar = double; ///< Default type of the values
 
+    }
+
+
+    #include <algorithm>
+    #include <array>
+    #include <atomic>
+    #include <bit>
+    #include <charconv>
     #include <cmath>
+    #include <concepts>
     #include <cstdint>
+    #include <cstring>
+    #include <exception>
     #include <fstream>
     #include <iomanip>
     #include <iostream>
+    #include <limits>
+    #include <memory>
+    #include <mutex>
+    #include <new>
+    #include <numbers>
+    #include <numeric>
+    #include <span>
     #include <stdexcept>
+    #include <string>
+    #include <string_view>
+    #include <system_error>
+    #include <thread>
+    #include <type_traits>
+    #include <unordered_map>
+    #include <utility>
+    #include <vector>
+
+    #if __has_include(<format>)
+        #include <format>
+    #endif
+
+    #if __has_include(<sys/mman.h>)
+        #include <fcntl.h>
+        #include <sys/mman.h>
+        #include <sys/stat.h>
+        #include <unistd.h>
+    #endif
 
 
     #include "../src/units/bitwidth.hpp"
     #include "../src/units/base.hpp"
     #include "../src/units/prefix.hpp"
     #include "../src/units/unit.hpp"
+    #include "../src/instrumentation.hpp"
+    #include "../src/error.hpp"
     #include "../src/units/types.hpp"
+    #include "../src/units/parser.hpp"
+    #include "../src/units/convert.hpp"
+    #include "../src/units/registry.hpp"
         
     #include "../src/measurement.hpp"
     #include "../src/measurement_types.hpp"
+    #include "../src/compact_measurement.hpp"
+    #include "../src/quantity.hpp"
+    #include "../src/aligned_allocator.hpp"
+    #include "../src/parallel.hpp"
+    #include "../src/measurement_view.hpp"
+    #include "../src/measurement_array.hpp"
+    #include "../src/fixed_measurement.hpp"
+    #include "../src/expression.hpp"
     #include "../src/umeasurement.hpp"
-    #include "../src/umeasurement_types.hpp"
\ No newline at end of file
+    #include "../src/umeasurement_types.hpp"
+    #include "../src/nothrow.hpp"
+    #include "../src/tracked_umeasurement.hpp"
+    #include "../src/correlated_umeasurement.hpp"
+    #include "../src/monte_carlo.hpp"
+    #include "../src/umeasurement_view.hpp"
+    #include "../src/umeasurement_array.hpp"
+    #include "../src/statistics.hpp"
+    #include "../src/format.hpp"
+    #include "../src/binary.hpp"
+    #include "../src/mapped_file.hpp"
+    #include "../src/text_reader.hpp"
\ No newline at end of file
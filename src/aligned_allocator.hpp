@@ -0,0 +1,100 @@
+/**
+ * @file    aligned_allocator.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the definition and implementation of the aligned_allocator struct,
+ *          used by the containers of the library to store their values in aligned buffers.
+ * @date    2023-01-20
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    /**
+     * @brief Allocator returning memory aligned to a given boundary, so that the buffers can be loaded with aligned SIMD instructions
+     *
+     * @tparam T: type of the allocated values
+     * @tparam Alignment: alignment of the allocated memory in bytes (a cache line by default)
+     */
+    template <typename T, std::size_t Alignment = 64>
+    struct aligned_allocator {
+
+
+        static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two not smaller than alignof(T)");
+
+
+        using value_type = T;
+
+
+        /// @brief Rebind the aligned_allocator to another type
+        template <typename U>
+        struct rebind {
+
+            using other = aligned_allocator<U, Alignment>;
+
+        };
+
+
+        /// @brief Construct a new default aligned_allocator object
+        constexpr aligned_allocator() noexcept = default;
+
+
+        /// @brief Construct a new aligned_allocator object from an aligned_allocator of another type
+        template <typename U>
+        constexpr aligned_allocator(const aligned_allocator<U, Alignment>&) noexcept {}
+
+
+        /**
+         * @brief Allocate an aligned buffer
+         *
+         * @param size: number of values
+         *
+         * @return T*
+         */
+        [[nodiscard]] T* allocate(const std::size_t& size) {
+
+            return static_cast<T*>(::operator new(size * sizeof(T), std::align_val_t{Alignment}));
+
+        }
+
+
+        /**
+         * @brief Deallocate an aligned buffer
+         *
+         * @param ptr: pointer to the buffer
+         * @param size: number of values
+         */
+        void deallocate(T* ptr, const std::size_t& size) noexcept {
+
+            ::operator delete(ptr, size * sizeof(T), std::align_val_t{Alignment});
+
+        }
+
+
+        /// @brief Every aligned_allocator with the same alignment can deallocate the memory of the others
+        template <typename U>
+        constexpr bool operator==(const aligned_allocator<U, Alignment>&) const noexcept {
+
+            return true;
+
+        }
+
+
+        /// @brief Every aligned_allocator with the same alignment can deallocate the memory of the others
+        template <typename U>
+        constexpr bool operator!=(const aligned_allocator<U, Alignment>&) const noexcept {
+
+            return false;
+
+        }
+
+
+    }; // struct aligned_allocator
+
+
+} // namespace measurements
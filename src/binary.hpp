@@ -0,0 +1,843 @@
+/**
+ * @file    binary.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the definition of the binary file format of the measurements,
+ *          with the binary_writer and binary_reader classes
+ * @date    2023-01-23
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    /**
+     * @brief Layout of the binary file format, every field is little-endian
+     *
+     * @note The file begins with a header of binary::header_size bytes:
+     *       - magic: 8 bytes, binary::magic
+     *       - version: u16
+     *       - flags: u16, binary::uncertainty_flag if every record stores an uncertainty
+     *       - unit count: u16
+     *       - reserved: u16
+     *       - record count: u64
+     *       - segment count: u64
+     *       - unit dictionary: binary::max_units entries of binary::unit_entry_size bytes,
+     *         as seven i8 exponents of the unit_base, the char symbol and the i16 exponent of the unit_prefix, the u8 unit flags, a reserved byte,
+     *         the u32 numerator and the u32 denominator of the unit_prefix, or the f64 multiplier if the unit has binary::inexact_unit
+     * @note The header is followed by the segments, each one is a block of fixed-width records sharing the same unit:
+     *       - record count: u64
+     *       - unit index: u16
+     *       - reserved: 6 bytes
+     *       - values: record count f64
+     *       - uncertainties: record count f64, only if the file has binary::uncertainty_flag
+     *       so that every column begins at a multiple of 8 bytes from the beginning of the file.
+     */
+    namespace binary {
+
+
+        constexpr char magic[8] = { 'M', 'E', 'A', 'S', 'B', 'I', 'N', '\0' }; ///< First bytes of a binary file
+
+        constexpr uint16_t version{2}; ///< Version of the format written by binary_writer, version 1 has no unit flags
+
+        constexpr uint16_t uncertainty_flag{1}; ///< Flag of a file whose records store an uncertainty
+
+        constexpr uint8_t overflow_unit{1}; ///< Flag of a unit whose unit_base overflowed
+
+        constexpr uint8_t inexact_unit{2}; ///< Flag of a unit whose unit_prefix is not exact
+
+        constexpr std::size_t max_units{256}; ///< Capacity of the unit dictionary
+
+        constexpr std::size_t unit_entry_size{20}; ///< Size of an entry of the unit dictionary
+
+        constexpr std::size_t preamble_size{32}; ///< Size of the header before the unit dictionary
+
+        constexpr std::size_t header_size{preamble_size + max_units * unit_entry_size}; ///< Size of the header
+
+        constexpr std::size_t segment_header_size{16}; ///< Size of the header of a segment
+
+        static_assert(header_size % 8 == 0 && segment_header_size % 8 == 0, "The columns must be aligned to 8 bytes");
+
+
+        /// @brief Store an unsigned integer in little-endian order
+        template <typename T>
+        inline void store(unsigned char* ptr, T value) noexcept {
+
+            for (std::size_t i{0}; i < sizeof(T); ++i, value >>= 8)
+                ptr[i] = static_cast<unsigned char>(value & 0xff);
+
+        }
+
+
+        /// @brief Load an unsigned integer stored in little-endian order
+        template <typename T>
+        inline T load(const unsigned char* ptr) noexcept {
+
+            T value{0};
+            for (std::size_t i{sizeof(T)}; i > 0; --i)
+                value = static_cast<T>((value << 8) | ptr[i - 1]);
+
+            return value;
+
+        }
+
+
+        /**
+         * @brief Copy a column of scalars from the host order to little-endian order, or back
+         *
+         * @param dst: destination buffer of size * 8 bytes
+         * @param src: source buffer of size * 8 bytes
+         * @param size: number of scalars
+         */
+        inline void copy_column(void* dst, const void* src, const std::size_t& size) noexcept {
+
+            static_assert(sizeof(scalar) == sizeof(uint64_t) && std::numeric_limits<scalar>::is_iec559, "The binary format stores IEEE 754 doubles");
+
+            if constexpr (std::endian::native == std::endian::little)
+                std::memcpy(dst, src, size * sizeof(scalar));
+
+            else
+                for (std::size_t i{0}; i < size; ++i) {
+
+                    uint64_t word;
+                    std::memcpy(&word, static_cast<const unsigned char*>(src) + i * sizeof(scalar), sizeof(word));
+                    binary::store(static_cast<unsigned char*>(dst) + i * sizeof(scalar), word);
+
+                }
+
+        }
+
+
+        /// @brief Header of a binary file
+        struct header {
+
+            uint16_t version{binary::version}; ///< Version of the format
+
+            uint16_t flags{0}; ///< Flags of the file
+
+            uint64_t records{0}; ///< Number of records
+
+            uint64_t segments{0}; ///< Number of segments
+
+            std::vector<unit> units; ///< Unit dictionary
+
+
+            /// @brief Check if the records store an uncertainty
+            bool has_uncertainty() const noexcept { return this->flags & binary::uncertainty_flag; }
+
+
+            /**
+             * @brief Encode the header
+             *
+             * @param buffer: buffer of binary::header_size bytes
+             */
+            void encode(unsigned char* buffer) const noexcept {
+
+                std::memset(buffer, 0, binary::header_size);
+                std::memcpy(buffer, binary::magic, sizeof(binary::magic));
+                binary::store<uint16_t>(buffer + 8, this->version);
+                binary::store<uint16_t>(buffer + 10, this->flags);
+                binary::store<uint16_t>(buffer + 12, static_cast<uint16_t>(this->units.size()));
+                binary::store<uint64_t>(buffer + 16, this->records);
+                binary::store<uint64_t>(buffer + 24, this->segments);
+
+                unsigned char* entry = buffer + binary::preamble_size;
+                for (const unit& units : this->units) {
+
+                    for (uint32_t lane{0}; lane < bitwidth::lanes; ++lane)
+                        entry[lane] = static_cast<unsigned char>(static_cast<int8_t>(units.base().exponent(lane)));
+                    entry[7] = static_cast<unsigned char>(units.prefix().symbol());
+                    binary::store<uint16_t>(entry + 8, static_cast<uint16_t>(units.prefix().exponent()));
+                    entry[10] = (units.base().overflow() ? binary::overflow_unit : 0) | (units.prefix().exact() ? 0 : binary::inexact_unit);
+                    if (units.prefix().exact()) {
+
+                        binary::store<uint32_t>(entry + 12, units.prefix().numerator());
+                        binary::store<uint32_t>(entry + 16, units.prefix().denominator());
+
+                    } else
+                        binary::store<uint64_t>(entry + 12, std::bit_cast<uint64_t>(units.prefix().multiplier()));
+
+                    entry += binary::unit_entry_size;
+
+                }
+
+            }
+
+
+            /**
+             * @brief Decode the header
+             *
+             * @param buffer: buffer of binary::header_size bytes
+             *
+             * @return header
+             */
+            static header decode(const unsigned char* buffer) {
+
+                if (std::memcmp(buffer, binary::magic, sizeof(binary::magic)) != 0)
+                    throw std::runtime_error("The file is not a binary measurements file");
+
+                header result;
+                result.version = binary::load<uint16_t>(buffer + 8);
+                if (result.version == 0 || result.version > binary::version)
+                    throw std::runtime_error("Unsupported version of the binary measurements file");
+
+                result.flags = binary::load<uint16_t>(buffer + 10);
+                const std::size_t unit_count = binary::load<uint16_t>(buffer + 12);
+                if (unit_count > binary::max_units)
+                    throw std::runtime_error("Corrupted unit dictionary in the binary measurements file");
+
+                result.records = binary::load<uint64_t>(buffer + 16);
+                result.segments = binary::load<uint64_t>(buffer + 24);
+
+                result.units.reserve(unit_count);
+                const unsigned char* entry = buffer + binary::preamble_size;
+                for (std::size_t i{0}; i < unit_count; ++i, entry += binary::unit_entry_size) {
+
+                    const auto exponent = [&](const std::size_t& lane) { return static_cast<int>(static_cast<int8_t>(entry[lane])); };
+                    const uint8_t unit_flags = entry[10];
+                    if (unit_flags & ~(binary::overflow_unit | binary::inexact_unit))
+                        throw std::runtime_error("Corrupted unit dictionary in the binary measurements file");
+
+                    unit_prefix prefix;
+                    if (unit_flags & binary::inexact_unit) {
+
+                        const scalar multiplier = std::bit_cast<scalar>(binary::load<uint64_t>(entry + 12));
+                        if (!(multiplier > 0) || !std::isfinite(multiplier))
+                            throw std::runtime_error("Corrupted unit dictionary in the binary measurements file");
+
+                        prefix = unit_prefix(multiplier, static_cast<char>(entry[7]));
+
+                    } else {
+
+                        const uint32_t numerator = binary::load<uint32_t>(entry + 12);
+                        const uint32_t denominator = binary::load<uint32_t>(entry + 16);
+                        if (numerator == 0 || denominator == 0)
+                            throw std::runtime_error("Corrupted unit dictionary in the binary measurements file");
+
+                        prefix = unit_prefix(static_cast<char>(entry[7]), static_cast<int16_t>(binary::load<uint16_t>(entry + 8)), numerator, denominator);
+
+                    }
+
+                    // an overflowed unit_base has every exponent set to zero, an exponent out of range flags it again
+                    if (unit_flags & binary::overflow_unit)
+                        result.units.emplace_back(prefix, unit_base(bitwidth::max_exponent + 1, 0, 0, 0, 0, 0, 0));
+                    else
+                        result.units.emplace_back(prefix, unit_base(exponent(0), exponent(1), exponent(2), exponent(3), exponent(4), exponent(5), exponent(6)));
+
+                }
+
+                return result;
+
+            }
+
+        };
+
+
+    } // namespace binary
+
+
+    /**
+     * @brief A class for writing measurements and umeasurements in a binary file
+     *
+     * @note The records are buffered in a segment, which is written when it is full or when the unit changes,
+     *       the header is written again with the final counts and unit dictionary on close
+     * @see binary
+     */
+    class binary_writer {
+
+
+        public:
+
+        // =============================================
+        // constructors & destructor
+        // =============================================
+
+            /**
+             * @brief Open a new binary file
+             *
+             * @param path: path of the file
+             * @param with_uncertainty: if set to true every record stores an uncertainty
+             * @param segment_capacity: number of records buffered before writing a segment
+             */
+            explicit binary_writer(const std::string& path,
+                                   const bool& with_uncertainty = true,
+                                   const std::size_t& segment_capacity = 1 << 16) :
+
+                file_(path, std::ios::binary | std::ios::trunc),
+                header_(),
+                segment_capacity_(std::max<std::size_t>(segment_capacity, 1)),
+                values_(),
+                uncertainties_(),
+                current_unit_(0) {
+
+                if (!this->file_)
+                    throw std::runtime_error("Cannot open the binary measurements file " + path);
+
+                this->header_.flags = with_uncertainty ? binary::uncertainty_flag : 0;
+                this->values_.reserve(this->segment_capacity_);
+                if (with_uncertainty)
+                    this->uncertainties_.reserve(this->segment_capacity_);
+
+                this->write_header();
+
+            }
+
+
+            binary_writer(const binary_writer& other) = delete;
+
+
+            /// @brief Close the file, if it is still open
+            ~binary_writer() noexcept {
+
+                try {
+
+                    this->close();
+
+                } catch (...) {}
+
+            }
+
+
+        // =============================================
+        // operators
+        // =============================================
+
+            binary_writer& operator=(const binary_writer& other) = delete;
+
+
+            /// @brief Write a measurement
+            binary_writer& operator<<(const measurement& meas) {
+
+                this->write(meas);
+
+                return *this;
+
+            }
+
+
+            /// @brief Write an umeasurement
+            binary_writer& operator<<(const umeasurement& umeas) {
+
+                this->write(umeas);
+
+                return *this;
+
+            }
+
+
+        // =============================================
+        // operations
+        // =============================================
+
+            /**
+             * @brief Write a measurement
+             *
+             * @param meas: measurement as l-value const reference
+             *
+             * @note If the file stores the uncertainties, the uncertainty of the record is zero
+             */
+            void write(const measurement& meas) {
+
+                this->append(meas.value(), 0.0, meas.units());
+
+            }
+
+
+            /**
+             * @brief Write an umeasurement
+             *
+             * @param umeas: umeasurement as l-value const reference
+             */
+            void write(const umeasurement& umeas) {
+
+                if (!this->header_.has_uncertainty())
+                    throw std::invalid_argument("Cannot write an umeasurement in a binary file without uncertainties");
+
+                this->append(umeas.value(), umeas.uncertainty(), umeas.units());
+
+            }
+
+
+            /**
+             * @brief Write a measurement_array as whole segments
+             *
+             * @param array: measurement_array as l-value const reference
+             */
+            void write(const measurement_array& array) {
+
+                this->flush();
+                if (this->header_.has_uncertainty()) {
+
+                    const binary_writer::container zeros(std::min(array.size(), this->segment_capacity_), 0.0);
+                    for (std::size_t first{0}; first < array.size(); first += this->segment_capacity_) {
+
+                        const std::size_t count = std::min(this->segment_capacity_, array.size() - first);
+                        this->write_segment(array.values().subspan(first, count), std::span<const scalar>(zeros).first(count), array.units());
+
+                    }
+
+                } else
+                    for (std::size_t first{0}; first < array.size(); first += this->segment_capacity_) {
+
+                        const std::size_t count = std::min(this->segment_capacity_, array.size() - first);
+                        this->write_segment(array.values().subspan(first, count), {}, array.units());
+
+                    }
+
+            }
+
+
+            /**
+             * @brief Write an umeasurement_array as whole segments
+             *
+             * @param array: umeasurement_array as l-value const reference
+             */
+            void write(const umeasurement_array& array) {
+
+                if (!this->header_.has_uncertainty())
+                    throw std::invalid_argument("Cannot write an umeasurement_array in a binary file without uncertainties");
+
+                this->flush();
+                for (std::size_t first{0}; first < array.size(); first += this->segment_capacity_) {
+
+                    const std::size_t count = std::min(this->segment_capacity_, array.size() - first);
+                    this->write_segment(array.values().subspan(first, count), array.uncertainties().subspan(first, count), array.units());
+
+                }
+
+            }
+
+
+            /// @brief Write the buffered records as a segment
+            void flush() {
+
+                if (this->values_.empty())
+                    return;
+
+                this->write_segment(this->values_, this->uncertainties_, this->header_.units[this->current_unit_]);
+                this->values_.clear();
+                this->uncertainties_.clear();
+
+            }
+
+
+            /// @brief Write the buffered records and the final header, then close the file
+            void close() {
+
+                if (!this->file_.is_open())
+                    return;
+
+                this->flush();
+                this->file_.seekp(0);
+                this->write_header();
+                this->file_.close();
+                if (this->file_.fail())
+                    throw std::runtime_error("Cannot write the binary measurements file");
+
+            }
+
+
+        // =============================================
+        // get methods
+        // =============================================
+
+            /// @brief Get the number of records written, including the buffered ones
+            std::size_t size() const noexcept { return this->header_.records + this->values_.size(); }
+
+            /// @brief Get the unit dictionary
+            const std::vector<unit>& units() const noexcept { return this->header_.units; }
+
+
+        private:
+
+            using container = std::vector<scalar, aligned_allocator<scalar>>;
+
+
+        // =============================================
+        // helpers
+        // =============================================
+
+            /// @brief Buffer a record, starting a new segment when the unit changes or the buffer is full
+            void append(const scalar& value, const scalar& uncertainty, const unit& units) {
+
+                if (this->values_.empty() || units != this->header_.units[this->current_unit_]) {
+
+                    this->flush();
+                    this->current_unit_ = this->unit_index(units);
+
+                } else if (this->values_.size() == this->segment_capacity_)
+                    this->flush();
+
+                this->values_.push_back(value);
+                if (this->header_.has_uncertainty())
+                    this->uncertainties_.push_back(uncertainty);
+
+            }
+
+
+            /// @brief Get the index of an unit in the dictionary, adding it if it is new
+            uint16_t unit_index(const unit& units) {
+
+                for (std::size_t i{0}; i < this->header_.units.size(); ++i)
+                    if (this->header_.units[i] == units)
+                        return static_cast<uint16_t>(i);
+
+                if (this->header_.units.size() == binary::max_units)
+                    throw std::runtime_error("Too many units for the dictionary of the binary measurements file");
+
+                this->header_.units.push_back(units);
+
+                return static_cast<uint16_t>(this->header_.units.size() - 1);
+
+            }
+
+
+            /// @brief Write a segment of records
+            void write_segment(std::span<const scalar> values, std::span<const scalar> uncertainties, const unit& units) {
+
+                if (values.empty())
+                    return;
+
+                unsigned char segment_header[binary::segment_header_size] = {};
+                binary::store<uint64_t>(segment_header, values.size());
+                binary::store<uint16_t>(segment_header + 8, this->unit_index(units));
+                this->file_.write(reinterpret_cast<const char*>(segment_header), binary::segment_header_size);
+
+                this->write_column(values);
+                if (this->header_.has_uncertainty())
+                    this->write_column(uncertainties);
+
+                if (!this->file_)
+                    throw std::runtime_error("Cannot write the binary measurements file");
+
+                this->header_.records += values.size();
+                ++this->header_.segments;
+
+            }
+
+
+            /// @brief Write a column of scalars in little-endian order
+            void write_column(std::span<const scalar> column) {
+
+                if constexpr (std::endian::native == std::endian::little)
+                    this->file_.write(reinterpret_cast<const char*>(column.data()), static_cast<std::streamsize>(column.size_bytes()));
+
+                else {
+
+                    std::vector<unsigned char> bytes(column.size_bytes());
+                    binary::copy_column(bytes.data(), column.data(), column.size());
+                    this->file_.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+
+                }
+
+            }
+
+
+            /// @brief Write the header at the current position
+            void write_header() {
+
+                unsigned char buffer[binary::header_size];
+                this->header_.encode(buffer);
+                this->file_.write(reinterpret_cast<const char*>(buffer), binary::header_size);
+
+            }
+
+
+        // =============================================
+        // class members
+        // =============================================
+
+            std::ofstream file_; ///< The binary file
+
+            binary::header header_; ///< Header with the counts and the unit dictionary
+
+            std::size_t segment_capacity_; ///< Number of records of a full segment
+
+            container values_; ///< Values of the buffered records
+
+            container uncertainties_; ///< Uncertainties of the buffered records
+
+            uint16_t current_unit_; ///< Unit index of the buffered records
+
+
+    }; // class binary_writer
+
+
+    /**
+     * @brief A class for reading measurements and umeasurements from a binary file
+     *
+     * @note The records are read a segment at a time
+     * @see binary
+     */
+    class binary_reader {
+
+
+        public:
+
+        // =============================================
+        // constructors & destructor
+        // =============================================
+
+            /**
+             * @brief Open a binary file and read its header
+             *
+             * @param path: path of the file
+             */
+            explicit binary_reader(const std::string& path) :
+
+                file_(path, std::ios::binary),
+                header_(),
+                values_(),
+                uncertainties_(),
+                current_unit_(0),
+                position_(0),
+                segments_read_(0),
+                bytes_left_(0) {
+
+                if (!this->file_)
+                    throw std::runtime_error("Cannot open the binary measurements file " + path);
+
+                unsigned char buffer[binary::header_size];
+                if (!this->file_.read(reinterpret_cast<char*>(buffer), binary::header_size))
+                    throw std::runtime_error("The binary measurements file is truncated");
+
+                this->header_ = binary::header::decode(buffer);
+
+                this->file_.seekg(0, std::ios::end);
+                const std::streamoff end = this->file_.tellg();
+                this->file_.seekg(binary::header_size, std::ios::beg);
+                if (!this->file_ || end < static_cast<std::streamoff>(binary::header_size))
+                    throw std::runtime_error("Cannot read the binary measurements file " + path);
+
+                this->bytes_left_ = static_cast<uint64_t>(end) - binary::header_size;
+
+            }
+
+
+            binary_reader(const binary_reader& other) = delete;
+
+
+            /// @brief Default destructor
+            ~binary_reader() = default;
+
+
+        // =============================================
+        // operators
+        // =============================================
+
+            binary_reader& operator=(const binary_reader& other) = delete;
+
+
+            /// @brief Check if there are records left to read
+            explicit operator bool() const noexcept {
+
+                return this->position_ < this->values_.size() || this->segments_read_ < this->header_.segments;
+
+            }
+
+
+        // =============================================
+        // operations
+        // =============================================
+
+            /**
+             * @brief Read the next record as a measurement
+             *
+             * @param meas: measurement to read
+             *
+             * @return bool: false if there are no records left
+             */
+            bool read(measurement& meas) {
+
+                if (!this->fill())
+                    return false;
+
+                meas = measurement(this->values_[this->position_++], this->header_.units[this->current_unit_]);
+
+                return true;
+
+            }
+
+
+            /**
+             * @brief Read the next record as an umeasurement
+             *
+             * @param umeas: umeasurement to read
+             *
+             * @return bool: false if there are no records left
+             */
+            bool read(umeasurement& umeas) {
+
+                if (!this->fill())
+                    return false;
+
+                const scalar uncertainty = this->header_.has_uncertainty() ? this->uncertainties_[this->position_] : 0.0;
+                umeas = umeasurement(this->values_[this->position_++], uncertainty, this->header_.units[this->current_unit_]);
+
+                return true;
+
+            }
+
+
+            /**
+             * @brief Read the rest of the next segment in a measurement_array
+             *
+             * @param array: measurement_array to read
+             *
+             * @return bool: false if there are no records left
+             */
+            bool read_segment(measurement_array& array) {
+
+                if (!this->fill())
+                    return false;
+
+                array = measurement_array(std::span<const scalar>(this->values_).subspan(this->position_), this->header_.units[this->current_unit_]);
+                this->position_ = this->values_.size();
+
+                return true;
+
+            }
+
+
+            /**
+             * @brief Read the rest of the next segment in an umeasurement_array
+             *
+             * @param array: umeasurement_array to read
+             *
+             * @return bool: false if there are no records left
+             *
+             * @note If the file has no uncertainties, the uncertainties are zero
+             */
+            bool read_segment(umeasurement_array& array) {
+
+                if (!this->fill())
+                    return false;
+
+                const std::span<const scalar> values = std::span<const scalar>(this->values_).subspan(this->position_);
+                if (this->header_.has_uncertainty())
+                    array = umeasurement_array(values, std::span<const scalar>(this->uncertainties_).subspan(this->position_), this->header_.units[this->current_unit_]);
+                else
+                    array = umeasurement_array(values, binary_reader::container(values.size(), 0.0), this->header_.units[this->current_unit_]);
+                this->position_ = this->values_.size();
+
+                return true;
+
+            }
+
+
+        // =============================================
+        // get methods
+        // =============================================
+
+            /// @brief Get the header of the file
+            const binary::header& header() const noexcept { return this->header_; }
+
+            /// @brief Get the number of records of the file
+            std::size_t size() const noexcept { return this->header_.records; }
+
+            /// @brief Check if the records store an uncertainty
+            bool has_uncertainty() const noexcept { return this->header_.has_uncertainty(); }
+
+            /// @brief Get the unit dictionary
+            const std::vector<unit>& units() const noexcept { return this->header_.units; }
+
+
+        private:
+
+            using container = std::vector<scalar, aligned_allocator<scalar>>;
+
+
+        // =============================================
+        // helpers
+        // =============================================
+
+            /**
+             * @brief Read the next segment if the current one is exhausted
+             *
+             * @return bool: false if there are no records left
+             */
+            bool fill() {
+
+                while (this->position_ == this->values_.size()) {
+
+                    if (this->segments_read_ == this->header_.segments)
+                        return false;
+
+                    unsigned char segment_header[binary::segment_header_size];
+                    if (!this->file_.read(reinterpret_cast<char*>(segment_header), binary::segment_header_size))
+                        throw std::runtime_error("The binary measurements file is truncated");
+
+                    this->bytes_left_ -= std::min<uint64_t>(this->bytes_left_, binary::segment_header_size);
+
+                    const uint64_t count = binary::load<uint64_t>(segment_header);
+                    this->current_unit_ = binary::load<uint16_t>(segment_header + 8);
+                    if (this->current_unit_ >= this->header_.units.size())
+                        throw std::runtime_error("Corrupted segment in the binary measurements file");
+
+                    // the count is checked against the rest of the file before any allocation
+                    const uint64_t columns = this->header_.has_uncertainty() ? 2 : 1;
+                    if (count > this->bytes_left_ / (columns * sizeof(scalar)))
+                        throw std::runtime_error("The binary measurements file is truncated");
+
+                    this->bytes_left_ -= columns * count * sizeof(scalar);
+
+                    this->read_column(this->values_, count);
+                    if (this->header_.has_uncertainty())
+                        this->read_column(this->uncertainties_, count);
+
+                    this->position_ = 0;
+                    ++this->segments_read_;
+
+                }
+
+                return true;
+
+            }
+
+
+            /**
+             * @brief Read a column of scalars stored in little-endian order
+             *
+             * @note count must have been checked against bytes_left_ by fill
+             */
+            void read_column(container& column, const uint64_t& count) {
+
+                column.resize(count);
+                if (!this->file_.read(reinterpret_cast<char*>(column.data()), static_cast<std::streamsize>(count * sizeof(scalar))))
+                    throw std::runtime_error("The binary measurements file is truncated");
+
+                if constexpr (std::endian::native != std::endian::little)
+                    binary::copy_column(column.data(), column.data(), count);
+
+            }
+
+
+        // =============================================
+        // class members
+        // =============================================
+
+            std::ifstream file_; ///< The binary file
+
+            binary::header header_; ///< Header with the counts and the unit dictionary
+
+            container values_; ///< Values of the current segment
+
+            container uncertainties_; ///< Uncertainties of the current segment
+
+            uint16_t current_unit_; ///< Unit index of the current segment
+
+            std::size_t position_; ///< Position of the next record in the current segment
+
+            uint64_t segments_read_; ///< Number of segments read
+
+            uint64_t bytes_left_; ///< Number of bytes of the file after the segments read
+
+
+    }; // class binary_reader
+
+
+} // namespace measurements
@@ -0,0 +1,360 @@
+/**
+ * @file    compact_measurement.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the compact_measurement class, a measurement storing the id of its unit in the unit_registry
+ * @date    2023-02-01
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    /**
+     * @brief A measurement storing its value and the 16 bit id of its unit in the global unit_registry
+     *
+     * @note It is 16 bytes wide instead of the 32 bytes of a measurement, and the units of two compact_measurements
+     *       are compared by comparing their ids
+     * @see units::unit_registry
+     */
+    class compact_measurement {
+
+
+        public:
+
+            using id_type = unit_registry::id_type; ///< Type of the ids of the units
+
+
+        // =============================================
+        // constructors & destructor
+        // =============================================
+
+            /**
+             * @brief Construct a new compact_measurement object
+             *
+             * @note The default value is 0 and the default unit is unitless
+             */
+            constexpr compact_measurement() noexcept :
+
+                value_{0.0},
+                id_{0} {}
+
+
+            /**
+             * @brief Construct a new compact_measurement object from a value and the id of a registered unit
+             *
+             * @param value: scalar as l-value const reference
+             * @param id: id returned by unit_registry::intern
+             */
+            constexpr compact_measurement(const scalar& value,
+                                          const id_type& id) noexcept :
+
+                value_{value},
+                id_{id} {}
+
+
+            /**
+             * @brief Construct a new compact_measurement object from a value and a unit, interning the unit
+             *
+             * @param value: scalar as l-value const reference
+             * @param units: unit as l-value const reference
+             */
+            compact_measurement(const scalar& value,
+                                const unit& units) :
+
+                value_{value},
+                id_{unit_registry::global().intern(units)} {}
+
+
+            /**
+             * @brief Construct a new compact_measurement object from a measurement, interning its unit
+             *
+             * @param meas: measurement as l-value const reference
+             */
+            explicit compact_measurement(const measurement& meas) :
+
+                compact_measurement(meas.value(), meas.units()) {}
+
+
+            /// @brief Default destructor
+            ~compact_measurement() noexcept = default;
+
+
+        // =============================================
+        // operators
+        // =============================================
+
+            /**
+             * @brief Add another compact_measurement to this compact_measurement
+             *
+             * @param other: compact_measurement as l-value const reference
+             *
+             * @return compact_measurement&
+             *
+             * @note The unit_base are checked first, then a unitless compact_measurement takes the unit of the other one, as for measurement
+             */
+            compact_measurement& operator+=(const compact_measurement& other) {
+
+                if (this->id_ != 0)
+                    this->value_ += other.value_as(this->id_, "Cannot add compact_measurements with different unit_base");
+
+                else {
+
+                    if (unit_registry::global()[other.id_].base() != unit_base())
+                        throw_invalid_argument("Cannot add compact_measurements with different unit_base", measurement_errc::unit_mismatch);
+
+                    this->value_ += other.value_;
+                    this->id_ = other.id_;
+
+                }
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Subtract another compact_measurement from this compact_measurement
+             *
+             * @param other: compact_measurement as l-value const reference
+             *
+             * @return compact_measurement&
+             */
+            compact_measurement& operator-=(const compact_measurement& other) {
+
+                this->value_ -= other.value_as(this->id_, "Cannot subtract compact_measurements with different unit_base");
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Multiply this compact_measurement by another compact_measurement
+             *
+             * @param other: compact_measurement as l-value const reference
+             *
+             * @return compact_measurement&
+             *
+             * @note The unit of the product is interned, unitless operands keep the id of the other one
+             */
+            compact_measurement& operator*=(const compact_measurement& other) {
+
+                this->value_ *= other.value_;
+                if (this->id_ == 0)
+                    this->id_ = other.id_;
+                else if (other.id_ != 0)
+                    this->id_ = unit_registry::global().intern(this->units() * other.units());
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Divide this compact_measurement by another compact_measurement
+             *
+             * @param other: compact_measurement as l-value const reference
+             *
+             * @return compact_measurement&
+             */
+            compact_measurement& operator/=(const compact_measurement& other) {
+
+                if (other.value_ == 0.0)
+                    throw_runtime_error("Cannot divide a compact_measurement by a zero compact_measurement", measurement_errc::division_by_zero);
+
+                this->value_ /= other.value_;
+                if (other.id_ != 0)
+                    this->id_ = unit_registry::global().intern(this->units() / other.units());
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Multiply this compact_measurement by a scalar
+             *
+             * @param scal: scalar as l-value const reference
+             *
+             * @return compact_measurement&
+             */
+            constexpr compact_measurement& operator*=(const scalar& scal) noexcept {
+
+                this->value_ *= scal;
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Divide this compact_measurement by a scalar
+             *
+             * @param scal: scalar as l-value const reference
+             *
+             * @return compact_measurement&
+             */
+            constexpr compact_measurement& operator/=(const scalar& scal) {
+
+                if (scal == 0.0)
+                    throw_runtime_error("Cannot divide a compact_measurement by 0", measurement_errc::division_by_zero);
+
+                this->value_ /= scal;
+
+                return *this;
+
+            }
+
+
+            friend compact_measurement operator+(compact_measurement lhs, const compact_measurement& rhs) { return lhs += rhs; }
+
+            friend compact_measurement operator-(compact_measurement lhs, const compact_measurement& rhs) { return lhs -= rhs; }
+
+            friend compact_measurement operator*(compact_measurement lhs, const compact_measurement& rhs) { return lhs *= rhs; }
+
+            friend compact_measurement operator/(compact_measurement lhs, const compact_measurement& rhs) { return lhs /= rhs; }
+
+            friend constexpr compact_measurement operator*(compact_measurement lhs, const scalar& rhs) noexcept { return lhs *= rhs; }
+
+            friend constexpr compact_measurement operator*(const scalar& lhs, compact_measurement rhs) noexcept { return rhs *= lhs; }
+
+            friend constexpr compact_measurement operator/(compact_measurement lhs, const scalar& rhs) { return lhs /= rhs; }
+
+
+            /// @brief Negate the compact_measurement
+            constexpr compact_measurement operator-() const noexcept { return { -this->value_, this->id_ }; }
+
+
+            /**
+             * @brief Equality operator, the other value is converted to the unit of this one if the ids differ
+             *
+             * @param other: compact_measurement to compare as l-value const reference
+             */
+            bool operator==(const compact_measurement& other) const noexcept {
+
+                return this->value_ == other.converted(this->id_);
+
+            }
+
+
+            /// @brief Inequality operator
+            bool operator!=(const compact_measurement& other) const noexcept { return !(*this == other); }
+
+            /// @brief More than operator
+            bool operator>(const compact_measurement& other) const noexcept { return this->value_ > other.converted(this->id_); }
+
+            /// @brief Less than operator
+            bool operator<(const compact_measurement& other) const noexcept { return this->value_ < other.converted(this->id_); }
+
+            /// @brief More than or equal operator
+            bool operator>=(const compact_measurement& other) const noexcept { return this->value_ >= other.converted(this->id_); }
+
+            /// @brief Less than or equal operator
+            bool operator<=(const compact_measurement& other) const noexcept { return this->value_ <= other.converted(this->id_); }
+
+
+            /**
+             * @brief Output operator for a compact_measurement
+             *
+             * @param os: std::ostream&
+             * @param meas: compact_measurement as l-value const reference
+             *
+             * @return std::ostream&
+             */
+            friend std::ostream& operator<<(std::ostream& os,
+                                            const compact_measurement& meas) noexcept {
+
+                os << meas.value_ << " " << meas.units();
+                return os;
+
+            }
+
+
+        // =============================================
+        // get methods
+        // =============================================
+
+            /// @brief Get the value of the compact_measurement
+            constexpr scalar value() const noexcept { return this->value_; }
+
+            /// @brief Get the value of the compact_measurement
+            constexpr scalar& value() noexcept { return this->value_; }
+
+            /// @brief Get the id of the unit of the compact_measurement, a perfect hash of the unit
+            constexpr id_type unit_id() const noexcept { return this->id_; }
+
+            /// @brief Get the unit of the compact_measurement from the unit_registry
+            const unit& units() const noexcept { return unit_registry::global()[this->id_]; }
+
+
+            /**
+             * @brief Get the value of the compact_measurement expressed in another unit
+             *
+             * @param desired_units: unit as l-value const reference
+             *
+             * @return scalar
+             */
+            scalar value_as(const unit& desired_units) const {
+
+                if (this->units().base() != desired_units.base())
+                    throw_conversion_error(this->units().base(), desired_units.base(), "value_as of compact_measurement");
+
+                return this->value_ * this->units().convertion_factor(desired_units);
+
+            }
+
+
+            /// @brief Get the compact_measurement as a measurement
+            measurement as_measurement() const noexcept { return { this->value_, this->units() }; }
+
+
+        private:
+
+        // =============================================
+        // helpers
+        // =============================================
+
+            /// @brief Get the value converted to the unit of an id, NaN if the unit_base differ
+            scalar converted(const id_type& id) const noexcept {
+
+                return (this->id_ == id) ? this->value_ : this->value_ * unit_registry::global().convertion_factor(this->id_, id);
+
+            }
+
+
+            /// @brief Get the value converted to the unit of an id, throwing if the unit_base differ
+            scalar value_as(const id_type& id, const char* message) const {
+
+                if (this->id_ == id)
+                    return this->value_;
+
+                const unit_registry& registry = unit_registry::global();
+                if (registry[this->id_].base() != registry[id].base())
+                    throw_invalid_argument(message, measurement_errc::unit_mismatch);
+
+                return this->value_ * registry.convertion_factor(this->id_, id);
+
+            }
+
+
+        // =============================================
+        // class members
+        // =============================================
+
+            scalar value_; ///< The numerical value of the compact_measurement
+
+            id_type id_; ///< The id of the unit of the compact_measurement in the unit_registry
+
+
+    }; // class compact_measurement
+
+
+    static_assert(sizeof(compact_measurement) == 16, "compact_measurement must be 16 bytes wide");
+
+
+} // namespace measurements
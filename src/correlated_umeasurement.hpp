@@ -0,0 +1,596 @@
+/**
+ * @file    correlated_umeasurement.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the definition and implementation of the uncertainty_components and correlated_umeasurement classes,
+ *          which propagate the uncertainties with sparse forward-mode differentiation
+ * @date    2023-01-29
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    /**
+     * @brief Sparse vector of the uncertainty components of a value, sorted by the id of their source
+     *
+     * @note Each component is the derivative of the value with respect to an independent source times the uncertainty of the source.
+     *       Up to inline_capacity components are stored inline, without allocating
+     */
+    class uncertainty_components {
+
+
+        public:
+
+            /// @brief Component of the uncertainty due to a source
+            struct entry {
+
+                uint64_t source; ///< id of the source
+
+                scalar component; ///< derivative of the value with respect to the source, times the uncertainty of the source
+
+            };
+
+
+            static constexpr std::size_t inline_capacity{8}; ///< Number of components stored without allocating
+
+
+        // =============================================
+        // constructors & destructor
+        // =============================================
+
+            /// @brief Construct a new empty uncertainty_components object
+            uncertainty_components() noexcept :
+
+                inline_(),
+                heap_(),
+                size_(0) {}
+
+
+            /**
+             * @brief Construct a new uncertainty_components object with a single component
+             *
+             * @param source: id of the source
+             * @param component: uncertainty component
+             */
+            uncertainty_components(const uint64_t& source, const scalar& component) noexcept :
+
+                inline_(),
+                heap_(),
+                size_(0) {
+
+                if (component != 0.0)
+                    this->inline_[this->size_++] = { source, component };
+
+            }
+
+
+        // =============================================
+        // operations
+        // =============================================
+
+            /**
+             * @brief Compute the linear combination of two uncertainty_components, merging them in linear time
+             *
+             * @param lhs: uncertainty_components as l-value const reference
+             * @param a: coefficient of lhs
+             * @param rhs: uncertainty_components as l-value const reference
+             * @param b: coefficient of rhs
+             *
+             * @return uncertainty_components
+             */
+            static uncertainty_components combine(const uncertainty_components& lhs, const scalar& a,
+                                                  const uncertainty_components& rhs, const scalar& b) {
+
+                uncertainty_components result;
+                entry* out = result.inline_.data();
+
+                const entry* x = lhs.data();
+                const entry* const x_end = x + lhs.size_;
+                const entry* y = rhs.data();
+                const entry* const y_end = y + rhs.size_;
+
+                // the components are merged inline, and spilled to the heap only when the merged size exceeds inline_capacity
+                std::size_t size{0};
+                const auto put = [&](const uint64_t& source, const scalar& component) {
+
+                    if (component == 0.0)
+                        return;
+
+                    if (size == inline_capacity && out == result.inline_.data())
+                        out = result.spill(lhs.size_ + rhs.size_);
+
+                    out[size++] = { source, component };
+
+                };
+
+                while (x != x_end && y != y_end) {
+
+                    if (x->source < y->source)
+                        put(x->source, a * x->component), ++x;
+
+                    else if (y->source < x->source)
+                        put(y->source, b * y->component), ++y;
+
+                    else
+                        put(x->source, a * x->component + b * y->component), ++x, ++y;
+
+                }
+
+                for (; x != x_end; ++x)
+                    put(x->source, a * x->component);
+                for (; y != y_end; ++y)
+                    put(y->source, b * y->component);
+
+                result.size_ = size;
+
+                return result;
+
+            }
+
+
+            /**
+             * @brief Scale every component
+             *
+             * @param factor: scalar as l-value const reference
+             *
+             * @return uncertainty_components
+             */
+            uncertainty_components scaled(const scalar& factor) const {
+
+                return uncertainty_components::combine(*this, factor, uncertainty_components(), 0.0);
+
+            }
+
+
+            /**
+             * @brief Compute the covariance of two values from their uncertainty_components
+             *
+             * @param lhs: uncertainty_components as l-value const reference
+             * @param rhs: uncertainty_components as l-value const reference
+             *
+             * @return scalar
+             */
+            friend scalar covariance(const uncertainty_components& lhs, const uncertainty_components& rhs) noexcept {
+
+                const entry* x = lhs.data();
+                const entry* const x_end = x + lhs.size_;
+                const entry* y = rhs.data();
+                const entry* const y_end = y + rhs.size_;
+
+                scalar result{0.0};
+                while (x != x_end && y != y_end) {
+
+                    if (x->source < y->source)
+                        ++x;
+                    else if (y->source < x->source)
+                        ++y;
+                    else
+                        result += (x++)->component * (y++)->component;
+
+                }
+
+                return result;
+
+            }
+
+
+            /// @brief Compute the variance, as the sum of the squares of the components
+            scalar variance() const noexcept {
+
+                scalar result{0.0};
+                for (const entry& e : this->entries())
+                    result += e.component * e.component;
+
+                return result;
+
+            }
+
+
+        // =============================================
+        // get methods
+        // =============================================
+
+            /// @brief Get the components
+            std::span<const entry> entries() const noexcept { return { this->data(), this->size_ }; }
+
+            /// @brief Get the number of components
+            std::size_t size() const noexcept { return this->size_; }
+
+            /// @brief Check if the components are stored without allocating
+            bool is_inline() const noexcept { return this->heap_.empty(); }
+
+
+        private:
+
+        // =============================================
+        // helpers
+        // =============================================
+
+            const entry* data() const noexcept { return this->heap_.empty() ? this->inline_.data() : this->heap_.data(); }
+
+
+            /**
+             * @brief Move the inline components to a heap buffer for at most capacity components
+             *
+             * @param capacity: maximum number of components, greater than inline_capacity
+             *
+             * @return entry*: the heap buffer
+             */
+            entry* spill(const std::size_t& capacity) {
+
+                this->heap_.resize(capacity);
+                std::copy(this->inline_.begin(), this->inline_.end(), this->heap_.begin());
+
+                return this->heap_.data();
+
+            }
+
+
+        // =============================================
+        // class members
+        // =============================================
+
+            std::array<entry, inline_capacity> inline_; ///< Inline components
+
+            std::vector<entry> heap_; ///< Components exceeding the inline capacity
+
+            std::size_t size_; ///< Number of components
+
+
+    }; // class uncertainty_components
+
+
+    /**
+     * @brief A class representing a measurement whose uncertainty keeps track of its independent sources,
+     *        so that the correlations between values sharing a source are propagated correctly
+     *
+     * @note Every operation propagates the components of the uncertainty at first order, merging the components of the operands,
+     *       and the uncertainty is computed only when it is read. Unlike the uncertainty_tape, nothing has to be recorded,
+     *       so it fits streaming computations
+     * @see uncertainty_components
+     */
+    class correlated_umeasurement {
+
+
+        public:
+
+            static constexpr uint64_t automatic_sources{uint64_t{1} << 63}; ///< First id of the sources created by source()
+
+
+        // =============================================
+        // constructors & destructor
+        // =============================================
+
+            /**
+             * @brief Construct a new correlated_umeasurement object without uncertainty
+             *
+             * @param meas: measurement as l-value const reference
+             */
+            explicit correlated_umeasurement(const measurement& meas = measurement()) noexcept :
+
+                value_(meas.value()),
+                units_(meas.units()),
+                components_() {}
+
+
+            /**
+             * @brief Construct a new correlated_umeasurement object as an independent source with a given id
+             *
+             * @param umeas: umeasurement as l-value const reference
+             * @param source: id of the source, different sources must have different ids
+             *
+             * @note The ids from automatic_sources are reserved to source(), a greater id throws a std::invalid_argument
+             */
+            correlated_umeasurement(const umeasurement& umeas, const uint64_t& source) :
+
+                value_(umeas.value()),
+                units_(umeas.units()),
+                components_(source, umeas.uncertainty()) {
+
+                if (source >= automatic_sources)
+                    throw_invalid_argument("The ids of the correlated_umeasurement sources from automatic_sources are reserved to source()");
+
+            }
+
+
+            /**
+             * @brief Construct a new correlated_umeasurement object as an independent source with a new id
+             *
+             * @param umeas: umeasurement as l-value const reference
+             *
+             * @return correlated_umeasurement
+             *
+             * @note The new ids are taken from automatic_sources, so they never collide with the ids given explicitly
+             */
+            static correlated_umeasurement source(const umeasurement& umeas) noexcept {
+
+                static std::atomic<uint64_t> next_source{automatic_sources};
+
+                return { umeas.value(), umeas.units(), uncertainty_components(next_source.fetch_add(1, std::memory_order_relaxed), umeas.uncertainty()) };
+
+            }
+
+
+        // =============================================
+        // operators
+        // =============================================
+
+            /// @brief Negate the correlated_umeasurement
+            friend correlated_umeasurement operator-(const correlated_umeasurement& x) {
+
+                return { -x.value_, x.units_, x.components_.scaled(-1.0) };
+
+            }
+
+
+            /// @brief Add two correlated_umeasurements, the result has the units of lhs
+            friend correlated_umeasurement operator+(const correlated_umeasurement& lhs, const correlated_umeasurement& rhs) {
+
+                const scalar factor = lhs.check_addable(rhs, "Cannot add correlated_umeasurements with different unit_base");
+
+                return { lhs.value_ + factor * rhs.value_, lhs.units_, uncertainty_components::combine(lhs.components_, 1.0, rhs.components_, factor) };
+
+            }
+
+
+            /// @brief Subtract two correlated_umeasurements, the result has the units of lhs
+            friend correlated_umeasurement operator-(const correlated_umeasurement& lhs, const correlated_umeasurement& rhs) {
+
+                const scalar factor = lhs.check_addable(rhs, "Cannot subtract correlated_umeasurements with different unit_base");
+
+                return { lhs.value_ - factor * rhs.value_, lhs.units_, uncertainty_components::combine(lhs.components_, 1.0, rhs.components_, -factor) };
+
+            }
+
+
+            /// @brief Multiply two correlated_umeasurements
+            friend correlated_umeasurement operator*(const correlated_umeasurement& lhs, const correlated_umeasurement& rhs) {
+
+                return { lhs.value_ * rhs.value_, lhs.units_ * rhs.units_, uncertainty_components::combine(lhs.components_, rhs.value_, rhs.components_, lhs.value_) };
+
+            }
+
+
+            /// @brief Divide two correlated_umeasurements
+            friend correlated_umeasurement operator/(const correlated_umeasurement& lhs, const correlated_umeasurement& rhs) {
+
+                if (rhs.value_ == 0.0)
+                    throw_runtime_error("Cannot divide a correlated_umeasurement by a zero correlated_umeasurement", measurement_errc::division_by_zero);
+
+                const scalar inv = 1.0 / rhs.value_;
+
+                return { lhs.value_ * inv, lhs.units_ / rhs.units_, uncertainty_components::combine(lhs.components_, inv, rhs.components_, -lhs.value_ * inv * inv) };
+
+            }
+
+
+            /// @brief Multiply by a scalar
+            friend correlated_umeasurement operator*(const correlated_umeasurement& lhs, const scalar& rhs) {
+
+                return { lhs.value_ * rhs, lhs.units_, lhs.components_.scaled(rhs) };
+
+            }
+
+
+            /// @brief Multiply a scalar
+            friend correlated_umeasurement operator*(const scalar& lhs, const correlated_umeasurement& rhs) {
+
+                return rhs * lhs;
+
+            }
+
+
+            /// @brief Divide by a scalar
+            friend correlated_umeasurement operator/(const correlated_umeasurement& lhs, const scalar& rhs) {
+
+                if (rhs == 0.0)
+                    throw_runtime_error("Cannot divide a correlated_umeasurement by 0", measurement_errc::division_by_zero);
+
+                return { lhs.value_ / rhs, lhs.units_, lhs.components_.scaled(1.0 / rhs) };
+
+            }
+
+
+            /// @brief Multiply by a measurement without uncertainty
+            friend correlated_umeasurement operator*(const correlated_umeasurement& lhs, const measurement& rhs) {
+
+                return { lhs.value_ * rhs.value(), lhs.units_ * rhs.units(), lhs.components_.scaled(rhs.value()) };
+
+            }
+
+
+            /// @brief Divide by a measurement without uncertainty
+            friend correlated_umeasurement operator/(const correlated_umeasurement& lhs, const measurement& rhs) {
+
+                if (rhs.value() == 0.0)
+                    throw_runtime_error("Cannot divide a correlated_umeasurement by a zero measurement", measurement_errc::division_by_zero);
+
+                return { lhs.value_ / rhs.value(), lhs.units_ / rhs.units(), lhs.components_.scaled(1.0 / rhs.value()) };
+
+            }
+
+
+            /// @brief Print the correlated_umeasurement as an umeasurement
+            friend std::ostream& operator<<(std::ostream& os, const correlated_umeasurement& x) {
+
+                return os << x.as_umeasurement();
+
+            }
+
+
+        // =============================================
+        // operations
+        // =============================================
+
+            /// @brief Raise a correlated_umeasurement to an integer power, the power 0 is a constant without uncertainty also at x = 0
+            friend correlated_umeasurement pow(const correlated_umeasurement& x, const int& power) {
+
+                const scalar derivative = (power == 0) ? 0.0 : power * std::pow(x.value_, power - 1);
+
+                return x.apply(std::pow(x.value_, power), derivative, x.units_.pow(power));
+
+            }
+
+
+            /// @brief Take the square root of a correlated_umeasurement
+            friend correlated_umeasurement sqrt(const correlated_umeasurement& x) {
+
+                if (x.value_ < 0.0)
+                    throw_runtime_error("Cannot take the square root of a negative correlated_umeasurement");
+
+                const scalar root = std::sqrt(x.value_);
+
+                return x.apply(root, 0.5 / root, x.units_.sqrt());
+
+            }
+
+
+            /// @brief Take the exponential of a unitless correlated_umeasurement
+            friend correlated_umeasurement exp(const correlated_umeasurement& x) {
+
+                if (x.units_ != unitless)
+                    throw_runtime_error("Cannot take the exponential of a correlated_umeasurement that is not unitless");
+
+                const scalar value = std::exp(x.value_);
+
+                return x.apply(value, value, unitless);
+
+            }
+
+
+            /// @brief Take the natural logarithm of a unitless correlated_umeasurement
+            friend correlated_umeasurement log(const correlated_umeasurement& x) {
+
+                if (x.units_ != unitless)
+                    throw_runtime_error("Cannot take the logarithm of a correlated_umeasurement that is not unitless");
+
+                return x.apply(std::log(x.value_), 1.0 / x.value_, unitless);
+
+            }
+
+
+            /// @brief Take the sine of a correlated_umeasurement in radians
+            friend correlated_umeasurement sin(const correlated_umeasurement& x) {
+
+                if (x.units_ != rad)
+                    throw_runtime_error("Cannot take the sine of a correlated_umeasurement that is not in radians");
+
+                return x.apply(std::sin(x.value_), std::cos(x.value_), unitless);
+
+            }
+
+
+            /// @brief Take the cosine of a correlated_umeasurement in radians
+            friend correlated_umeasurement cos(const correlated_umeasurement& x) {
+
+                if (x.units_ != rad)
+                    throw_runtime_error("Cannot take the cosine of a correlated_umeasurement that is not in radians");
+
+                return x.apply(std::cos(x.value_), -std::sin(x.value_), unitless);
+
+            }
+
+
+            /**
+             * @brief Compute the covariance of two correlated_umeasurements
+             *
+             * @param lhs: correlated_umeasurement as l-value const reference
+             * @param rhs: correlated_umeasurement as l-value const reference
+             *
+             * @return scalar, in the product of their units
+             */
+            friend scalar covariance(const correlated_umeasurement& lhs, const correlated_umeasurement& rhs) noexcept {
+
+                return covariance(lhs.components_, rhs.components_);
+
+            }
+
+
+            /**
+             * @brief Compute the correlation coefficient of two correlated_umeasurements
+             *
+             * @param lhs: correlated_umeasurement as l-value const reference
+             * @param rhs: correlated_umeasurement as l-value const reference
+             *
+             * @return scalar, between -1 and 1
+             */
+            friend scalar correlation(const correlated_umeasurement& lhs, const correlated_umeasurement& rhs) noexcept {
+
+                return covariance(lhs.components_, rhs.components_) / std::sqrt(lhs.components_.variance() * rhs.components_.variance());
+
+            }
+
+
+        // =============================================
+        // get methods
+        // =============================================
+
+            /// @brief Get the value
+            scalar value() const noexcept { return this->value_; }
+
+            /// @brief Get the uncertainty, computed from its components
+            scalar uncertainty() const noexcept { return std::sqrt(this->components_.variance()); }
+
+            /// @brief Get the units
+            const unit& units() const noexcept { return this->units_; }
+
+            /// @brief Get the uncertainty components
+            const uncertainty_components& components() const noexcept { return this->components_; }
+
+            /// @brief Get the value and the uncertainty as an umeasurement
+            umeasurement as_umeasurement() const { return { this->value_, this->uncertainty(), this->units_ }; }
+
+
+        private:
+
+        // =============================================
+        // helpers
+        // =============================================
+
+            /// @brief Construct a correlated_umeasurement from its members
+            correlated_umeasurement(const scalar& value, const unit& units, uncertainty_components&& components) noexcept :
+
+                value_(value),
+                units_(units),
+                components_(std::move(components)) {}
+
+
+            /// @brief Apply a function with the given value and derivative
+            correlated_umeasurement apply(const scalar& value, const scalar& derivative, const unit& units) const {
+
+                return { value, units, this->components_.scaled(derivative) };
+
+            }
+
+
+            /// @brief Check that other can be added to this correlated_umeasurement and get its convertion factor
+            scalar check_addable(const correlated_umeasurement& other, const char* message) const {
+
+                if (this->units_.base() != other.units_.base())
+                    throw_invalid_argument(message, measurement_errc::unit_mismatch);
+
+                return other.units_.convertion_factor(this->units_);
+
+            }
+
+
+        // =============================================
+        // class members
+        // =============================================
+
+            scalar value_; ///< Value
+
+            unit units_; ///< Units
+
+            uncertainty_components components_; ///< Components of the uncertainty
+
+
+    }; // class correlated_umeasurement
+
+
+} // namespace measurements
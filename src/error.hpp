@@ -0,0 +1,381 @@
+/**
+ * @file    error.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the error codes of the measurements, the result class template and the error_flag class
+ *          used by the operations that do not throw, and the out-of-line helpers throwing the exceptions
+ * @date    2023-01-26
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    /// @brief Error codes of the operations on measurements and umeasurements
+    enum class measurement_errc : uint8_t {
+
+        ok = 0, ///< no error
+
+        unit_mismatch, ///< the operands have different unit_base
+
+        division_by_zero, ///< the divisor is zero
+
+        negative_uncertainty, ///< the uncertainty is negative
+
+        out_of_domain ///< the operand is outside of the domain of the function
+
+    };
+
+
+    /**
+     * @brief Get the description of an error code
+     *
+     * @param error: measurement_errc as l-value const reference
+     *
+     * @return const char*
+     */
+    constexpr const char* message(const measurement_errc& error) noexcept {
+
+        switch (error) {
+
+            case measurement_errc::ok: return "No error";
+            case measurement_errc::unit_mismatch: return "The measurements have different unit_base";
+            case measurement_errc::division_by_zero: return "Cannot divide by zero";
+            case measurement_errc::negative_uncertainty: return "The uncertainty is negative";
+            case measurement_errc::out_of_domain: return "The measurement is out of the domain of the function";
+
+        }
+
+        return "Unknown error";
+
+    }
+
+
+    // =============================================
+    // throw helpers
+    // =============================================
+
+    // The helpers are kept out of line and cold, so that the operations calling them stay small enough to be inlined
+    // and the construction of the message is paid only when an exception is thrown
+
+
+    /**
+     * @brief Count a throw in the instrumentation, with the counter of its error code
+     *
+     * @param error: error code of the exception, measurement_errc::ok for the errors without a counter
+     */
+    constexpr void count_throw(const measurement_errc& error) noexcept {
+
+        instrumentation::count(instrumentation::counter::throws);
+        if (error == measurement_errc::unit_mismatch)
+            instrumentation::count(instrumentation::counter::unit_mismatch);
+        else if (error == measurement_errc::division_by_zero)
+            instrumentation::count(instrumentation::counter::division_by_zero);
+
+    }
+
+
+    /**
+     * @brief Throw a std::invalid_argument
+     *
+     * @param message: message of the exception
+     * @param error: error code counted by the instrumentation, measurement_errc::ok for the errors without a counter
+     */
+    [[noreturn, gnu::cold, gnu::noinline]] inline void throw_invalid_argument(const char* message, const measurement_errc& error = measurement_errc::ok) {
+
+        count_throw(error);
+        throw std::invalid_argument(message);
+
+    }
+
+
+    /**
+     * @brief Throw a std::runtime_error
+     *
+     * @param message: message of the exception
+     * @param error: error code counted by the instrumentation, measurement_errc::ok for the errors without a counter
+     */
+    [[noreturn, gnu::cold, gnu::noinline]] inline void throw_runtime_error(const char* message, const measurement_errc& error = measurement_errc::ok) {
+
+        count_throw(error);
+        throw std::runtime_error(message);
+
+    }
+
+
+    /**
+     * @brief Throw the exception corresponding to an error code, without counting the error
+     *
+     * @param error: measurement_errc as l-value const reference
+     *
+     * @note unit_mismatch and negative_uncertainty throw a std::invalid_argument, the other errors a std::runtime_error
+     * @note Only the throw is counted: the error was counted when the result reporting it was constructed
+     */
+    [[noreturn, gnu::cold, gnu::noinline]] inline void throw_reported_error(const measurement_errc& error) {
+
+        instrumentation::count(instrumentation::counter::throws);
+        if (error == measurement_errc::unit_mismatch || error == measurement_errc::negative_uncertainty)
+            throw std::invalid_argument(message(error));
+
+        throw std::runtime_error(message(error));
+
+    }
+
+
+    /**
+     * @brief Throw the exception corresponding to an error code
+     *
+     * @param error: measurement_errc as l-value const reference
+     *
+     * @note unit_mismatch and negative_uncertainty throw a std::invalid_argument, the other errors a std::runtime_error
+     */
+    [[noreturn, gnu::cold, gnu::noinline]] inline void throw_error(const measurement_errc& error) {
+
+        count_throw(error);
+        if (error == measurement_errc::unit_mismatch || error == measurement_errc::negative_uncertainty)
+            throw std::invalid_argument(message(error));
+
+        throw std::runtime_error(message(error));
+
+    }
+
+
+    /**
+     * @brief Throw a std::invalid_argument for a conversion between different unit_base
+     *
+     * @param from: unit_base of the measurement
+     * @param to: description of the target unit_base
+     * @param context: description of the operation
+     */
+    [[noreturn, gnu::cold, gnu::noinline]] inline void throw_conversion_error(const units::unit_base& from, const char* to, const char* context) {
+
+        count_throw(measurement_errc::unit_mismatch);
+        throw std::invalid_argument("Cannot convert from " + from.to_string() + " to " + to + " in " + context);
+
+    }
+
+
+    /**
+     * @brief Throw a std::invalid_argument for a conversion between different unit_base
+     *
+     * @param from: unit_base of the measurement
+     * @param to: target unit_base
+     * @param context: description of the operation
+     */
+    [[noreturn, gnu::cold, gnu::noinline]] inline void throw_conversion_error(const units::unit_base& from, const units::unit_base& to, const char* context) {
+
+        throw_conversion_error(from, to.to_string().c_str(), context);
+
+    }
+
+
+    // =============================================
+    // results
+    // =============================================
+
+    /**
+     * @brief Value of an operation that does not throw, with its error code
+     *
+     * @tparam T: type of the value
+     *
+     * @note When the operation fails the value is still set, with a NaN value, so that it can be propagated through a batch of operations
+     *       and the error can be checked once at the end
+     */
+    template <typename T>
+    class result {
+
+
+        public:
+
+        // =============================================
+        // constructors
+        // =============================================
+
+            /**
+             * @brief Construct a new result object
+             *
+             * @param value: value of the operation
+             * @param error: error code of the operation
+             */
+            constexpr result(const T& value, const measurement_errc& error = measurement_errc::ok) noexcept :
+
+                value_(value),
+                error_(error) {
+
+                // the nothrow operations report the errors instead of throwing them
+                if (error == measurement_errc::unit_mismatch)
+                    instrumentation::count(instrumentation::counter::unit_mismatch);
+                else if (error == measurement_errc::division_by_zero)
+                    instrumentation::count(instrumentation::counter::division_by_zero);
+
+            }
+
+
+        // =============================================
+        // operators
+        // =============================================
+
+            /// @brief Check if the operation succeeded
+            constexpr explicit operator bool() const noexcept { return this->error_ == measurement_errc::ok; }
+
+            /// @brief Get the value, without checking the error code
+            constexpr const T& operator*() const noexcept { return this->value_; }
+
+            /// @brief Access the value, without checking the error code
+            constexpr const T* operator->() const noexcept { return &this->value_; }
+
+
+        // =============================================
+        // get methods
+        // =============================================
+
+            /// @brief Check if the operation succeeded
+            constexpr bool has_value() const noexcept { return this->error_ == measurement_errc::ok; }
+
+            /// @brief Get the error code
+            constexpr measurement_errc error() const noexcept { return this->error_; }
+
+
+            /**
+             * @brief Get the value
+             *
+             * @return const T&
+             *
+             * @note If the operation failed the corresponding exception is thrown
+             */
+            constexpr const T& value() const {
+
+                if (this->error_ != measurement_errc::ok)
+                    throw_reported_error(this->error_);
+
+                return this->value_;
+
+            }
+
+
+            /**
+             * @brief Get the value, or another value if the operation failed
+             *
+             * @param other: value to return if the operation failed
+             *
+             * @return T
+             */
+            constexpr T value_or(const T& other) const noexcept {
+
+                return (this->error_ == measurement_errc::ok) ? this->value_ : other;
+
+            }
+
+
+        private:
+
+        // =============================================
+        // class members
+        // =============================================
+
+            T value_; ///< Value of the operation
+
+            measurement_errc error_; ///< Error code of the operation
+
+
+    }; // class result
+
+
+    /**
+     * @brief Sticky error flag, recording the first error of a batch of operations
+     *
+     * @note A batch of operations that do not throw can run with a single error_flag, which is checked once at the end
+     */
+    class error_flag {
+
+
+        public:
+
+        // =============================================
+        // constructors
+        // =============================================
+
+            /// @brief Construct a new error_flag object without errors
+            constexpr error_flag() noexcept :
+
+                error_(measurement_errc::ok) {}
+
+
+        // =============================================
+        // operators
+        // =============================================
+
+            /**
+             * @brief Get the value of a result, recording its error
+             *
+             * @param res: result as l-value const reference
+             *
+             * @return T
+             */
+            template <typename T>
+            constexpr T operator()(const result<T>& res) noexcept {
+
+                this->raise(res.error());
+
+                return *res;
+
+            }
+
+
+        // =============================================
+        // set & get methods
+        // =============================================
+
+            /**
+             * @brief Record an error, if no other error was recorded
+             *
+             * @param error: measurement_errc as l-value const reference
+             */
+            constexpr void raise(const measurement_errc& error) noexcept {
+
+                if (this->error_ == measurement_errc::ok)
+                    this->error_ = error;
+
+            }
+
+
+            /// @brief Clear the recorded error
+            constexpr void clear() noexcept { this->error_ = measurement_errc::ok; }
+
+            /// @brief Check if an error was recorded
+            constexpr bool failed() const noexcept { return this->error_ != measurement_errc::ok; }
+
+            /// @brief Get the first recorded error
+            constexpr measurement_errc error() const noexcept { return this->error_; }
+
+
+            /**
+             * @brief Throw the exception corresponding to the recorded error, if any
+             *
+             * @note The error is not counted again, it was counted by the result that reported it
+             */
+            constexpr void check() const {
+
+                if (this->error_ != measurement_errc::ok)
+                    throw_reported_error(this->error_);
+
+            }
+
+
+        private:
+
+        // =============================================
+        // class members
+        // =============================================
+
+            measurement_errc error_; ///< First recorded error
+
+
+    }; // class error_flag
+
+
+} // namespace measurements
@@ -0,0 +1,424 @@
+/**
+ * @file    expression.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the expression templates of the measurement_arrays, which evaluate
+ *          an arithmetic expression in a single loop without temporary arrays
+ * @date    2023-01-27
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    /**
+     * @brief Expression templates of the measurement_arrays
+     *
+     * @note An expression is built with lazy() and the usual arithmetic operators, for example
+     *
+     *       measurement_array power = evaluate(lazy(voltage) * lazy(current) + lazy(offset));
+     *
+     *       The units of every node and the factors converting the operands of the additions are computed once, while the expression is built,
+     *       and the values are computed by evaluate in a single loop, element by element, without temporary arrays
+     * @note evaluate does not check the divisors, as the operators of measurement_array, while evaluate_checked throws on a zero divisor
+     *       as the operators of measurement
+     * @note The nodes refer to the values of the arrays, which must outlive the expression
+     */
+    namespace expressions {
+
+
+        // =============================================
+        // nodes
+        // =============================================
+
+        /// @brief Leaf node referring to the values of a measurement_array or a measurement_view
+        struct terminal {
+
+            const scalar* data; ///< values of the array
+
+            std::size_t size; ///< number of elements
+
+            unit units; ///< units of the values
+
+            constexpr scalar operator[](const std::size_t& index) const noexcept { return this->data[index]; }
+
+            /// @brief Get an element, a leaf node has no divisors to check
+            constexpr scalar checked(const std::size_t& index, bool&) const noexcept { return this->data[index]; }
+
+        };
+
+
+        /// @brief Leaf node broadcasting a measurement or a scalar to every element
+        struct constant {
+
+            scalar value; ///< broadcast value
+
+            std::size_t size{std::dynamic_extent}; ///< broadcast nodes match any size
+
+            unit units; ///< units of the value
+
+            constexpr scalar operator[](const std::size_t&) const noexcept { return this->value; }
+
+            /// @brief Get an element, a leaf node has no divisors to check
+            constexpr scalar checked(const std::size_t&, bool&) const noexcept { return this->value; }
+
+        };
+
+
+        /// @brief Addition of two nodes, the right operand is converted to the units of the left one
+        struct plus {
+
+            static constexpr bool additive{true};
+
+            static constexpr scalar apply(const scalar& lhs, const scalar& rhs) noexcept { return lhs + rhs; }
+
+            static constexpr unit units(const unit& lhs, const unit&) noexcept { return lhs; }
+
+        };
+
+
+        /// @brief Subtraction of two nodes, the right operand is converted to the units of the left one
+        struct minus {
+
+            static constexpr bool additive{true};
+
+            static constexpr scalar apply(const scalar& lhs, const scalar& rhs) noexcept { return lhs - rhs; }
+
+            static constexpr unit units(const unit& lhs, const unit&) noexcept { return lhs; }
+
+        };
+
+
+        /// @brief Multiplication of two nodes
+        struct multiplies {
+
+            static constexpr bool additive{false};
+
+            static constexpr scalar apply(const scalar& lhs, const scalar& rhs) noexcept { return lhs * rhs; }
+
+            static constexpr unit units(const unit& lhs, const unit& rhs) noexcept { return lhs * rhs; }
+
+        };
+
+
+        /**
+         * @brief Division of two nodes
+         *
+         * @note Unlike the division of measurements, a zero divisor is not checked and gives an infinite or NaN value, as in the division of measurement_arrays,
+         *       evaluate_checked throws instead
+         */
+        struct divides {
+
+            static constexpr bool additive{false};
+
+            static constexpr scalar apply(const scalar& lhs, const scalar& rhs) noexcept { return lhs / rhs; }
+
+            static constexpr unit units(const unit& lhs, const unit& rhs) noexcept { return lhs / rhs; }
+
+        };
+
+
+        /**
+         * @brief Node applying a binary operation to two nodes
+         *
+         * @tparam Op: operation, as plus, minus, multiplies or divides
+         * @tparam L: left node
+         * @tparam R: right node
+         */
+        template <typename Op, typename L, typename R>
+        struct binary {
+
+            L lhs; ///< left operand
+
+            R rhs; ///< right operand
+
+            std::size_t size; ///< number of elements
+
+            unit units; ///< units of the result
+
+            scalar factor; ///< factor converting the right operand to the units of the left one
+
+
+            /**
+             * @brief Construct a new binary node, checking the sizes and the units of the operands
+             *
+             * @param left: left node
+             * @param right: right node
+             */
+            constexpr binary(const L& left, const R& right) :
+
+                lhs(left),
+                rhs(right),
+                size(std::min(left.size, right.size)),
+                units(Op::units(left.units, right.units)),
+                factor(1.0) {
+
+                if (left.size != right.size && left.size != std::dynamic_extent && right.size != std::dynamic_extent)
+                    throw_invalid_argument("Cannot combine measurement_arrays with different sizes");
+
+                if constexpr (Op::additive) {
+
+                    if (left.units.base() != right.units.base())
+                        throw_invalid_argument("Cannot add measurement_arrays with different unit_base", measurement_errc::unit_mismatch);
+
+                    this->factor = right.units.convertion_factor(left.units);
+
+                }
+
+            }
+
+
+            constexpr scalar operator[](const std::size_t& index) const noexcept {
+
+                if constexpr (Op::additive)
+                    return Op::apply(this->lhs[index], this->factor * this->rhs[index]);
+                else
+                    return Op::apply(this->lhs[index], this->rhs[index]);
+
+            }
+
+
+            /**
+             * @brief Get an element, checking the divisors while it is evaluated
+             *
+             * @param index: index of the element
+             * @param zero_divisor: set to true if a divisor of the element is zero, and left unchanged otherwise
+             *
+             * @return scalar
+             *
+             * @note Every node is evaluated once, so the check costs a comparison for each division
+             */
+            constexpr scalar checked(const std::size_t& index, bool& zero_divisor) const noexcept {
+
+                const scalar left = this->lhs.checked(index, zero_divisor);
+                const scalar right = this->rhs.checked(index, zero_divisor);
+
+                if constexpr (std::is_same_v<Op, divides>)
+                    zero_divisor |= (right == 0.0);
+
+                if constexpr (Op::additive)
+                    return Op::apply(left, this->factor * right);
+                else
+                    return Op::apply(left, right);
+
+            }
+
+        };
+
+
+        /**
+         * @brief Node negating another node
+         *
+         * @tparam E: negated node
+         */
+        template <typename E>
+        struct negate {
+
+            E operand; ///< negated node
+
+            std::size_t size; ///< number of elements
+
+            unit units; ///< units of the result
+
+
+            constexpr explicit negate(const E& node) noexcept :
+
+                operand(node),
+                size(node.size),
+                units(node.units) {}
+
+
+            constexpr scalar operator[](const std::size_t& index) const noexcept { return -this->operand[index]; }
+
+            /// @brief Get an element, checking the divisors of the negated node
+            constexpr scalar checked(const std::size_t& index, bool& zero_divisor) const noexcept { return -this->operand.checked(index, zero_divisor); }
+
+        };
+
+
+        // =============================================
+        // traits
+        // =============================================
+
+        template <typename T>
+        struct is_node : std::false_type {};
+
+        template <>
+        struct is_node<terminal> : std::true_type {};
+
+        template <>
+        struct is_node<constant> : std::true_type {};
+
+        template <typename Op, typename L, typename R>
+        struct is_node<binary<Op, L, R>> : std::true_type {};
+
+        template <typename E>
+        struct is_node<negate<E>> : std::true_type {};
+
+
+        /// @brief Node of an expression
+        template <typename T>
+        concept node = is_node<std::remove_cvref_t<T>>::value;
+
+
+        /// @brief Operand that can be combined with a node
+        template <typename T>
+        concept operand = node<T> ||
+                          std::same_as<std::remove_cvref_t<T>, measurement_array> ||
+                          std::same_as<std::remove_cvref_t<T>, measurement_view> ||
+                          std::same_as<std::remove_cvref_t<T>, measurement> ||
+                          std::is_arithmetic_v<std::remove_cvref_t<T>>;
+
+
+        /// @brief Get the node of an operand
+        template <node E>
+        constexpr const E& as_node(const E& expr) noexcept { return expr; }
+
+        /// @brief Get the node of a measurement_view
+        constexpr terminal as_node(const measurement_view& view) noexcept { return { view.values().data(), view.size(), view.units() }; }
+
+        /// @brief Get the node of a measurement_array
+        inline terminal as_node(const measurement_array& array) noexcept { return as_node(array.view()); }
+
+        /// @brief Get the node broadcasting a measurement
+        constexpr constant as_node(const measurement& meas) noexcept { return { meas.value(), std::dynamic_extent, meas.units() }; }
+
+        /// @brief Get the node broadcasting a unitless scalar
+        constexpr constant as_node(const scalar& value) noexcept { return { value, std::dynamic_extent, unit() }; }
+
+
+        /// @brief Type of the node of an operand
+        template <typename T>
+        using node_t = std::remove_cvref_t<decltype(as_node(std::declval<const T&>()))>;
+
+
+        // =============================================
+        // operators
+        // =============================================
+
+        template <operand L, operand R> requires (node<L> || node<R>)
+        constexpr binary<plus, node_t<L>, node_t<R>> operator+(const L& lhs, const R& rhs) { return { as_node(lhs), as_node(rhs) }; }
+
+        template <operand L, operand R> requires (node<L> || node<R>)
+        constexpr binary<minus, node_t<L>, node_t<R>> operator-(const L& lhs, const R& rhs) { return { as_node(lhs), as_node(rhs) }; }
+
+        template <operand L, operand R> requires (node<L> || node<R>)
+        constexpr binary<multiplies, node_t<L>, node_t<R>> operator*(const L& lhs, const R& rhs) { return { as_node(lhs), as_node(rhs) }; }
+
+        template <operand L, operand R> requires (node<L> || node<R>)
+        constexpr binary<divides, node_t<L>, node_t<R>> operator/(const L& lhs, const R& rhs) { return { as_node(lhs), as_node(rhs) }; }
+
+        template <node E>
+        constexpr negate<std::remove_cvref_t<E>> operator-(const E& expr) noexcept { return negate<std::remove_cvref_t<E>>(expr); }
+
+
+    } // namespace expressions
+
+
+    /**
+     * @brief Begin an expression on the values of a measurement_array or a measurement_view
+     *
+     * @param view: measurement_view as l-value const reference, a measurement_array converts implicitly
+     *
+     * @return expressions::terminal
+     *
+     * @note The values are not copied, the array must outlive the expression
+     */
+    constexpr expressions::terminal lazy(const measurement_view& view) noexcept {
+
+        return expressions::as_node(view);
+
+    }
+
+
+    /**
+     * @brief Evaluate an expression in a measurement_array, reusing its storage
+     *
+     * @param expr: expression as l-value const reference
+     * @param result: measurement_array to overwrite, it can be an operand of the expression
+     */
+    template <expressions::node E>
+    void evaluate(const E& expr, measurement_array& result) {
+
+        if (expr.size == std::dynamic_extent)
+            throw_invalid_argument("Cannot evaluate an expression without measurement_arrays");
+
+        result.resize(expr.size);
+        result.units() = expr.units;
+        scalar* out = result.values().data();
+        for (std::size_t i{0}; i < expr.size; ++i)
+            out[i] = expr[i];
+
+    }
+
+
+    /**
+     * @brief Evaluate an expression in a new measurement_array
+     *
+     * @param expr: expression as l-value const reference
+     *
+     * @return measurement_array
+     */
+    template <expressions::node E>
+    measurement_array evaluate(const E& expr) {
+
+        measurement_array result(expr.units);
+        evaluate(expr, result);
+
+        return result;
+
+    }
+
+
+    /**
+     * @brief Evaluate an expression in a measurement_array, reusing its storage and checking its divisors
+     *
+     * @param expr: expression as l-value const reference
+     * @param result: measurement_array to overwrite, it can be an operand of the expression
+     *
+     * @note A zero divisor throws a std::runtime_error as the division of measurements, after the whole expression is evaluated in result
+     */
+    template <expressions::node E>
+    void evaluate_checked(const E& expr, measurement_array& result) {
+
+        if (expr.size == std::dynamic_extent)
+            throw_invalid_argument("Cannot evaluate an expression without measurement_arrays");
+
+        result.resize(expr.size);
+        result.units() = expr.units;
+        scalar* out = result.values().data();
+        bool zero_divisor{false};
+        for (std::size_t i{0}; i < expr.size; ++i)
+            out[i] = expr.checked(i, zero_divisor);
+
+        if (zero_divisor)
+            throw_error(measurement_errc::division_by_zero);
+
+    }
+
+
+    /**
+     * @brief Evaluate an expression in a new measurement_array, checking its divisors
+     *
+     * @param expr: expression as l-value const reference
+     *
+     * @return measurement_array
+     *
+     * @note A zero divisor throws a std::runtime_error as the division of measurements
+     */
+    template <expressions::node E>
+    measurement_array evaluate_checked(const E& expr) {
+
+        measurement_array result(expr.units);
+        evaluate_checked(expr, result);
+
+        return result;
+
+    }
+
+
+} // namespace measurements
@@ -0,0 +1,416 @@
+/**
+ * @file    fixed_measurement.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the fixed_measurement class, a measurement storing an integer count of a quantum unit
+ * @date    2023-02-02
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    /**
+     * @brief A measurement storing its value as an int64_t count of a quantum, as 1 ns or 1 pC
+     *
+     * @note The additions and the subtractions are exact, so a sum does not depend on the order of its terms.
+     *       The operators throw on overflow, while saturating_add and saturating_subtract clamp the count
+     */
+    class fixed_measurement {
+
+
+        public:
+
+        // =============================================
+        // constructors & destructor
+        // =============================================
+
+            /**
+             * @brief Construct a new fixed_measurement object with a zero count
+             *
+             * @param quantum: unit counted by the fixed_measurement, as ns
+             */
+            explicit constexpr fixed_measurement(const unit& quantum = unit()) noexcept :
+
+                count_{0},
+                quantum_(quantum) {}
+
+
+            /**
+             * @brief Construct a new fixed_measurement object from a count and a quantum
+             *
+             * @param count: number of quanta
+             * @param quantum: unit counted by the fixed_measurement
+             */
+            constexpr fixed_measurement(const int64_t& count,
+                                        const unit& quantum) noexcept :
+
+                count_{count},
+                quantum_(quantum) {}
+
+
+            /**
+             * @brief Construct a new fixed_measurement object from a measurement, rounded to the nearest quantum
+             *
+             * @param meas: measurement as l-value const reference
+             * @param quantum: unit counted by the fixed_measurement
+             *
+             * @note It throws if the unit_base differ or if the count does not fit in an int64_t
+             */
+            constexpr fixed_measurement(const measurement& meas,
+                                        const unit& quantum) :
+
+                count_{fixed_measurement::to_count(meas, quantum)},
+                quantum_(quantum) {}
+
+
+            /// @brief Default destructor
+            ~fixed_measurement() noexcept = default;
+
+
+        // =============================================
+        // operators
+        // =============================================
+
+            /**
+             * @brief Add another fixed_measurement with the same quantum
+             *
+             * @param other: fixed_measurement as l-value const reference
+             *
+             * @return fixed_measurement&
+             *
+             * @note It throws if the quanta differ or if the count overflows
+             */
+            constexpr fixed_measurement& operator+=(const fixed_measurement& other) {
+
+                this->check_quantum(other);
+                int64_t count;
+                if (__builtin_add_overflow(this->count_, other.count_, &count))
+                    throw_runtime_error("The addition of fixed_measurements overflowed");
+
+                this->count_ = count;
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Subtract another fixed_measurement with the same quantum
+             *
+             * @param other: fixed_measurement as l-value const reference
+             *
+             * @return fixed_measurement&
+             *
+             * @note It throws if the quanta differ or if the count overflows
+             */
+            constexpr fixed_measurement& operator-=(const fixed_measurement& other) {
+
+                this->check_quantum(other);
+                int64_t count;
+                if (__builtin_sub_overflow(this->count_, other.count_, &count))
+                    throw_runtime_error("The subtraction of fixed_measurements overflowed");
+
+                this->count_ = count;
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Add a measurement, rounded to the nearest quantum
+             *
+             * @param meas: measurement as l-value const reference
+             *
+             * @return fixed_measurement&
+             */
+            constexpr fixed_measurement& operator+=(const measurement& meas) {
+
+                return *this += fixed_measurement(meas, this->quantum_);
+
+            }
+
+
+            /**
+             * @brief Subtract a measurement, rounded to the nearest quantum
+             *
+             * @param meas: measurement as l-value const reference
+             *
+             * @return fixed_measurement&
+             */
+            constexpr fixed_measurement& operator-=(const measurement& meas) {
+
+                return *this -= fixed_measurement(meas, this->quantum_);
+
+            }
+
+
+            /**
+             * @brief Multiply the count by an integer
+             *
+             * @param factor: int64_t as l-value const reference
+             *
+             * @return fixed_measurement&
+             *
+             * @note It throws if the count overflows
+             */
+            constexpr fixed_measurement& operator*=(const int64_t& factor) {
+
+                int64_t count;
+                if (__builtin_mul_overflow(this->count_, factor, &count))
+                    throw_runtime_error("The multiplication of a fixed_measurement overflowed");
+
+                this->count_ = count;
+
+                return *this;
+
+            }
+
+
+            friend constexpr fixed_measurement operator+(fixed_measurement lhs, const fixed_measurement& rhs) { return lhs += rhs; }
+
+            friend constexpr fixed_measurement operator-(fixed_measurement lhs, const fixed_measurement& rhs) { return lhs -= rhs; }
+
+            friend constexpr fixed_measurement operator*(fixed_measurement lhs, const int64_t& rhs) { return lhs *= rhs; }
+
+            friend constexpr fixed_measurement operator*(const int64_t& lhs, fixed_measurement rhs) { return rhs *= lhs; }
+
+
+            /// @brief Negate the fixed_measurement, it throws if the count is the minimum int64_t
+            constexpr fixed_measurement operator-() const {
+
+                if (this->count_ == std::numeric_limits<int64_t>::min())
+                    throw_runtime_error("The negation of a fixed_measurement overflowed");
+
+                return { -this->count_, this->quantum_ };
+
+            }
+
+
+            /**
+             * @brief Equality operator, the counts are compared exactly if the quanta are equal
+             *
+             * @param other: fixed_measurement to compare as l-value const reference
+             */
+            constexpr bool operator==(const fixed_measurement& other) const noexcept {
+
+                return (this->quantum_ == other.quantum_) ? this->count_ == other.count_ : this->as_measurement() == other.as_measurement();
+
+            }
+
+
+            /// @brief Inequality operator
+            constexpr bool operator!=(const fixed_measurement& other) const noexcept { return !(*this == other); }
+
+
+            /// @brief Less than operator
+            constexpr bool operator<(const fixed_measurement& other) const noexcept {
+
+                return (this->quantum_ == other.quantum_) ? this->count_ < other.count_ : this->as_measurement() < other.as_measurement();
+
+            }
+
+
+            /// @brief More than operator
+            constexpr bool operator>(const fixed_measurement& other) const noexcept { return other < *this; }
+
+            /// @brief Less than or equal operator
+            constexpr bool operator<=(const fixed_measurement& other) const noexcept { return !(other < *this); }
+
+            /// @brief More than or equal operator
+            constexpr bool operator>=(const fixed_measurement& other) const noexcept { return !(*this < other); }
+
+
+            /**
+             * @brief Output operator for a fixed_measurement
+             *
+             * @param os: std::ostream&
+             * @param meas: fixed_measurement as l-value const reference
+             *
+             * @return std::ostream&
+             */
+            friend std::ostream& operator<<(std::ostream& os,
+                                            const fixed_measurement& meas) noexcept {
+
+                os << meas.count_ << " " << meas.quantum_;
+                return os;
+
+            }
+
+
+        // =============================================
+        // methods
+        // =============================================
+
+            /**
+             * @brief Add another fixed_measurement with the same quantum, clamping the count on overflow
+             *
+             * @param other: fixed_measurement as l-value const reference
+             *
+             * @return fixed_measurement&
+             */
+            constexpr fixed_measurement& saturating_add(const fixed_measurement& other) {
+
+                this->check_quantum(other);
+                if (__builtin_add_overflow(this->count_, other.count_, &this->count_))
+                    this->count_ = (other.count_ > 0) ? std::numeric_limits<int64_t>::max() : std::numeric_limits<int64_t>::min();
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Subtract another fixed_measurement with the same quantum, clamping the count on overflow
+             *
+             * @param other: fixed_measurement as l-value const reference
+             *
+             * @return fixed_measurement&
+             */
+            constexpr fixed_measurement& saturating_subtract(const fixed_measurement& other) {
+
+                this->check_quantum(other);
+                if (__builtin_sub_overflow(this->count_, other.count_, &this->count_))
+                    this->count_ = (other.count_ < 0) ? std::numeric_limits<int64_t>::max() : std::numeric_limits<int64_t>::min();
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Sum the values of a measurement_view exactly, each one rounded to the nearest quantum
+             *
+             * @param values: measurement_view as l-value const reference, a measurement_array converts implicitly
+             * @param quantum: unit counted by the result
+             *
+             * @return fixed_measurement
+             *
+             * @note The unit is checked once, and the sum is the same for any order of the values
+             * @note It throws if a value is not finite, if it does not fit in an int64_t count or if the sum overflows
+             */
+            static fixed_measurement accumulate(const measurement_view& values, const unit& quantum) {
+
+                if (values.units().base() != quantum.base())
+                    throw_conversion_error(values.units().base(), quantum.base(), "accumulation of a fixed_measurement");
+
+                const scalar factor = values.units().convertion_factor(quantum);
+                int64_t total{0};
+                bool overflow{false};
+                for (const scalar& value : values.values()) {
+
+                    // the range check is false for NaN, so the non-finite values are flagged with the out of range ones
+                    const scalar count = value * factor;
+                    overflow |= !(count > -0x1.0p63 && count < 0x1.0p63);
+                    overflow |= __builtin_add_overflow(total, fixed_measurement::round(count), &total);
+
+                }
+
+                if (overflow)
+                    throw_runtime_error("The accumulation of a fixed_measurement overflowed or met a value out of the range of the count");
+
+                return { total, quantum };
+
+            }
+
+
+        // =============================================
+        // get methods
+        // =============================================
+
+            /// @brief Get the number of quanta
+            constexpr int64_t count() const noexcept { return this->count_; }
+
+            /// @brief Get the quantum
+            constexpr const unit& quantum() const noexcept { return this->quantum_; }
+
+            /// @brief Get the value as a scalar, in units of the quantum
+            constexpr scalar value() const noexcept { return static_cast<scalar>(this->count_); }
+
+
+            /**
+             * @brief Get the value expressed in another unit
+             *
+             * @param desired_units: unit as l-value const reference
+             *
+             * @return scalar
+             */
+            constexpr scalar value_as(const unit& desired_units) const {
+
+                return this->as_measurement().value_as(desired_units);
+
+            }
+
+
+            /// @brief Get the fixed_measurement as a measurement
+            constexpr measurement as_measurement() const noexcept { return measurement(static_cast<scalar>(this->count_), this->quantum_); }
+
+
+        private:
+
+        // =============================================
+        // helpers
+        // =============================================
+
+            /// @brief Round a value to the nearest int64_t, saturating out of range values; NaN rounds to 0
+            static constexpr int64_t round(const scalar& value) noexcept {
+
+                constexpr scalar limit{0x1.0p63};
+                if (!(value == value))
+                    return 0;
+                if (value >= limit)
+                    return std::numeric_limits<int64_t>::max();
+                if (value < -limit)
+                    return std::numeric_limits<int64_t>::min();
+
+                const scalar truncated = static_cast<scalar>(static_cast<int64_t>(value));
+                const scalar rest = value - truncated;
+                const int64_t count = static_cast<int64_t>(truncated);
+
+                return (rest >= 0.5) ? count + 1 : (rest <= -0.5) ? count - 1 : count;
+
+            }
+
+
+            /// @brief Get the count of a measurement in a quantum, throwing if it does not fit in an int64_t
+            static constexpr int64_t to_count(const measurement& meas, const unit& quantum) {
+
+                if (meas.units().base() != quantum.base())
+                    throw_conversion_error(meas.units().base(), quantum.base(), "initialization of fixed_measurement");
+
+                const scalar value = meas.value_as(quantum);
+                if (!(value > -0x1.0p63 && value < 0x1.0p63))
+                    throw_invalid_argument("Cannot represent the measurement as an int64_t count of the quantum");
+
+                return fixed_measurement::round(value);
+
+            }
+
+
+            /// @brief Throw if the quantum of another fixed_measurement differs
+            constexpr void check_quantum(const fixed_measurement& other) const {
+
+                if (this->quantum_ != other.quantum_)
+                    throw_invalid_argument("Cannot combine fixed_measurements with different quanta");
+
+            }
+
+
+        // =============================================
+        // class members
+        // =============================================
+
+            int64_t count_; ///< The number of quanta
+
+            unit quantum_; ///< The unit counted by the fixed_measurement
+
+
+    }; // class fixed_measurement
+
+
+} // namespace measurements
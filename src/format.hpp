@@ -0,0 +1,305 @@
+/**
+ * @file    format.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the format specifications of measurements and umeasurements
+ *          and, when <format> is available, the std::formatter specializations built on them
+ * @date    2023-01-22
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    /**
+     * @brief Format specification of a measurement or an umeasurement, as read by parse_format_spec
+     *
+     * @note The syntax is [.digits][f|e][p]:
+     *       - digits: significant digits of the value of a measurement, or of the uncertainty of an umeasurement
+     *       - f, e: fixed or scientific notation, by default it is chosen as by operator<<
+     *       - p: parenthesized style of an umeasurement, as "1.2345(52) m" instead of "(1.2345 ± 0.0052) m"
+     */
+    struct format_spec {
+
+        int digits{0}; ///< significant digits, 0 means the default (shortest value, one digit of uncertainty)
+
+        char notation{'\0'}; ///< 'f' for fixed, 'e' for scientific, '\0' for automatic
+
+        bool parenthesized{false}; ///< parenthesized style of the uncertainty
+
+    };
+
+
+    /**
+     * @brief Parse a format specification up to the closing brace
+     *
+     * @param first: begin of the specification
+     * @param last: end of the specification
+     * @param spec: format_spec to fill
+     *
+     * @return It: position of the closing brace or last, first is returned if the specification is invalid
+     */
+    template <typename It>
+    constexpr It parse_format_spec(It first, It last, format_spec& spec) noexcept {
+
+        It it = first;
+        if (it != last && *it == '.') {
+
+            ++it;
+            if (it == last || *it < '1' || *it > '9')
+                return first;
+
+            spec.digits = 0;
+            for (; it != last && *it >= '0' && *it <= '9'; ++it) {
+
+                spec.digits = 10 * spec.digits + (*it - '0');
+                if (spec.digits > std::numeric_limits<scalar>::max_digits10)
+                    return first;
+
+            }
+
+        }
+
+        if (it != last && (*it == 'f' || *it == 'e'))
+            spec.notation = *it++;
+
+        if (it != last && *it == 'p') {
+
+            spec.parenthesized = true;
+            ++it;
+
+        }
+
+        if (it != last && *it != '}')
+            return first;
+
+        return it;
+
+    }
+
+
+    /**
+     * @brief Get the position of the first significant digit of a scalar, as the power of ten
+     *
+     * @param value: scalar as l-value const reference
+     *
+     * @return int
+     */
+    inline int leading_digit(const scalar& value) noexcept {
+
+        return (value == 0.0 || !std::isfinite(value)) ? 0 : static_cast<int>(std::floor(std::log10(std::fabs(value))));
+
+    }
+
+
+    /**
+     * @brief Write a measurement in a buffer following a format specification, without allocating
+     *
+     * @param first: begin of the buffer
+     * @param last: end of the buffer
+     * @param meas: measurement as l-value const reference
+     * @param spec: format_spec as l-value const reference
+     *
+     * @return std::to_chars_result
+     */
+    inline std::to_chars_result to_chars(char* first, char* last, const measurement& meas, const format_spec& spec) noexcept {
+
+        if (spec.digits == 0 && spec.notation == '\0')
+            return to_chars(first, last, meas);
+
+        const int digits = (spec.digits == 0) ? 6 : spec.digits;
+        if (spec.notation == 'e')
+            return to_chars(first, last, meas, std::chars_format::scientific, digits - 1);
+
+        if (spec.notation == 'f')
+            return to_chars(first, last, meas, std::chars_format::fixed, std::max(0, digits - 1 - leading_digit(meas.value())));
+
+        return to_chars(first, last, meas, std::chars_format::general, digits);
+
+    }
+
+
+    /**
+     * @brief Write an umeasurement in a buffer following a format specification, without allocating
+     *
+     * @param first: begin of the buffer
+     * @param last: end of the buffer
+     * @param umeas: umeasurement as l-value const reference
+     * @param spec: format_spec as l-value const reference
+     *
+     * @return std::to_chars_result
+     *
+     * @note The value is rounded to the last significant digit of the uncertainty
+     */
+    inline std::to_chars_result to_chars(char* first, char* last, const umeasurement& umeas, const format_spec& spec) noexcept {
+
+        if (umeas.uncertainty() == 0.0)
+            return to_chars(first, last, umeas.as_measurement(), spec);
+
+        const scalar value = umeas.value();
+        const scalar uncertainty = umeas.uncertainty();
+        const int digits = (spec.digits == 0) ? 1 : spec.digits;
+
+        // power of ten of the last significant digit of the uncertainty
+        const int last_digit = leading_digit(uncertainty) - (digits - 1);
+
+        const bool scientific = (spec.notation == 'e') || (spec.notation == '\0' &&
+                                    (std::fabs(value) >= 1e4 || std::fabs(value) <= 1e-4 || uncertainty >= 1e4 || uncertainty <= 1e-4));
+
+        const auto put = [&](std::string_view text) noexcept {
+
+            if (static_cast<std::size_t>(last - first) < text.size())
+                return false;
+            first = std::copy(text.begin(), text.end(), first);
+            return true;
+
+        };
+
+        const auto put_scalar = [&](const scalar& number, const std::chars_format& fmt, const int& precision) noexcept {
+
+            const std::to_chars_result result = std::to_chars(first, last, number, fmt, std::min(precision, std::numeric_limits<scalar>::max_digits10));
+            first = result.ptr;
+            return result.ec == std::errc();
+
+        };
+
+        // exponent of the scientific notation, and precision of the value
+        const int exponent = scientific ? std::max(leading_digit(value), leading_digit(uncertainty)) : 0;
+        const int precision = std::max(0, exponent - last_digit);
+
+        if (spec.parenthesized) {
+
+            // digits of the uncertainty at the precision of the value
+            char digits_buffer[std::numeric_limits<scalar>::max_digits10 + 8];
+            const std::to_chars_result unc = std::to_chars(digits_buffer, digits_buffer + sizeof(digits_buffer),
+                                                           std::round(uncertainty * std::pow(10.0, -last_digit - std::min(0, exponent - last_digit))),
+                                                           std::chars_format::fixed, 0);
+
+            if (!put_scalar(value / std::pow(10.0, exponent), std::chars_format::fixed, precision) ||
+                !put("(") || !put(std::string_view(digits_buffer, unc.ptr)) || !put(")"))
+                return { last, std::errc::value_too_large };
+
+            if (scientific) {
+
+                char exponent_buffer[8];
+                const std::to_chars_result exp = std::to_chars(exponent_buffer, exponent_buffer + sizeof(exponent_buffer), exponent);
+                if (!put("e") || !put(std::string_view(exponent_buffer, exp.ptr)))
+                    return { last, std::errc::value_too_large };
+
+            }
+
+        } else {
+
+            const std::chars_format fmt = scientific ? std::chars_format::scientific : std::chars_format::fixed;
+            const int value_precision = scientific ? std::max(0, leading_digit(value) - last_digit) : precision;
+            const int uncertainty_precision = scientific ? digits - 1 : precision;
+
+            if (!put("(") || !put_scalar(value, fmt, value_precision) ||
+                !put(" ± ") || !put_scalar(uncertainty, fmt, uncertainty_precision) || !put(")"))
+                return { last, std::errc::value_too_large };
+
+        }
+
+        if (!put(" "))
+            return { last, std::errc::value_too_large };
+
+        return to_chars(first, last, umeas.units());
+
+    }
+
+
+} // namespace measurements
+
+
+#ifdef __cpp_lib_format
+
+
+    /// @brief std::formatter of an unit, it accepts only the empty specification
+    template <>
+    struct std::formatter<measurements::unit> {
+
+        constexpr auto parse(std::format_parse_context& ctx) {
+
+            if (ctx.begin() != ctx.end() && *ctx.begin() != '}')
+                throw std::format_error("Invalid format specification for an unit");
+
+            return ctx.begin();
+
+        }
+
+        auto format(const measurements::unit& units, std::format_context& ctx) const {
+
+            char buffer[measurements::unit::max_chars];
+
+            return std::copy(buffer, to_chars(buffer, buffer + measurements::unit::max_chars, units).ptr, ctx.out());
+
+        }
+
+    };
+
+
+    /// @brief std::formatter of a measurement, with the specification [.digits][f|e]
+    template <>
+    struct std::formatter<measurements::measurement> {
+
+        measurements::format_spec spec; ///< parsed format specification
+
+        constexpr auto parse(std::format_parse_context& ctx) {
+
+            const auto it = measurements::parse_format_spec(ctx.begin(), ctx.end(), this->spec);
+            if (it == ctx.begin() && it != ctx.end() && *it != '}')
+                throw std::format_error("Invalid format specification for a measurement");
+
+            return it;
+
+        }
+
+        auto format(const measurements::measurement& meas, std::format_context& ctx) const {
+
+            char buffer[measurements::umeasurement::max_chars];
+            const std::to_chars_result result = to_chars(buffer, buffer + measurements::umeasurement::max_chars, meas, this->spec);
+            if (result.ec != std::errc())
+                throw std::format_error("Cannot format the measurement");
+
+            return std::copy(buffer, result.ptr, ctx.out());
+
+        }
+
+    };
+
+
+    /// @brief std::formatter of an umeasurement, with the specification [.digits][f|e][p]
+    template <>
+    struct std::formatter<measurements::umeasurement> {
+
+        measurements::format_spec spec; ///< parsed format specification
+
+        constexpr auto parse(std::format_parse_context& ctx) {
+
+            const auto it = measurements::parse_format_spec(ctx.begin(), ctx.end(), this->spec);
+            if (it == ctx.begin() && it != ctx.end() && *it != '}')
+                throw std::format_error("Invalid format specification for an umeasurement");
+
+            return it;
+
+        }
+
+        auto format(const measurements::umeasurement& umeas, std::format_context& ctx) const {
+
+            char buffer[measurements::umeasurement::max_chars];
+            const std::to_chars_result result = to_chars(buffer, buffer + measurements::umeasurement::max_chars, umeas, this->spec);
+            if (result.ec != std::errc())
+                throw std::format_error("Cannot format the umeasurement");
+
+            return std::copy(buffer, result.ptr, ctx.out());
+
+        }
+
+    };
+
+
+#endif // __cpp_lib_format
@@ -0,0 +1,376 @@
+/**
+ * @file    instrumentation.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the opt-in counters of the library: unit conversions, unit_base mismatches, throws,
+ *          divisions by zero, parses and formats, and a heatmap of the converted pairs of units
+ * @date    2023-02-05
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    /**
+     * @brief Counters of the hot paths of the library, enabled by defining MEASUREMENTS_INSTRUMENTATION
+     *
+     * @note Every thread increments its own counters and its own heatmap without locking, take_snapshot() merges the counters of all the threads.
+     *       Without MEASUREMENTS_INSTRUMENTATION the hooks are empty and take_snapshot() returns zeros
+     * @note Each thread records at most heatmap_capacity distinct pairs of units, the conversions of the other pairs are counted only in the totals
+     */
+    namespace instrumentation {
+
+
+        #ifdef MEASUREMENTS_INSTRUMENTATION
+            constexpr bool enabled{true};
+        #else
+            constexpr bool enabled{false};
+        #endif
+
+
+        /// @brief Events counted by the instrumentation
+        enum class counter : uint8_t {
+
+            conversion, ///< a value converted between different units, by value_as or convert_to
+
+            unit_mismatch, ///< an operation on different unit_base, thrown or reported by a result
+
+            throws, ///< an exception thrown by the library
+
+            division_by_zero, ///< a division by zero, thrown or reported by a result
+
+            parse, ///< a unit string parsed
+
+            format, ///< a measurement or an umeasurement formatted
+
+            count_ ///< number of counters
+
+        };
+
+
+        constexpr std::size_t counters{static_cast<std::size_t>(counter::count_)}; ///< Number of counters
+
+
+        /// @brief Number of conversions between a pair of units
+        struct conversion_count {
+
+            units::unit from; ///< unit converted from
+
+            units::unit to; ///< unit converted to
+
+            uint64_t count; ///< number of conversions
+
+        };
+
+
+        /// @brief Merged counters of all the threads
+        struct snapshot {
+
+            std::array<uint64_t, counters> totals{}; ///< totals of the counters, indexed by counter
+
+            std::vector<conversion_count> conversions{}; ///< heatmap of the conversions, sorted by decreasing count
+
+
+            /// @brief Get the total of a counter
+            constexpr uint64_t operator[](const counter& c) const noexcept { return this->totals[static_cast<std::size_t>(c)]; }
+
+        };
+
+
+        constexpr std::size_t heatmap_capacity{256}; ///< Number of distinct pairs of units recorded in the heatmap of each thread
+
+
+        #ifdef MEASUREMENTS_INSTRUMENTATION
+
+            namespace detail {
+
+
+                /// @brief Hash of a pair of units
+                struct pair_hash {
+
+                    std::size_t operator()(const std::pair<units::unit, units::unit>& pair) const noexcept {
+
+                        return units::unit_hash()(pair.first) * 0x9e3779b97f4a7c15ULL ^ units::unit_hash()(pair.second);
+
+                    }
+
+                };
+
+
+                using heatmap = std::unordered_map<std::pair<units::unit, units::unit>, uint64_t, pair_hash>;
+
+
+                /**
+                 * @brief Slot of the heatmap of a thread
+                 *
+                 * @note The pair is written once by the owner thread before used is released, then it is never modified,
+                 *       so snapshot can read it after acquiring used without locking
+                 */
+                struct heatmap_slot {
+
+                    std::pair<units::unit, units::unit> pair{}; ///< converted pair of units, valid once used is set
+
+                    std::atomic<uint64_t> count{0}; ///< number of conversions, single writer
+
+                    std::atomic<bool> used{false}; ///< set when the pair is published
+
+                };
+
+
+                /// @brief Counters of a thread, registered in the global list while the thread is alive
+                struct thread_counters {
+
+                    /// @brief Single writer counters: the owner thread stores with relaxed ordering, snapshot loads them
+                    std::array<std::atomic<uint64_t>, counters> totals{};
+
+                    /// @brief Open addressing table of the converted pairs, written only by the owner thread
+                    std::array<heatmap_slot, heatmap_capacity> conversions{};
+
+                    thread_counters();
+
+                    ~thread_counters();
+
+
+                    /// @brief Add the counts of the heatmap to a merged heatmap
+                    void merge(heatmap& merged) const {
+
+                        for (const heatmap_slot& slot : this->conversions)
+                            if (slot.used.load(std::memory_order_acquire))
+                                if (const uint64_t count = slot.count.load(std::memory_order_relaxed); count != 0)
+                                    merged[slot.pair] += count;
+
+                    }
+
+                };
+
+
+                /// @brief Counters of all the threads
+                struct global_counters {
+
+                    std::mutex mutex{}; ///< Lock of the list of threads and of the retired counters, taken by the hooks only when a thread registers
+
+                    std::vector<thread_counters*> threads{};
+
+                    std::array<uint64_t, counters> retired{}; ///< totals of the threads that exited
+
+                    heatmap retired_conversions{};
+
+
+                    static global_counters& get() {
+
+                        static global_counters instance;
+
+                        return instance;
+
+                    }
+
+                };
+
+
+                inline thread_counters::thread_counters() {
+
+                    global_counters& global = global_counters::get();
+                    const std::lock_guard<std::mutex> lock(global.mutex);
+                    global.threads.push_back(this);
+
+                }
+
+
+                inline thread_counters::~thread_counters() {
+
+                    global_counters& global = global_counters::get();
+                    const std::lock_guard<std::mutex> lock(global.mutex);
+                    for (std::size_t i{0}; i < counters; ++i)
+                        global.retired[i] += this->totals[i].load(std::memory_order_relaxed);
+                    this->merge(global.retired_conversions);
+                    global.threads.erase(std::find(global.threads.begin(), global.threads.end(), this));
+
+                }
+
+
+                /// @brief Get the counters of the calling thread
+                inline thread_counters& local() {
+
+                    thread_local thread_counters instance;
+
+                    return instance;
+
+                }
+
+
+                /// @brief Increment a single writer counter of the calling thread
+                inline void add(std::atomic<uint64_t>& counter, const uint64_t& count) noexcept {
+
+                    counter.store(counter.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+
+                }
+
+
+                /**
+                 * @brief Count conversions between a pair of units in the heatmap of the calling thread, without locking
+                 *
+                 * @note A pair that does not fit in a full heatmap is counted only in the total of the conversions
+                 */
+                [[gnu::noinline]] inline void count_conversion(const units::unit& from, const units::unit& to, const uint64_t& count) {
+
+                    thread_counters& local = detail::local();
+                    detail::add(local.totals[static_cast<std::size_t>(counter::conversion)], count);
+
+                    const std::pair<units::unit, units::unit> pair{ from, to };
+                    std::size_t index = pair_hash()(pair) % heatmap_capacity;
+                    for (std::size_t probe{0}; probe < heatmap_capacity; ++probe, index = (index + 1) % heatmap_capacity) {
+
+                        heatmap_slot& slot = local.conversions[index];
+                        if (!slot.used.load(std::memory_order_relaxed)) {
+
+                            slot.pair = pair;
+                            slot.count.store(count, std::memory_order_relaxed);
+                            slot.used.store(true, std::memory_order_release);
+                            return;
+
+                        }
+
+                        if (slot.pair == pair) {
+
+                            detail::add(slot.count, count);
+                            return;
+
+                        }
+
+                    }
+
+                }
+
+
+            } // namespace detail
+
+        #endif
+
+
+        /// @brief Count an event
+        constexpr void count([[maybe_unused]] const counter& c) noexcept {
+
+            #ifdef MEASUREMENTS_INSTRUMENTATION
+                if (!std::is_constant_evaluated()) {
+
+                    detail::add(detail::local().totals[static_cast<std::size_t>(c)], 1);
+
+                }
+            #endif
+
+        }
+
+
+        /**
+         * @brief Count conversions between two different units and record the pair in the heatmap
+         *
+         * @param from: unit converted from
+         * @param to: unit converted to
+         * @param count: number of values converted, as the size of a batch
+         */
+        constexpr void count_conversion([[maybe_unused]] const units::unit& from,
+                                        [[maybe_unused]] const units::unit& to,
+                                        [[maybe_unused]] const uint64_t& count = 1) noexcept {
+
+            #ifdef MEASUREMENTS_INSTRUMENTATION
+                if (!std::is_constant_evaluated()) {
+
+                    try {
+
+                        detail::count_conversion(from, to, count);
+
+                    } catch (...) {}
+
+                }
+            #endif
+
+        }
+
+
+        /// @brief Merge the counters of all the threads, alive or exited
+        inline snapshot take_snapshot() {
+
+            snapshot result;
+
+            #ifdef MEASUREMENTS_INSTRUMENTATION
+
+                detail::global_counters& global = detail::global_counters::get();
+                const std::lock_guard<std::mutex> lock(global.mutex);
+
+                result.totals = global.retired;
+                detail::heatmap conversions = global.retired_conversions;
+                for (detail::thread_counters* thread : global.threads) {
+
+                    for (std::size_t i{0}; i < counters; ++i)
+                        result.totals[i] += thread->totals[i].load(std::memory_order_relaxed);
+
+                    thread->merge(conversions);
+
+                }
+
+                result.conversions.reserve(conversions.size());
+                for (const auto& [pair, count] : conversions)
+                    result.conversions.push_back({ pair.first, pair.second, count });
+                std::sort(result.conversions.begin(), result.conversions.end(),
+                          [](const conversion_count& lhs, const conversion_count& rhs) { return lhs.count > rhs.count; });
+
+            #endif
+
+            return result;
+
+        }
+
+
+        /// @brief Reset the counters of all the threads
+        inline void reset() {
+
+            #ifdef MEASUREMENTS_INSTRUMENTATION
+
+                detail::global_counters& global = detail::global_counters::get();
+                const std::lock_guard<std::mutex> lock(global.mutex);
+
+                global.retired.fill(0);
+                global.retired_conversions.clear();
+                for (detail::thread_counters* thread : global.threads) {
+
+                    for (std::atomic<uint64_t>& total : thread->totals)
+                        total.store(0, std::memory_order_relaxed);
+
+                    // the published pairs stay in their slots, only their counts are cleared
+                    for (detail::heatmap_slot& slot : thread->conversions)
+                        slot.count.store(0, std::memory_order_relaxed);
+
+                }
+
+            #endif
+
+        }
+
+
+        /**
+         * @brief Print a snapshot: the totals of the counters and the most frequent conversions
+         *
+         * @param os: std::ostream&
+         * @param snap: snapshot as l-value const reference
+         * @param rows: maximum number of conversions printed
+         */
+        inline void print(std::ostream& os, const snapshot& snap, const std::size_t& rows = 16) {
+
+            constexpr const char* names[counters] = { "conversions", "unit_mismatches", "throws", "divisions_by_zero", "parses", "formats" };
+            for (std::size_t i{0}; i < counters; ++i)
+                os << names[i] << ": " << snap.totals[i] << '\n';
+
+            for (std::size_t i{0}; i < std::min(rows, snap.conversions.size()); ++i)
+                os << snap.conversions[i].from << " -> " << snap.conversions[i].to << ": " << snap.conversions[i].count << '\n';
+
+        }
+
+
+    } // namespace instrumentation
+
+
+} // namespace measurements
@@ -0,0 +1,338 @@
+/**
+ * @file    mapped_file.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the definition of the mapped_reader class,
+ *          a zero-copy reader of the binary files of the measurements on POSIX systems
+ * @date    2023-01-24
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+#if __has_include(<sys/mman.h>)
+
+
+namespace measurements {
+
+
+    /**
+     * @brief A class for reading a binary file of measurements by mapping it in memory, without copying its columns
+     *
+     * @note The segments are validated once when the file is opened, then they are accessed as measurement_views and umeasurement_views
+     *       pointing directly into the mapping, so that they can be used by the operations of measurement_array and umeasurement_array
+     * @note The views are invalidated when the mapped_reader is destroyed
+     * @note The columns are stored in little-endian order, so the file can be mapped only on little-endian systems
+     * @see binary, binary_reader
+     */
+    class mapped_reader {
+
+
+        public:
+
+        // =============================================
+        // constructors & destructor
+        // =============================================
+
+            /**
+             * @brief Map a binary file in memory and validate its segments
+             *
+             * @param path: path of the file
+             */
+            explicit mapped_reader(const std::string& path) :
+
+                data_(nullptr),
+                size_(0),
+                header_(),
+                segments_() {
+
+                if constexpr (std::endian::native != std::endian::little)
+                    throw std::runtime_error("Cannot map a binary measurements file on a big-endian system");
+
+                const int fd = ::open(path.c_str(), O_RDONLY);
+                if (fd < 0)
+                    throw std::runtime_error("Cannot open the binary measurements file " + path);
+
+                struct stat status;
+                if (::fstat(fd, &status) != 0) {
+
+                    ::close(fd);
+                    throw std::runtime_error("Cannot open the binary measurements file " + path);
+
+                }
+
+                this->size_ = static_cast<std::size_t>(status.st_size);
+                if (this->size_ < binary::header_size) {
+
+                    ::close(fd);
+                    throw std::runtime_error("The binary measurements file is truncated");
+
+                }
+
+                void* data = ::mmap(nullptr, this->size_, PROT_READ, MAP_SHARED, fd, 0);
+                ::close(fd);
+                if (data == MAP_FAILED)
+                    throw std::runtime_error("Cannot map the binary measurements file " + path);
+
+                this->data_ = static_cast<const unsigned char*>(data);
+                ::madvise(data, this->size_, MADV_SEQUENTIAL);
+
+                try {
+
+                    this->header_ = binary::header::decode(this->data_);
+                    this->index();
+
+                } catch (...) {
+
+                    this->unmap();
+                    throw;
+
+                }
+
+            }
+
+
+            mapped_reader(const mapped_reader& other) = delete;
+
+
+            /// @brief Move construct a new mapped_reader object
+            mapped_reader(mapped_reader&& other) noexcept :
+
+                data_(std::exchange(other.data_, nullptr)),
+                size_(std::exchange(other.size_, 0)),
+                header_(std::move(other.header_)),
+                segments_(std::move(other.segments_)) {}
+
+
+            /// @brief Unmap the file
+            ~mapped_reader() { this->unmap(); }
+
+
+        // =============================================
+        // operators
+        // =============================================
+
+            mapped_reader& operator=(const mapped_reader& other) = delete;
+
+
+            /// @brief Move assign another mapped_reader to this mapped_reader
+            mapped_reader& operator=(mapped_reader&& other) noexcept {
+
+                if (this != &other) {
+
+                    this->unmap();
+                    this->data_ = std::exchange(other.data_, nullptr);
+                    this->size_ = std::exchange(other.size_, 0);
+                    this->header_ = std::move(other.header_);
+                    this->segments_ = std::move(other.segments_);
+
+                }
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Get a segment of the file
+             *
+             * @param index: position of the segment
+             *
+             * @return umeasurement_view
+             */
+            umeasurement_view operator[](const std::size_t& index) const {
+
+                return this->segment(index);
+
+            }
+
+
+        // =============================================
+        // get methods
+        // =============================================
+
+            /**
+             * @brief Get a segment of the file with its uncertainties
+             *
+             * @param index: position of the segment
+             *
+             * @return umeasurement_view
+             */
+            umeasurement_view segment(const std::size_t& index) const {
+
+                if (!this->header_.has_uncertainty())
+                    throw std::invalid_argument("Cannot view umeasurements in a binary file without uncertainties");
+
+                return { this->values(index), this->uncertainties(index), this->units(index) };
+
+            }
+
+
+            /**
+             * @brief Get a segment of the file without its uncertainties
+             *
+             * @param index: position of the segment
+             *
+             * @return measurement_view
+             */
+            measurement_view measurement_segment(const std::size_t& index) const {
+
+                return { this->values(index), this->units(index) };
+
+            }
+
+
+            /**
+             * @brief Get the values of a segment of the file
+             *
+             * @param index: position of the segment
+             *
+             * @return std::span<const scalar>
+             */
+            std::span<const scalar> values(const std::size_t& index) const {
+
+                const segment_entry& entry = this->segments_.at(index);
+
+                return { entry.values, entry.count };
+
+            }
+
+
+            /**
+             * @brief Get the uncertainties of a segment of the file
+             *
+             * @param index: position of the segment
+             *
+             * @return std::span<const scalar>, empty if the file has no uncertainties
+             */
+            std::span<const scalar> uncertainties(const std::size_t& index) const {
+
+                const segment_entry& entry = this->segments_.at(index);
+                if (!this->header_.has_uncertainty())
+                    return {};
+
+                return { entry.values + entry.count, entry.count };
+
+            }
+
+
+            /**
+             * @brief Get the units of a segment of the file
+             *
+             * @param index: position of the segment
+             *
+             * @return const unit&
+             */
+            const unit& units(const std::size_t& index) const {
+
+                return this->header_.units[this->segments_.at(index).unit_index];
+
+            }
+
+
+            /// @brief Get the number of segments of the file
+            std::size_t segments() const noexcept { return this->segments_.size(); }
+
+            /// @brief Get the number of records of the file
+            std::size_t size() const noexcept { return this->header_.records; }
+
+            /// @brief Check if the records store an uncertainty
+            bool has_uncertainty() const noexcept { return this->header_.has_uncertainty(); }
+
+            /// @brief Get the header of the file
+            const binary::header& header() const noexcept { return this->header_; }
+
+            /// @brief Get the unit dictionary of the file
+            const std::vector<unit>& units() const noexcept { return this->header_.units; }
+
+
+        private:
+
+        // =============================================
+        // helpers
+        // =============================================
+
+            /// @brief Position of a segment in the mapping
+            struct segment_entry {
+
+                const scalar* values; ///< First value of the segment
+
+                std::size_t count; ///< Number of records of the segment
+
+                uint16_t unit_index; ///< Index of the units of the segment in the unit dictionary
+
+            };
+
+
+            /// @brief Walk the segments of the file and check that they lie in the mapping
+            void index() {
+
+                const std::size_t columns = this->header_.has_uncertainty() ? 2 : 1;
+                std::size_t offset{binary::header_size};
+                uint64_t records{0};
+
+                if (this->header_.segments > (this->size_ - binary::header_size) / binary::segment_header_size)
+                    throw std::runtime_error("The binary measurements file is truncated");
+
+                this->segments_.reserve(this->header_.segments);
+                for (uint64_t i{0}; i < this->header_.segments; ++i) {
+
+                    if (this->size_ - offset < binary::segment_header_size)
+                        throw std::runtime_error("The binary measurements file is truncated");
+
+                    const uint64_t count = binary::load<uint64_t>(this->data_ + offset);
+                    const uint16_t unit_index = binary::load<uint16_t>(this->data_ + offset + 8);
+                    offset += binary::segment_header_size;
+
+                    if (unit_index >= this->header_.units.size())
+                        throw std::runtime_error("Corrupted segment in the binary measurements file");
+
+                    if (count > (this->size_ - offset) / (columns * sizeof(scalar)))
+                        throw std::runtime_error("The binary measurements file is truncated");
+
+                    this->segments_.push_back({ reinterpret_cast<const scalar*>(this->data_ + offset), static_cast<std::size_t>(count), unit_index });
+                    offset += columns * count * sizeof(scalar);
+                    records += count;
+
+                }
+
+                if (records != this->header_.records)
+                    throw std::runtime_error("Corrupted segment in the binary measurements file");
+
+            }
+
+
+            /// @brief Release the mapping
+            void unmap() noexcept {
+
+                if (this->data_ != nullptr)
+                    ::munmap(const_cast<unsigned char*>(this->data_), this->size_);
+
+                this->data_ = nullptr;
+                this->size_ = 0;
+
+            }
+
+
+        // =============================================
+        // class members
+        // =============================================
+
+            const unsigned char* data_; ///< The mapping of the file
+
+            std::size_t size_; ///< Size of the mapping
+
+            binary::header header_; ///< Header with the counts and the unit dictionary
+
+            std::vector<segment_entry> segments_; ///< Positions of the segments
+
+
+    }; // class mapped_reader
+
+
+} // namespace measurements
+
+
+#endif // __has_include(<sys/mman.h>)
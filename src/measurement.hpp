@@ -19,11 +19,22 @@ namespace measurements {
     using namespace units::SI;
 
 
+    template <typename T>
+    class basic_umeasurement;
+
+
     /** 
      * @brief A class for representing a physical quantity with a numerical value and an unit
+     * 
+     * @tparam T: type of the value, as float, double or long double
+     * 
+     * @note The conversion factors of the units are computed as scalar and then rounded to T
+     * @note A float value does not make a measurement smaller: the unit takes 24 bytes, so basic_measurement<float> takes 32 bytes as
+     *       basic_measurement<double>. A stream of float values sharing an unit should be stored in a float_measurement_array
      * @see units::unit  
      */
-    class measurement {
+    template <typename T>
+    class basic_measurement {
 
 
         public:
@@ -37,7 +48,7 @@ namespace measurements {
              * 
              * @note The default value is 0 and the default unit is unitless
              */
-            constexpr measurement() noexcept : 
+            constexpr basic_measurement() noexcept : 
                                             
                 value_{0.0}, 
                 units_() {} 
@@ -51,8 +62,8 @@ namespace measurements {
              *
              * @note If the unit is not specified, the unit is set to unitless
              */
-            constexpr measurement(const scalar& value, 
-                                  const unit& units = unit()) noexcept : 
+            constexpr basic_measurement(const T& value, 
+                                        const unit& units = unit()) noexcept : 
                                             
                 value_{value}, 
                 units_(units) {}
@@ -67,8 +78,8 @@ namespace measurements {
              * 
              * @note If the unit is not specified, the unit is set to unitless
              */
-            constexpr measurement(scalar&& value,
-                                  unit&& units = unit()) noexcept : 
+            constexpr basic_measurement(T&& value,
+                                        unit&& units = unit()) noexcept : 
                                             
                 value_{value}, 
                 units_(units) {}
@@ -79,7 +90,7 @@ namespace measurements {
              * 
              * @param other: measurement as l-value const reference
              */
-            constexpr measurement(const measurement& other) noexcept : 
+            constexpr basic_measurement(const basic_measurement& other) noexcept : 
             
                 value_{other.value_}, 
                 units_(other.units_) {}
@@ -90,14 +101,14 @@ namespace measurements {
              * 
              * @param other: measurement as r-value reference
              */
-            constexpr measurement(measurement&& other) noexcept :
+            constexpr basic_measurement(basic_measurement&& other) noexcept :
                 
                 value_{std::move(other.value_)}, 
                 units_(std::move(other.units_)) {}
 
 
             /// @brief Destruct the measurement object
-            ~measurement() = default;
+            ~basic_measurement() = default;
 
 
         // =============================================                                                                                         
@@ -111,7 +122,7 @@ namespace measurements {
              * 
              * @return measurement& 
              */
-            constexpr measurement& operator=(const measurement& other) noexcept {
+            constexpr basic_measurement& operator=(const basic_measurement& other) noexcept {
 
                 this->value_ = other.value_;
                 this->units_ = other.units_;
@@ -128,7 +139,7 @@ namespace measurements {
              * 
              * @return measurement& 
              */
-            constexpr measurement& operator=(measurement&& other) noexcept {
+            constexpr basic_measurement& operator=(basic_measurement&& other) noexcept {
 
                 this->value_ = std::move(other.value_);
                 this->units_ = std::move(other.units_);
@@ -145,10 +156,10 @@ namespace measurements {
              * 
              * @return measurement& 
              */
-            constexpr measurement& operator+=(const measurement& other) { 
+            constexpr basic_measurement& operator+=(const basic_measurement& other) { 
                 
                 if (this->units_.base_ != other.units_.base_) 
-                    throw std::invalid_argument("Cannot add measurements with different unit_base");
+                    throw_invalid_argument("Cannot add measurements with different unit_base", measurement_errc::unit_mismatch);
                 
                 if (this->units_ != unitless) 
                     this->value_ += other.value_as(this->units_); 
@@ -172,10 +183,10 @@ namespace measurements {
              * 
              * @return measurement& 
              */
-            constexpr measurement& operator+=(measurement&& other) { 
+            constexpr basic_measurement& operator+=(basic_measurement&& other) { 
 
                 if (this->units_.base_ != other.units_.base_) 
-                    throw std::invalid_argument("Cannot add measurements with different unit_base");
+                    throw_invalid_argument("Cannot add measurements with different unit_base", measurement_errc::unit_mismatch);
                 
                 if (this->units_ != unitless) 
                     this->value_ += std::move(other.value_as(this->units_));   
@@ -199,10 +210,10 @@ namespace measurements {
              * 
              * @return measurement& 
              */
-            constexpr measurement& operator-=(const measurement& other) { 
+            constexpr basic_measurement& operator-=(const basic_measurement& other) { 
 
                 if (this->units_.base_ != other.units_.base_) 
-                    throw std::invalid_argument("Cannot subtract measurements with different unit_base");
+                    throw_invalid_argument("Cannot subtract measurements with different unit_base", measurement_errc::unit_mismatch);
                 
                 if (this->units_ != unitless) 
                     this->value_ -= other.value_as(this->units_);   
@@ -226,10 +237,10 @@ namespace measurements {
              * 
              * @return measurement& 
              */
-            constexpr measurement& operator-=(measurement&& other) { 
+            constexpr basic_measurement& operator-=(basic_measurement&& other) { 
 
                 if (this->units_.base_ != other.units_.base_) 
-                    throw std::invalid_argument("Cannot subtract measurements with different unit_base");
+                    throw_invalid_argument("Cannot subtract measurements with different unit_base", measurement_errc::unit_mismatch);
                 
                 if (this->units_ != unitless)
                     this->value_ -= std::move(other.value_as(this->units_));
@@ -253,7 +264,7 @@ namespace measurements {
              * 
              * @return measurement& 
              */
-            constexpr measurement& operator*=(const measurement& other) noexcept { 
+            constexpr basic_measurement& operator*=(const basic_measurement& other) noexcept { 
 
                 this->value_ *= other.value_;
                 this->units_ *= other.units_;    
@@ -270,7 +281,7 @@ namespace measurements {
              * 
              * @return measurement& 
              */
-            constexpr measurement& operator*=(measurement&& meas) noexcept { 
+            constexpr basic_measurement& operator*=(basic_measurement&& meas) noexcept { 
 
                 this->value_ *= std::move(meas.value_);
                 this->units_ *= std::move(meas.units_);   
@@ -287,10 +298,10 @@ namespace measurements {
              * 
              * @return measurement& 
              */
-            constexpr measurement& operator/=(const measurement& other) { 
+            constexpr basic_measurement& operator/=(const basic_measurement& other) { 
 
                 if (other.value_ == 0.0)
-                    throw std::runtime_error("Cannot divide a measurement by a zero measurement");
+                    throw_runtime_error("Cannot divide a measurement by a zero measurement", measurement_errc::division_by_zero);
                 
                 this->value_ /= other.value_;
                 this->units_ /= other.units_;                                    
@@ -307,10 +318,10 @@ namespace measurements {
              * 
              * @return measurement& 
              */
-            constexpr measurement& operator/=(measurement&& other) { 
+            constexpr basic_measurement& operator/=(basic_measurement&& other) { 
                 
                 if (other.value_ == 0.0) 
-                    throw std::runtime_error("Cannot divide a measurement by a zero measurement");
+                    throw_runtime_error("Cannot divide a measurement by a zero measurement", measurement_errc::division_by_zero);
                 
                 this->value_ /= std::move(other.value_);
                 this->units_ /= std::move(other.units_);                                    
@@ -327,7 +338,7 @@ namespace measurements {
              * 
              * @return constexpr measurement& 
              */
-            constexpr measurement& operator*=(const scalar& scal) noexcept { 
+            constexpr basic_measurement& operator*=(const T& scal) noexcept { 
 
                 this->value_ *= scal;    
 
@@ -343,7 +354,7 @@ namespace measurements {
              * 
              * @return constexpr measurement& 
              */
-            constexpr measurement& operator*=(scalar&& scal) noexcept { 
+            constexpr basic_measurement& operator*=(T&& scal) noexcept { 
 
                 this->value_ *= scal;    
 
@@ -359,10 +370,10 @@ namespace measurements {
              * 
              * @return constexpr measurement& 
              */
-            constexpr measurement& operator/=(const scalar& scal) { 
+            constexpr basic_measurement& operator/=(const T& scal) { 
                 
                 if (scal == 0.0) 
-                    throw std::runtime_error("Cannot divide a measurement by 0");
+                    throw_runtime_error("Cannot divide a measurement by 0", measurement_errc::division_by_zero);
                 
                 this->value_ /= scal;                    
                 
@@ -378,10 +389,10 @@ namespace measurements {
              * 
              * @return constexpr measurement& 
              */
-            constexpr measurement& operator/=(scalar&& scal) { 
+            constexpr basic_measurement& operator/=(T&& scal) { 
                 
                 if (scal == 0.0) 
-                    throw std::runtime_error("Cannot divide a measurement by 0");
+                    throw_runtime_error("Cannot divide a measurement by 0", measurement_errc::division_by_zero);
                 
                 this->value_ /= scal;                    
                 
@@ -397,12 +408,12 @@ namespace measurements {
              * 
              * @return measurement 
              */
-            constexpr measurement operator+(const measurement& other) const { 
+            constexpr basic_measurement operator+(const basic_measurement& other) const { 
                 
                 if (this->units_.base_ != other.units_.base_) 
-                    throw std::invalid_argument("Cannot sum measurements with different unit_base");
+                    throw_invalid_argument("Cannot sum measurements with different unit_base", measurement_errc::unit_mismatch);
                 
-                return { this->value_ + other.value_as(this->units_), this->units_ }; 
+                return basic_measurement(this->value_ + other.value_as(this->units_), this->units_);
             
             }
 
@@ -414,12 +425,12 @@ namespace measurements {
              * 
              * @return measurement 
              */
-            constexpr measurement operator+(measurement&& other) const { 
+            constexpr basic_measurement operator+(basic_measurement&& other) const { 
                 
                 if (this->units_.base_ != other.units_.base_) 
-                    throw std::invalid_argument("Cannot sum measurements with different unit_base");
+                    throw_invalid_argument("Cannot sum measurements with different unit_base", measurement_errc::unit_mismatch);
                 
-                return { this->value_ + other.value_as(this->units_), this->units_ }; 
+                return basic_measurement(this->value_ + other.value_as(this->units_), this->units_);
             
             }
 
@@ -431,12 +442,12 @@ namespace measurements {
              *  
              * @return constexpr measurement 
              */
-            constexpr measurement operator-(const measurement& other) const { 
+            constexpr basic_measurement operator-(const basic_measurement& other) const { 
 
                 if (this->units_.base_ != other.units_.base_) 
-                    throw std::invalid_argument("Cannot subtract measurements with different unit_base");
+                    throw_invalid_argument("Cannot subtract measurements with different unit_base", measurement_errc::unit_mismatch);
                 
-                return { this->value_ - other.value_as(this->units_), this->units_ }; 
+                return basic_measurement(this->value_ - other.value_as(this->units_), this->units_);
             
             }
 
@@ -448,12 +459,12 @@ namespace measurements {
              *  
              * @return constexpr measurement 
              */
-            constexpr measurement operator-(measurement&& other) const { 
+            constexpr basic_measurement operator-(basic_measurement&& other) const { 
 
                 if (this->units_.base_ != other.units_.base_) 
-                    throw std::invalid_argument("Cannot subtract measurements with different unit_base");
+                    throw_invalid_argument("Cannot subtract measurements with different unit_base", measurement_errc::unit_mismatch);
                 
-                return { this->value_ - other.value_as(this->units_), this->units_ }; 
+                return basic_measurement(this->value_ - other.value_as(this->units_), this->units_);
             
             }
             
@@ -465,9 +476,9 @@ namespace measurements {
              * 
              * @return constexpr measurement 
              */
-            constexpr measurement operator*(const measurement& other) const noexcept { 
+            constexpr basic_measurement operator*(const basic_measurement& other) const noexcept { 
                 
-                return { this->value_ * other.value_, this->units_ * other.units_ }; 
+                return basic_measurement(this->value_ * other.value_, this->units_ * other.units_);
             
             }
 
@@ -479,9 +490,9 @@ namespace measurements {
              * 
              * @return constexpr measurement 
              */
-            constexpr measurement operator*(measurement&& other) const noexcept { 
+            constexpr basic_measurement operator*(basic_measurement&& other) const noexcept { 
                 
-                return { this->value_ * other.value_, this->units_ * other.units_ }; 
+                return basic_measurement(this->value_ * other.value_, this->units_ * other.units_);
             
             }
 
@@ -493,12 +504,12 @@ namespace measurements {
              * 
              * @return constexpr measurement 
              */
-            constexpr measurement operator/(const measurement& other) const { 
+            constexpr basic_measurement operator/(const basic_measurement& other) const { 
                 
                 if (other.value_ == 0.0) 
-                    throw std::runtime_error("Cannot divide a measurement by a zero measurement");
+                    throw_runtime_error("Cannot divide a measurement by a zero measurement", measurement_errc::division_by_zero);
                 
-                return { this->value_ / other.value_, this->units_ / other.units_ }; 
+                return basic_measurement(this->value_ / other.value_, this->units_ / other.units_);
             
             }
 
@@ -510,12 +521,12 @@ namespace measurements {
              * 
              * @return constexpr measurement 
              */
-            constexpr measurement operator/(measurement&& other) const { 
+            constexpr basic_measurement operator/(basic_measurement&& other) const { 
                 
                 if (other.value_ == 0.0) 
-                    throw std::runtime_error("Cannot divide a measurement by a zero measurement");
+                    throw_runtime_error("Cannot divide a measurement by a zero measurement", measurement_errc::division_by_zero);
                 
-                return { this->value_ / other.value_, this->units_ / other.units_ }; 
+                return basic_measurement(this->value_ / other.value_, this->units_ / other.units_);
             
             }
 
@@ -527,9 +538,9 @@ namespace measurements {
              * 
              * @return constexpr measurement 
              */
-            constexpr measurement operator*(const scalar& scal) const noexcept { 
+            constexpr basic_measurement operator*(const T& scal) const noexcept { 
                 
-                return { this->value_ * scal, this->units_ }; 
+                return basic_measurement(this->value_ * scal, this->units_);
                 
             }
             
@@ -541,9 +552,9 @@ namespace measurements {
              * 
              * @return constexpr measurement 
              */
-            constexpr measurement operator*(scalar&& scal) const noexcept { 
+            constexpr basic_measurement operator*(T&& scal) const noexcept { 
                 
-                return { this->value_ * scal, this->units_ }; 
+                return basic_measurement(this->value_ * scal, this->units_);
                 
             }
 
@@ -555,12 +566,12 @@ namespace measurements {
              * 
              * @return constexpr measurement 
              */
-            constexpr measurement operator/(const scalar& scal) const { 
+            constexpr basic_measurement operator/(const T& scal) const { 
                 
                 if (this->value_ == 0.0) 
-                    throw std::runtime_error("Cannot divide a measurement by 0");
+                    throw_runtime_error("Cannot divide a measurement by 0", measurement_errc::division_by_zero);
                 
-                return { this->value_ / scal, this->units_ }; 
+                return basic_measurement(this->value_ / scal, this->units_);
                 
             } 
 
@@ -572,12 +583,12 @@ namespace measurements {
              * 
              * @return constexpr measurement 
              */
-            constexpr measurement operator/(scalar&& scal) const { 
+            constexpr basic_measurement operator/(T&& scal) const { 
                 
                 if (this->value_ == 0.0) 
-                    throw std::runtime_error("Cannot divide a measurement by 0");
+                    throw_runtime_error("Cannot divide a measurement by 0", measurement_errc::division_by_zero);
                 
-                return { this->value_ / scal, this->units_ }; 
+                return basic_measurement(this->value_ / scal, this->units_);
                 
             } 
 
@@ -590,10 +601,10 @@ namespace measurements {
              * 
              * @return constexpr measurement 
              */
-            friend constexpr measurement operator*(const scalar& scal, 
-                                                   const measurement& meas) noexcept { 
+            friend constexpr basic_measurement operator*(const T& scal, 
+                                                         const basic_measurement& meas) noexcept { 
                                                 
-                return { scal * meas.value_, meas.units_ }; 
+                return basic_measurement(scal * meas.value_, meas.units_);
                 
             }
             
@@ -606,10 +617,10 @@ namespace measurements {
              * 
              * @return constexpr measurement 
              */
-            friend constexpr measurement operator*(scalar&& scal, 
-                                                   measurement&& meas) noexcept { 
+            friend constexpr basic_measurement operator*(T&& scal, 
+                                                         basic_measurement&& meas) noexcept { 
                                                 
-                return { scal * meas.value_, meas.units_ }; 
+                return basic_measurement(scal * meas.value_, meas.units_);
                 
             }
 
@@ -622,13 +633,13 @@ namespace measurements {
              * 
              * @return constexpr measurement 
              */
-            friend constexpr measurement operator/(const scalar& scal, 
-                                                   const measurement& meas) { 
+            friend constexpr basic_measurement operator/(const T& scal, 
+                                                         const basic_measurement& meas) { 
 
                 if (meas.value_ == 0.0) 
-                    throw std::runtime_error("Cannot divide a scalar by a zero measurement");          
+                    throw_runtime_error("Cannot divide a scalar by a zero measurement", measurement_errc::division_by_zero);          
                 
-                return { scal / meas.value_, meas.units_.inv() }; 
+                return basic_measurement(scal / meas.value_, meas.units_.inv());
                 
             }
 
@@ -641,13 +652,13 @@ namespace measurements {
              * 
              * @return constexpr measurement 
              */
-            friend constexpr measurement operator/(scalar&& scal, 
-                                                   measurement&& meas) { 
+            friend constexpr basic_measurement operator/(T&& scal, 
+                                                         basic_measurement&& meas) { 
 
                 if (meas.value_ == 0.0) 
-                    throw std::runtime_error("Cannot divide a scalar by a zero measurement");          
+                    throw_runtime_error("Cannot divide a scalar by a zero measurement", measurement_errc::division_by_zero);          
                 
-                return { scal / meas.value_, meas.units_.inv() }; 
+                return basic_measurement(scal / meas.value_, meas.units_.inv());
                 
             }
 
@@ -657,9 +668,9 @@ namespace measurements {
              * 
              * @return constexpr measurement 
              */
-            constexpr measurement operator-() const noexcept { 
+            constexpr basic_measurement operator-() const noexcept { 
                 
-                return { -this->value_, this->units_ }; 
+                return basic_measurement(-this->value_, this->units_);
             
             }
 
@@ -669,7 +680,7 @@ namespace measurements {
              * 
              * @param other: measurement to compare as l-value const reference
              */
-            constexpr bool operator==(const measurement& other) const noexcept { 
+            constexpr bool operator==(const basic_measurement& other) const noexcept { 
                 
                 return this->value_ == other.value_as(this->units_); 
                 
@@ -681,7 +692,7 @@ namespace measurements {
              * 
              * @param other: measurement to compare as l-value const reference
              */
-            constexpr bool operator!=(const measurement& other) const noexcept { 
+            constexpr bool operator!=(const basic_measurement& other) const noexcept { 
                 
                 return this->value_ != other.value_as(this->units_); 
                 
@@ -693,7 +704,7 @@ namespace measurements {
              * 
              * @param other: measurement to compare as l-value const reference
              */
-            constexpr bool operator>(const measurement& other) const noexcept { 
+            constexpr bool operator>(const basic_measurement& other) const noexcept { 
                 
                 return this->value_ > other.value_as(this->units_); 
                 
@@ -705,7 +716,7 @@ namespace measurements {
              * 
              * @param other: measurement to compare as l-value const reference
              */
-            constexpr bool operator<(const measurement& other) const noexcept { 
+            constexpr bool operator<(const basic_measurement& other) const noexcept { 
                 
                 return this->value_ < other.value_as(this->units_); 
                 
@@ -717,7 +728,7 @@ namespace measurements {
              * 
              * @param other: measurement to compare as l-value const reference
              */
-            constexpr bool operator>=(const measurement& other) const noexcept { 
+            constexpr bool operator>=(const basic_measurement& other) const noexcept { 
                 
                 return this->value_ > other.value_as(this->units_) ? true : this->value_ == other.value_as(this->units_);
                 
@@ -729,7 +740,7 @@ namespace measurements {
              * 
              * @param other: measurement to compare as l-value const reference 
              */
-            constexpr bool operator<=(const measurement& other) const noexcept { 
+            constexpr bool operator<=(const basic_measurement& other) const noexcept { 
                 
                 return this->value_ < other.value_as(this->units_) ? true : this->value_ == other.value_as(this->units_);
                 
@@ -741,7 +752,7 @@ namespace measurements {
              * 
              * @param scal: scalar as l-value const reference
              */
-            constexpr bool operator==(const scalar& scal) const noexcept { 
+            constexpr bool operator==(const T& scal) const noexcept { 
                 
                 return this->value_ == scal; 
                 
@@ -753,7 +764,7 @@ namespace measurements {
              * 
              * @param scal: scalar as l-value const reference
              */
-            constexpr bool operator!=(const scalar& scal) const noexcept { 
+            constexpr bool operator!=(const T& scal) const noexcept { 
                 
                 return this->value_ != scal; 
                 
@@ -765,7 +776,7 @@ namespace measurements {
              * 
              * @param scal: scalar as l-value const reference 
              */
-            constexpr bool operator>(const scalar& scal) const noexcept { 
+            constexpr bool operator>(const T& scal) const noexcept { 
                 
                 return this->value_ > scal; 
                 
@@ -777,7 +788,7 @@ namespace measurements {
              * 
              * @param scal: scalar as l-value const reference 
              */
-            constexpr bool operator<(const scalar& scal) const noexcept { 
+            constexpr bool operator<(const T& scal) const noexcept { 
                 
                 return this->value_ < scal; 
                 
@@ -789,7 +800,7 @@ namespace measurements {
              * 
              * @param scal: scalar as l-value const reference 
              */
-            constexpr bool operator>=(const scalar& scal) const noexcept { 
+            constexpr bool operator>=(const T& scal) const noexcept { 
                 
                 return this->value_ >= scal; 
                 
@@ -801,7 +812,7 @@ namespace measurements {
              * 
              * @param scal: scalar as l-value const reference 
              */
-            constexpr bool operator<=(const scalar& scal) const noexcept { 
+            constexpr bool operator<=(const T& scal) const noexcept { 
                 
                 return this->value_ <= scal; 
                 
@@ -818,8 +829,9 @@ namespace measurements {
              *  
              */
             friend std::ostream& operator<<(std::ostream& os, 
-                                            const measurement& meas) noexcept { 
+                                            const basic_measurement& meas) noexcept { 
                 
+                instrumentation::count(instrumentation::counter::format);
                 os << meas.value_ << " " << meas.units_; 
                 return os; 
                 
@@ -836,25 +848,73 @@ namespace measurements {
              *  
              */
             friend std::ofstream& operator<<(std::ofstream& file,   
-                                             const measurement& meas) noexcept { 
+                                             const basic_measurement& meas) noexcept { 
                 
+                instrumentation::count(instrumentation::counter::format);
                 file << meas.value_ << " " << meas.units_; 
                 return file; 
                 
             }
 
 
+            /**
+             * @brief Write the measurement in a buffer as "value unit", without allocating
+             * 
+             * @param first: begin of the buffer
+             * @param last: end of the buffer
+             * @param meas: measurement as l-value const reference
+             * 
+             * @return std::to_chars_result
+             * 
+             * @note The value is written in the shortest representation that reads back to the same scalar
+             */
+            friend std::to_chars_result to_chars(char* first, char* last, const basic_measurement& meas) noexcept { 
+
+                instrumentation::count(instrumentation::counter::format);
+                const std::to_chars_result result = std::to_chars(first, last, meas.value_);
+                
+                return basic_measurement::append_units(result, last, meas.units_);
+                
+            }
+
+
+            /**
+             * @brief Write the measurement in a buffer as "value unit", without allocating
+             * 
+             * @param first: begin of the buffer
+             * @param last: end of the buffer
+             * @param meas: measurement as l-value const reference
+             * @param fmt: floating-point format of the value
+             * @param precision: precision of the value, as for std::to_chars
+             * 
+             * @return std::to_chars_result
+             */
+            friend std::to_chars_result to_chars(char* first, char* last, const basic_measurement& meas, 
+                                                 const std::chars_format& fmt, const int& precision) noexcept { 
+
+                instrumentation::count(instrumentation::counter::format);
+                const std::to_chars_result result = std::to_chars(first, last, meas.value_, fmt, precision);
+                
+                return basic_measurement::append_units(result, last, meas.units_);
+                
+            }
+
+
             /**
              * @brief Input operator for a measurement
              * 
              * @param is: std::istream&
              */
             friend std::istream& operator>>(std::istream& is, 
-                                            measurement& meas) noexcept { 
+                                            basic_measurement& meas) noexcept { 
                 
                 std::string unit_string; 
                 is >> meas.value_ >> unit_string;
-                meas.units_ = unit(unit_string);
+                const parse_unit_result result = parse_unit(unit_string);
+                if (result.ec != std::errc() || result.ptr != unit_string.data() + unit_string.size()) 
+                    is.setstate(std::ios_base::failbit);
+                else 
+                    meas.units_ = result.units;
 
                 return is;
 
@@ -872,12 +932,12 @@ namespace measurements {
              * 
              * @note Cannot invert a measurement with a zero value
              */
-            constexpr measurement inv() const { 
+            constexpr basic_measurement inv() const { 
                 
                 if (this->value_ == 0) 
-                    throw std::runtime_error("Cannot invert a measurement with a zero value");
+                    throw_runtime_error("Cannot invert a measurement with a zero value", measurement_errc::division_by_zero);
                     
-                return { 1 / this->value_, this->units_.inv() }; 
+                return basic_measurement(1 / this->value_, this->units_.inv());
             
             }
             
@@ -888,7 +948,7 @@ namespace measurements {
              * @param meas: measurement as l-value const reference
              * @return constexpr measurement
              */
-            friend constexpr measurement abs(const measurement& meas) noexcept { 
+            friend constexpr basic_measurement abs(const basic_measurement& meas) noexcept { 
                 
                 return (meas.value_ < 0.0) ? -meas : meas; 
             
@@ -903,10 +963,10 @@ namespace measurements {
              * 
              * @return measurement 
              */
-            friend inline measurement pow(const measurement& meas, 
-                                          const int& power) noexcept { 
+            friend inline basic_measurement pow(const basic_measurement& meas, 
+                                                const int& power) noexcept { 
                 
-                return { std::pow(meas.value_, power), meas.units_.pow(power) }; 
+                return basic_measurement(std::pow(meas.value_, power), meas.units_.pow(power));
             
             }
 
@@ -919,10 +979,10 @@ namespace measurements {
              * 
              * @return measurement 
              */
-            friend inline measurement root(const measurement& meas, 
-                                           const int& power) { 
+            friend inline basic_measurement root(const basic_measurement& meas, 
+                                                 const int& power) { 
                 
-                return { std::pow(meas.value_, 1.0 / power), meas.units_.root(power) }; 
+                return basic_measurement(std::pow(meas.value_, 1.0 / power), meas.units_.root(power));
             
             }
 
@@ -934,9 +994,9 @@ namespace measurements {
              * 
              * @return constexpr measurement 
              */
-            friend constexpr measurement square(const measurement& meas) noexcept { 
+            friend constexpr basic_measurement square(const basic_measurement& meas) noexcept { 
                 
-                return measurement(std::pow(meas.value_, 2), meas.units_.square()); 
+                return basic_measurement(std::pow(meas.value_, 2), meas.units_.square()); 
             
             }
 
@@ -948,9 +1008,9 @@ namespace measurements {
              * 
              * @return constexpr measurement 
              */
-            friend constexpr measurement cube(const measurement& meas) noexcept { 
+            friend constexpr basic_measurement cube(const basic_measurement& meas) noexcept { 
                 
-                return measurement(std::pow(meas.value_, 3), meas.units_.cube()); 
+                return basic_measurement(std::pow(meas.value_, 3), meas.units_.cube()); 
             
             }
 
@@ -962,12 +1022,12 @@ namespace measurements {
              * 
              * @return measurement
              */
-            friend inline measurement sqrt(const measurement& meas) { 
+            friend inline basic_measurement sqrt(const basic_measurement& meas) { 
                 
                 if (meas.value_ < 0.0) 
-                    throw std::runtime_error("Cannot take the square root of a negative measurement");
+                    throw_runtime_error("Cannot take the square root of a negative measurement");
                 
-                return measurement(std::sqrt(meas.value_), meas.units_.sqrt()); 
+                return basic_measurement(std::sqrt(meas.value_), meas.units_.sqrt()); 
             
             }
 
@@ -979,9 +1039,9 @@ namespace measurements {
              * 
              * @return measurement
              */
-            friend inline measurement cbrt(const measurement& meas) { 
+            friend inline basic_measurement cbrt(const basic_measurement& meas) { 
                 
-                return measurement(std::cbrt(meas.value_), meas.units_.cbrt()); 
+                return basic_measurement(std::cbrt(meas.value_), meas.units_.cbrt()); 
             
             }
 
@@ -994,12 +1054,12 @@ namespace measurements {
              * 
              * @return constexpr measurement
              */
-            friend constexpr measurement exp(const measurement& meas) { 
+            friend constexpr basic_measurement exp(const basic_measurement& meas) { 
                 
                 if (meas.units_ != unitless) 
-                    throw std::runtime_error("Cannot take the exponential of a measurement that is not unitless"); 
+                    throw_runtime_error("Cannot take the exponential of a measurement that is not unitless"); 
                 
-                return measurement(std::exp(meas.value_), unitless); 
+                return basic_measurement(std::exp(meas.value_), unitless); 
             
             }
 
@@ -1012,12 +1072,12 @@ namespace measurements {
              * 
              * @return constexpr measurement
              */
-            friend constexpr measurement log(const measurement& meas) { 
+            friend constexpr basic_measurement log(const basic_measurement& meas) { 
                 
                 if (meas.units_ != unitless) 
-                    throw std::runtime_error("Cannot take the logarithm of a measurement that is not unitless"); 
+                    throw_runtime_error("Cannot take the logarithm of a measurement that is not unitless"); 
                 
-                return measurement(std::log(meas.value_), unitless); 
+                return basic_measurement(std::log(meas.value_), unitless); 
             
             }
             
@@ -1029,12 +1089,12 @@ namespace measurements {
              * 
              * @return constexpr measurement
              */
-            friend constexpr measurement exp10(const measurement& meas) { 
+            friend constexpr basic_measurement exp10(const basic_measurement& meas) { 
                 
                 if (meas.units_ != unitless) 
-                    throw std::runtime_error("Cannot take the exponential of a measurement that is not unitless"); 
+                    throw_runtime_error("Cannot take the exponential of a measurement that is not unitless"); 
                 
-                return measurement(std::pow(10, meas.value_), unitless); 
+                return basic_measurement(std::pow(10, meas.value_), unitless); 
             
             }
 
@@ -1046,12 +1106,12 @@ namespace measurements {
              * 
              * @return constexpr measurement
              */
-            friend constexpr measurement log10(const measurement& meas) { 
+            friend constexpr basic_measurement log10(const basic_measurement& meas) { 
                 
                 if (meas.units_ != unitless) 
-                    throw std::runtime_error("Cannot take the logarithm of a measurement that is not unitless"); 
+                    throw_runtime_error("Cannot take the logarithm of a measurement that is not unitless"); 
                 
-                return measurement(std::log10(meas.value_), unitless); 
+                return basic_measurement(std::log10(meas.value_), unitless); 
             
             }
 
@@ -1063,12 +1123,12 @@ namespace measurements {
              * 
              * @return constexpr measurement
              */
-            friend constexpr measurement sin(const measurement& meas) { 
+            friend constexpr basic_measurement sin(const basic_measurement& meas) { 
                 
                 if (meas.units_ != rad) 
-                    throw std::runtime_error("Cannot take the sine of a measurement that is not in radians"); 
+                    throw_runtime_error("Cannot take the sine of a measurement that is not in radians"); 
                 
-                return measurement(std::sin(meas.value_), unitless); 
+                return basic_measurement(std::sin(meas.value_), unitless); 
             
             }
 
@@ -1080,12 +1140,12 @@ namespace measurements {
                 * 
                 * @return constexpr measurement
                 */
-            friend constexpr measurement cos(const measurement& meas) { 
+            friend constexpr basic_measurement cos(const basic_measurement& meas) { 
                 
                 if (meas.units_ != rad) 
-                    throw std::runtime_error("Cannot take the cosine of a measurement that is not in radians"); 
+                    throw_runtime_error("Cannot take the cosine of a measurement that is not in radians"); 
                 
-                return measurement(std::cos(meas.value_), unitless); 
+                return basic_measurement(std::cos(meas.value_), unitless); 
             
             }
 
@@ -1097,12 +1157,12 @@ namespace measurements {
                 * 
                 * @return constexpr measurement
                 */
-            friend constexpr measurement tan(const measurement& meas) { 
+            friend constexpr basic_measurement tan(const basic_measurement& meas) { 
                 
                 if (meas.units_ != rad) 
-                    throw std::runtime_error("Cannot take the tangent of a measurement that is not in radians"); 
+                    throw_runtime_error("Cannot take the tangent of a measurement that is not in radians"); 
                 
-                return measurement(std::tan(meas.value_), unitless);
+                return basic_measurement(std::tan(meas.value_), unitless);
 
             }
 
@@ -1114,12 +1174,12 @@ namespace measurements {
                 * 
                 * @return constexpr measurement
                 */
-            friend constexpr measurement asin(const measurement& meas) { 
+            friend constexpr basic_measurement asin(const basic_measurement& meas) { 
                 
                 if (meas.units_ != unitless) 
-                    throw std::runtime_error("Cannot take the arcsine of a measurement that is not unitless"); 
+                    throw_runtime_error("Cannot take the arcsine of a measurement that is not unitless"); 
                 
-                return measurement(std::asin(meas.value_), rad);
+                return basic_measurement(std::asin(meas.value_), rad);
 
             }
 
@@ -1131,12 +1191,12 @@ namespace measurements {
                 * 
                 * @return constexpr measurement
                 */
-            friend constexpr measurement acos(const measurement& meas) { 
+            friend constexpr basic_measurement acos(const basic_measurement& meas) { 
                 
                 if (meas.units_ != unitless) 
-                    throw std::runtime_error("Cannot take the arccosine of a measurement that is not unitless"); 
+                    throw_runtime_error("Cannot take the arccosine of a measurement that is not unitless"); 
                 
-                return measurement(std::acos(meas.value_), rad);
+                return basic_measurement(std::acos(meas.value_), rad);
 
             }
 
@@ -1148,12 +1208,12 @@ namespace measurements {
                 * 
                 * @return constexpr measurement
                 */
-            friend constexpr measurement atan(const measurement& meas) { 
+            friend constexpr basic_measurement atan(const basic_measurement& meas) { 
                 
                 if (meas.units_ != unitless) 
-                    throw std::runtime_error("Cannot take the arctangent of a measurement that is not unitless"); 
+                    throw_runtime_error("Cannot take the arctangent of a measurement that is not unitless"); 
                 
-                return measurement(std::atan(meas.value_), rad);
+                return basic_measurement(std::atan(meas.value_), rad);
 
             }
 
@@ -1165,12 +1225,12 @@ namespace measurements {
                 * 
                 * @return constexpr measurement
                 */
-            friend constexpr measurement sinh(const measurement& meas) { 
+            friend constexpr basic_measurement sinh(const basic_measurement& meas) { 
                 
                 if (meas.units_ != rad) 
-                    throw std::runtime_error("Cannot take the hyperbolic sine of a measurement that is not in radians"); 
+                    throw_runtime_error("Cannot take the hyperbolic sine of a measurement that is not in radians"); 
                 
-                return measurement(std::sinh(meas.value_), unitless);
+                return basic_measurement(std::sinh(meas.value_), unitless);
 
             }
 
@@ -1182,12 +1242,12 @@ namespace measurements {
                 * 
                 * @return constexpr measurement
                 */
-            friend constexpr measurement cosh(const measurement& meas) { 
+            friend constexpr basic_measurement cosh(const basic_measurement& meas) { 
                 
                 if (meas.units_ != rad) 
-                    throw std::runtime_error("Cannot take the hyperbolic cosine of a measurement that is not in radians"); 
+                    throw_runtime_error("Cannot take the hyperbolic cosine of a measurement that is not in radians"); 
                 
-                return measurement(std::cosh(meas.value_), unitless);
+                return basic_measurement(std::cosh(meas.value_), unitless);
             
             }
 
@@ -1199,12 +1259,12 @@ namespace measurements {
                 * 
                 * @return constexpr measurement
                 */
-            friend constexpr measurement tanh(const measurement& meas) { 
+            friend constexpr basic_measurement tanh(const basic_measurement& meas) { 
                 
                 if (meas.units_ != rad) 
-                    throw std::runtime_error("Cannot take the hyperbolic tangent of a measurement that is not in radians"); 
+                    throw_runtime_error("Cannot take the hyperbolic tangent of a measurement that is not in radians"); 
                 
-                return measurement(std::tanh(meas.value_), unitless);
+                return basic_measurement(std::tanh(meas.value_), unitless);
 
             }
 
@@ -1216,12 +1276,12 @@ namespace measurements {
                 * 
                 * @return constexpr measurement
                 */
-            friend constexpr measurement asinh(const measurement& meas) { 
+            friend constexpr basic_measurement asinh(const basic_measurement& meas) { 
                 
                 if (meas.units_ != unitless) 
-                    throw std::runtime_error("Cannot take the hyperbolic arcsine of a measurement that is not unitless"); 
+                    throw_runtime_error("Cannot take the hyperbolic arcsine of a measurement that is not unitless"); 
                 
-                return measurement(std::asinh(meas.value_), rad);
+                return basic_measurement(std::asinh(meas.value_), rad);
 
             }
 
@@ -1233,12 +1293,12 @@ namespace measurements {
                 * 
                 * @return constexpr measurement
                 */
-            friend constexpr measurement acosh(const measurement& meas) { 
+            friend constexpr basic_measurement acosh(const basic_measurement& meas) { 
                 
                 if (meas.units_ != unitless) 
-                    throw std::runtime_error("Cannot take the hyperbolic arccosine of a measurement that is not unitless"); 
+                    throw_runtime_error("Cannot take the hyperbolic arccosine of a measurement that is not unitless"); 
                 
-                return measurement(std::acosh(meas.value_), rad);
+                return basic_measurement(std::acosh(meas.value_), rad);
             
             }
 
@@ -1250,12 +1310,12 @@ namespace measurements {
                 * 
                 * @return constexpr measurement
                 */
-            friend constexpr measurement atanh(const measurement& meas) { 
+            friend constexpr basic_measurement atanh(const basic_measurement& meas) { 
                 
                 if (meas.units_ != unitless) 
-                    throw std::runtime_error("Cannot take the hyperbolic arctangent of a measurement that is not unitless"); 
+                    throw_runtime_error("Cannot take the hyperbolic arctangent of a measurement that is not unitless"); 
                 
-                return measurement(std::atanh(meas.value_), rad);
+                return basic_measurement(std::atanh(meas.value_), rad);
 
             }
 
@@ -1285,7 +1345,7 @@ namespace measurements {
                 * 
                 * @return constexpr const scalar
                 */
-            constexpr scalar value() const noexcept { 
+            constexpr T value() const noexcept { 
                 
                 return this->value_; 
             
@@ -1297,7 +1357,7 @@ namespace measurements {
                 * 
                 * @return constexpr scalar& 
                 */
-            constexpr scalar& value() noexcept { 
+            constexpr T& value() noexcept { 
                 
                 return this->value_; 
             
@@ -1311,9 +1371,13 @@ namespace measurements {
             * 
             * @return constexpr scalar 
             */
-            constexpr scalar value_as(const unit& desired_units) const { 
+            constexpr T value_as(const unit& desired_units) const { 
                 
-                return (this->units_ == desired_units) ? this->value_ : this->units_.convert(this->value_, desired_units); 
+                if (this->units_ == desired_units)
+                    return this->value_;
+
+                instrumentation::count_conversion(this->units_, desired_units);
+                return this->units_.convert(this->value_, desired_units); 
             
             }
 
@@ -1347,7 +1411,7 @@ namespace measurements {
             * 
             * @return constexpr measurement 
             */
-            constexpr measurement as_measurement() const noexcept {
+            constexpr basic_measurement as_measurement() const noexcept {
 
                 return *this; 
 
@@ -1360,7 +1424,7 @@ namespace measurements {
             * @return constexpr measurement&
             *  
             */
-            constexpr measurement& as_measurement() noexcept {
+            constexpr basic_measurement& as_measurement() noexcept {
 
                 return *this; 
 
@@ -1374,9 +1438,10 @@ namespace measurements {
             * 
             * @return constexpr measurement 
             */
-            constexpr measurement convert_to(const unit& desired_units) const { 
+            constexpr basic_measurement convert_to(const unit& desired_units) const { 
                 
-                return { this->units_.convert(this->value_, desired_units), desired_units }; 
+                instrumentation::count_conversion(this->units_, desired_units);
+                return basic_measurement(this->units_.convert(this->value_, desired_units), desired_units);
             
             }
 
@@ -1397,11 +1462,38 @@ namespace measurements {
 
         protected:
 
+        // =============================================
+        // helpers
+        // =============================================
+
+            /**
+             * @brief Append a space and the units to a buffer written by std::to_chars
+             * 
+             * @param result: result of the previous write
+             * @param last: end of the buffer
+             * @param units: unit as l-value const reference
+             * 
+             * @return std::to_chars_result
+             */
+            static std::to_chars_result append_units(const std::to_chars_result& result, char* last, const unit& units) noexcept {
+
+                if (result.ec != std::errc()) 
+                    return result;
+                if (result.ptr == last) 
+                    return { last, std::errc::value_too_large };
+
+                *result.ptr = ' ';
+
+                return to_chars(result.ptr + 1, last, units);
+
+            }
+
+
         // =============================================                                                                                         
         // class members & friends
         // =============================================  
 
-            scalar value_; ///< The numerical value of the measurement
+            T value_; ///< The numerical value of the measurement
 
             unit units_; ///< The units of the measurement
 
@@ -1416,10 +1508,18 @@ namespace measurements {
             friend class angle_measurement; ///< angle_measurement is a friend of measurement
 
 
-            friend class umeasurement; ///< umeasurement is a friend of measurement
+            template <typename> 
+            friend class basic_umeasurement; ///< basic_umeasurement is a friend of basic_measurement
+
+
+    }; // class basic_measurement
+
+
+    using measurement = basic_measurement<scalar>; ///< measurement with a double precision value
 
+    using float_measurement = basic_measurement<float>; ///< measurement with a single precision value
 
-    }; // class measurement
+    using long_double_measurement = basic_measurement<long double>; ///< measurement with an extended precision value
     
 
     /**
@@ -0,0 +1,695 @@
+/**
+ * @file    measurement_array.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the definition and implementation of the measurement_array class,
+ *          with all its methods, operators and possibly operations.
+ * @date    2023-01-20
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    /**
+     * @brief A class for representing a dataset of measurements sharing the same unit,
+     *        stored as a contiguous aligned buffer of values and a single unit
+     *
+     * @tparam T: type of the values, as float, double or long double
+     *
+     * @note The units are checked once per operation, never once per element
+     * @note A float_measurement_array stores 4 bytes per element against the 8 bytes of a measurement_array,
+     *       so its loops move half the memory and fit twice the elements in a SIMD register
+     * @see measurement
+     */
+    template <typename T>
+    class basic_measurement_array {
+
+
+        public:
+
+            using container = std::vector<T, aligned_allocator<T>>;
+
+
+        // =============================================
+        // constructors & destructor
+        // =============================================
+
+            /**
+             * @brief Construct a new empty measurement_array object
+             *
+             * @param units: unit as l-value const reference
+             *
+             * @note If the unit is not specified, the unit is set to unitless
+             */
+            explicit basic_measurement_array(const unit& units = unit()) noexcept :
+
+                values_(),
+                units_(units) {}
+
+
+            /**
+             * @brief Construct a new measurement_array object with a size and a value for every element
+             *
+             * @param size: number of elements
+             * @param value: value of every element as l-value const reference
+             * @param units: unit as l-value const reference
+             */
+            basic_measurement_array(const std::size_t& size,
+                                    const T& value,
+                                    const unit& units) :
+
+                values_(size, value),
+                units_(units) {}
+
+
+            /**
+             * @brief Construct a new measurement_array object from a list of values and an unit
+             *
+             * @param values: values of the elements
+             * @param units: unit as l-value const reference
+             */
+            basic_measurement_array(std::initializer_list<T> values,
+                                    const unit& units) :
+
+                values_(values),
+                units_(units) {}
+
+
+            /**
+             * @brief Construct a new measurement_array object from a range of values and an unit
+             *
+             * @param values: values of the elements
+             * @param units: unit as l-value const reference
+             */
+            basic_measurement_array(std::span<const T> values,
+                                    const unit& units) :
+
+                values_(values.begin(), values.end()),
+                units_(units) {}
+
+
+            /**
+             * @brief Construct a new measurement_array object copying a measurement_view
+             *
+             * @param view: measurement_view as l-value const reference
+             */
+            explicit basic_measurement_array(const basic_measurement_view<T>& view) :
+
+                values_(view.values().begin(), view.values().end()),
+                units_(view.units()) {}
+
+
+            /**
+             * @brief Construct a new measurement_array object from a range of measurements
+             *
+             * @param measurements: measurements to copy
+             * @param units: unit of the measurement_array as l-value const reference
+             *
+             * @note Every measurement must have the same unit_base of units and is converted to units
+             */
+            basic_measurement_array(std::span<const basic_measurement<T>> measurements,
+                                    const unit& units) :
+
+                values_(),
+                units_(units) {
+
+                this->values_.reserve(measurements.size());
+                for (const basic_measurement<T>& meas : measurements)
+                    this->push_back(meas);
+
+            }
+
+
+            /// @brief Copy construct a new measurement_array object
+            basic_measurement_array(const basic_measurement_array& other) = default;
+
+
+            /// @brief Move construct a new measurement_array object
+            basic_measurement_array(basic_measurement_array&& other) noexcept = default;
+
+
+            /// @brief Default destructor
+            ~basic_measurement_array() = default;
+
+
+        // =============================================
+        // operators
+        // =============================================
+
+            /// @brief Copy assign another measurement_array to this measurement_array
+            basic_measurement_array& operator=(const basic_measurement_array& other) = default;
+
+
+            /// @brief Move assign another measurement_array to this measurement_array
+            basic_measurement_array& operator=(basic_measurement_array&& other) noexcept = default;
+
+
+            /**
+             * @brief Add element-wise another measurement_array to this measurement_array
+             *
+             * @param other: measurement_view as l-value const reference, a measurement_array converts implicitly
+             *
+             * @return measurement_array&
+             *
+             * @note The values of other are converted to the units of this measurement_array
+             */
+            basic_measurement_array& operator+=(const basic_measurement_view<T>& other) {
+
+                this->check_size(other, "Cannot add measurement_arrays with different sizes");
+                if (this->units_.base() != other.units().base())
+                    throw_invalid_argument("Cannot add measurement_arrays with different unit_base", measurement_errc::unit_mismatch);
+
+                const T factor = other.units().convertion_factor(this->units_);
+                T* lhs = this->values_.data();
+                const T* rhs = other.values().data();
+                const std::size_t size = this->values_.size();
+
+                if (factor == 1.0)
+                    for (std::size_t i{0}; i < size; ++i)
+                        lhs[i] += rhs[i];
+
+                else
+                    for (std::size_t i{0}; i < size; ++i)
+                        lhs[i] += factor * rhs[i];
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Subtract element-wise another measurement_array to this measurement_array
+             *
+             * @param other: measurement_view as l-value const reference, a measurement_array converts implicitly
+             *
+             * @return measurement_array&
+             *
+             * @note The values of other are converted to the units of this measurement_array
+             */
+            basic_measurement_array& operator-=(const basic_measurement_view<T>& other) {
+
+                this->check_size(other, "Cannot subtract measurement_arrays with different sizes");
+                if (this->units_.base() != other.units().base())
+                    throw_invalid_argument("Cannot subtract measurement_arrays with different unit_base", measurement_errc::unit_mismatch);
+
+                const T factor = other.units().convertion_factor(this->units_);
+                T* lhs = this->values_.data();
+                const T* rhs = other.values().data();
+                const std::size_t size = this->values_.size();
+
+                if (factor == 1.0)
+                    for (std::size_t i{0}; i < size; ++i)
+                        lhs[i] -= rhs[i];
+
+                else
+                    for (std::size_t i{0}; i < size; ++i)
+                        lhs[i] -= factor * rhs[i];
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Multiply element-wise this measurement_array by another measurement_array
+             *
+             * @param other: measurement_view as l-value const reference, a measurement_array converts implicitly
+             *
+             * @return measurement_array&
+             */
+            basic_measurement_array& operator*=(const basic_measurement_view<T>& other) {
+
+                this->check_size(other, "Cannot multiply measurement_arrays with different sizes");
+
+                T* lhs = this->values_.data();
+                const T* rhs = other.values().data();
+                const std::size_t size = this->values_.size();
+                for (std::size_t i{0}; i < size; ++i)
+                    lhs[i] *= rhs[i];
+
+                this->units_ *= other.units();
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Divide element-wise this measurement_array by another measurement_array
+             *
+             * @param other: measurement_view as l-value const reference, a measurement_array converts implicitly
+             *
+             * @return measurement_array&
+             *
+             * @note The divisors are not checked element by element, a zero divisor gives an infinite or NaN value
+             */
+            basic_measurement_array& operator/=(const basic_measurement_view<T>& other) {
+
+                this->check_size(other, "Cannot divide measurement_arrays with different sizes");
+
+                T* lhs = this->values_.data();
+                const T* rhs = other.values().data();
+                const std::size_t size = this->values_.size();
+                for (std::size_t i{0}; i < size; ++i)
+                    lhs[i] /= rhs[i];
+
+                this->units_ /= other.units();
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Add a measurement to every element of this measurement_array
+             *
+             * @param meas: measurement as l-value const reference
+             *
+             * @return measurement_array&
+             */
+            basic_measurement_array& operator+=(const basic_measurement<T>& meas) {
+
+                if (this->units_.base() != meas.units().base())
+                    throw_invalid_argument("Cannot add a basic_measurement<T> with a different unit_base to a basic_measurement_array", measurement_errc::unit_mismatch);
+
+                const T value = meas.value_as(this->units_);
+                for (T& element : this->values_)
+                    element += value;
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Subtract a measurement to every element of this measurement_array
+             *
+             * @param meas: measurement as l-value const reference
+             *
+             * @return measurement_array&
+             */
+            basic_measurement_array& operator-=(const basic_measurement<T>& meas) {
+
+                if (this->units_.base() != meas.units().base())
+                    throw_invalid_argument("Cannot subtract a basic_measurement<T> with a different unit_base to a basic_measurement_array", measurement_errc::unit_mismatch);
+
+                const T value = meas.value_as(this->units_);
+                for (T& element : this->values_)
+                    element -= value;
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Multiply every element of this measurement_array by a measurement
+             *
+             * @param meas: measurement as l-value const reference
+             *
+             * @return measurement_array&
+             */
+            basic_measurement_array& operator*=(const basic_measurement<T>& meas) noexcept {
+
+                *this *= meas.value();
+                this->units_ *= meas.units();
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Divide every element of this measurement_array by a measurement
+             *
+             * @param meas: measurement as l-value const reference
+             *
+             * @return measurement_array&
+             */
+            basic_measurement_array& operator/=(const basic_measurement<T>& meas) {
+
+                *this /= meas.value();
+                this->units_ /= meas.units();
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Multiply every element of this measurement_array by a scalar
+             *
+             * @param scal: scalar as l-value const reference
+             *
+             * @return measurement_array&
+             */
+            basic_measurement_array& operator*=(const T& scal) noexcept {
+
+                for (T& element : this->values_)
+                    element *= scal;
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Divide every element of this measurement_array by a scalar
+             *
+             * @param scal: scalar as l-value const reference
+             *
+             * @return measurement_array&
+             */
+            basic_measurement_array& operator/=(const T& scal) {
+
+                if (scal == 0.0)
+                    throw_runtime_error("Cannot divide a basic_measurement_array by 0", measurement_errc::division_by_zero);
+
+                for (T& element : this->values_)
+                    element /= scal;
+
+                return *this;
+
+            }
+
+
+            /// @brief Sum element-wise two measurement_arrays, the result has the units of the left operand
+            friend basic_measurement_array operator+(basic_measurement_array lhs, const basic_measurement_view<T>& rhs) { return lhs += rhs; }
+
+            /// @brief Subtract element-wise two measurement_arrays, the result has the units of the left operand
+            friend basic_measurement_array operator-(basic_measurement_array lhs, const basic_measurement_view<T>& rhs) { return lhs -= rhs; }
+
+            /// @brief Multiply element-wise two measurement_arrays
+            friend basic_measurement_array operator*(basic_measurement_array lhs, const basic_measurement_view<T>& rhs) { return lhs *= rhs; }
+
+            /// @brief Divide element-wise two measurement_arrays
+            friend basic_measurement_array operator/(basic_measurement_array lhs, const basic_measurement_view<T>& rhs) { return lhs /= rhs; }
+
+            /// @brief Add a measurement to every element of a measurement_array
+            friend basic_measurement_array operator+(basic_measurement_array lhs, const basic_measurement<T>& rhs) { return lhs += rhs; }
+
+            /// @brief Subtract a measurement to every element of a measurement_array
+            friend basic_measurement_array operator-(basic_measurement_array lhs, const basic_measurement<T>& rhs) { return lhs -= rhs; }
+
+            /// @brief Multiply every element of a measurement_array by a measurement
+            friend basic_measurement_array operator*(basic_measurement_array lhs, const basic_measurement<T>& rhs) noexcept { return lhs *= rhs; }
+
+            /// @brief Multiply every element of a measurement_array by a measurement
+            friend basic_measurement_array operator*(const basic_measurement<T>& lhs, basic_measurement_array rhs) noexcept { return rhs *= lhs; }
+
+            /// @brief Divide every element of a measurement_array by a measurement
+            friend basic_measurement_array operator/(basic_measurement_array lhs, const basic_measurement<T>& rhs) { return lhs /= rhs; }
+
+            /// @brief Multiply every element of a measurement_array by a scalar
+            friend basic_measurement_array operator*(basic_measurement_array lhs, const T& rhs) noexcept { return lhs *= rhs; }
+
+            /// @brief Multiply every element of a measurement_array by a scalar
+            friend basic_measurement_array operator*(const T& lhs, basic_measurement_array rhs) noexcept { return rhs *= lhs; }
+
+            /// @brief Divide every element of a measurement_array by a scalar
+            friend basic_measurement_array operator/(basic_measurement_array lhs, const T& rhs) { return lhs /= rhs; }
+
+
+            /**
+             * @brief Get the opposite of this measurement_array
+             *
+             * @return measurement_array
+             */
+            basic_measurement_array operator-() const {
+
+                return *this * -1.0;
+
+            }
+
+
+            /**
+             * @brief Get an element of the measurement_array
+             *
+             * @param index: position of the element
+             *
+             * @return measurement
+             */
+            basic_measurement<T> operator[](const std::size_t& index) const noexcept {
+
+                return { this->values_[index], this->units_ };
+
+            }
+
+
+            /**
+             * @brief Output operator for a measurement_array
+             *
+             * @param os: std::ostream&
+             * @param array: measurement_array as l-value const reference
+             *
+             * @return std::ostream&
+             */
+            friend std::ostream& operator<<(std::ostream& os, const basic_measurement_array& array) noexcept {
+
+                os << "[";
+                for (std::size_t i{0}; i < array.size(); ++i)
+                    os << ((i == 0) ? "" : ", ") << array.values_[i];
+                os << "] " << array.units_;
+
+                return os;
+
+            }
+
+
+        // =============================================
+        // operations
+        // =============================================
+
+            /**
+             * @brief Convert the measurement_array to another units
+             *
+             * @param desired_units: desired unit of measurement
+             *
+             * @return measurement_array
+             *
+             * @note Every element is counted as a conversion by the instrumentation, see units::convert
+             */
+            basic_measurement_array convert_to(const unit& desired_units) const {
+
+                basic_measurement_array result(desired_units);
+                result.resize(this->size());
+                units::convert<T>(this->values_, this->units_, desired_units, result.values_);
+
+                return result;
+
+            }
+
+
+            /// @brief Sum all the elements of the measurement_array
+            basic_measurement<T> sum() const noexcept { return this->view().sum(); }
+
+            /// @brief Compute the arithmetic mean of the elements of the measurement_array
+            basic_measurement<T> mean() const { return this->view().mean(); }
+
+            /// @brief Get the smallest element of the measurement_array
+            basic_measurement<T> min() const { return this->view().min(); }
+
+            /// @brief Get the largest element of the measurement_array
+            basic_measurement<T> max() const { return this->view().max(); }
+
+            /**
+             * @brief Compute the dot product of two measurement_arrays
+             *
+             * @param other: measurement_view as l-value const reference, a measurement_array converts implicitly
+             *
+             * @return measurement
+             */
+            basic_measurement<T> dot(const basic_measurement_view<T>& other) const { return this->view().dot(other); }
+
+
+        // =============================================
+        // set & get methods
+        // =============================================
+
+            /**
+             * @brief Append a measurement to the measurement_array
+             *
+             * @param meas: measurement as l-value const reference
+             *
+             * @note The measurement is converted to the units of the measurement_array
+             */
+            void push_back(const basic_measurement<T>& meas) {
+
+                if (this->units_.base() != meas.units().base())
+                    throw_invalid_argument("Cannot append a basic_measurement<T> with a different unit_base to a basic_measurement_array", measurement_errc::unit_mismatch);
+
+                this->values_.push_back(meas.value_as(this->units_));
+
+            }
+
+
+            /// @brief Reserve memory for a number of elements
+            void reserve(const std::size_t& size) { this->values_.reserve(size); }
+
+            /// @brief Resize the measurement_array, the new elements are set to zero
+            void resize(const std::size_t& size) { this->values_.resize(size); }
+
+            /// @brief Remove all the elements of the measurement_array
+            void clear() noexcept { this->values_.clear(); }
+
+            /// @brief Get the number of elements of the measurement_array
+            std::size_t size() const noexcept { return this->values_.size(); }
+
+            /// @brief Check if the measurement_array is empty
+            bool empty() const noexcept { return this->values_.empty(); }
+
+
+            /**
+             * @brief Get the value of an element of the measurement_array
+             *
+             * @param index: position of the element
+             *
+             * @return T&
+             */
+            T& value(const std::size_t& index) noexcept {
+
+                return this->values_[index];
+
+            }
+
+
+            /**
+             * @brief Get the value of an element of the measurement_array
+             *
+             * @param index: position of the element
+             *
+             * @return T
+             */
+            T value(const std::size_t& index) const noexcept {
+
+                return this->values_[index];
+
+            }
+
+
+            /**
+             * @brief Get the values of the measurement_array
+             *
+             * @return std::span<T>
+             */
+            std::span<T> values() noexcept {
+
+                return this->values_;
+
+            }
+
+
+            /**
+             * @brief Get the values of the measurement_array
+             *
+             * @return std::span<const T>
+             */
+            std::span<const T> values() const noexcept {
+
+                return this->values_;
+
+            }
+
+
+            /**
+             * @brief Get a measurement_view of the measurement_array
+             *
+             * @return measurement_view
+             *
+             * @note The view is invalidated by any operation that reallocates the measurement_array
+             */
+            basic_measurement_view<T> view() const noexcept {
+
+                return { this->values_, this->units_ };
+
+            }
+
+
+            /// @brief Get a measurement_view of the measurement_array
+            operator basic_measurement_view<T>() const noexcept {
+
+                return this->view();
+
+            }
+
+
+            /**
+             * @brief Get the units of the measurement_array
+             *
+             * @return const unit&
+             */
+            const unit& units() const noexcept {
+
+                return this->units_;
+
+            }
+
+
+            /**
+             * @brief Get the units of the measurement_array
+             *
+             * @return unit&
+             *
+             * @note Changing the units does not convert the values
+             */
+            unit& units() noexcept {
+
+                return this->units_;
+
+            }
+
+
+            /**
+             * @brief Print the measurement_array
+             *
+             * @param newline: if set to true it prints a newline character at the end of the measurement_array
+             */
+            inline void print(const bool& newline = true) const noexcept {
+
+                std::cout << *this;
+                if (newline)
+                    std::cout << "\n";
+
+            }
+
+
+        protected:
+
+        // =============================================
+        // helpers
+        // =============================================
+
+            /// @brief Throw if the sizes of two measurement_arrays are different
+            void check_size(const basic_measurement_view<T>& other, const char* message) const {
+
+                if (this->values_.size() != other.size())
+                    throw_invalid_argument(message);
+
+            }
+
+
+        // =============================================
+        // class members
+        // =============================================
+
+            container values_; ///< The numerical values of the measurements
+
+            unit units_; ///< The units shared by all the measurements
+
+
+    }; // class basic_measurement_array
+
+
+    using measurement_array = basic_measurement_array<scalar>; ///< measurement_array of double precision values
+
+    using float_measurement_array = basic_measurement_array<float>; ///< measurement_array of single precision values
+
+    using long_double_measurement_array = basic_measurement_array<long double>; ///< measurement_array of extended precision values
+
+
+} // namespace measurements
@@ -41,7 +41,7 @@ namespace measurements {
                                               const unit& length_units = m) {
 
             if (length_units.base_ != basis::metre) 
-                throw std::invalid_argument("Cannot convert from " + length_units.base_.to_string() + " to metre in initialization of length_measurement");
+                throw_conversion_error(length_units.base_, "metre", "initialization of length_measurement");
 
             else {
 
@@ -61,7 +61,7 @@ namespace measurements {
         constexpr length_measurement(const measurement& other) {
 
             if (other.units_.base_ != basis::metre) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to metre in initialization of length_measurement");
+                throw_conversion_error(other.units_.base_, "metre", "initialization of length_measurement");
 
             else {
 
@@ -81,7 +81,7 @@ namespace measurements {
         constexpr length_measurement(measurement&& other)  {
 
             if (other.units_.base_ != basis::metre) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to metre in initialization of length_measurement");
+                throw_conversion_error(other.units_.base_, "metre", "initialization of length_measurement");
 
             else {
 
@@ -122,10 +122,10 @@ namespace measurements {
                                    const unit& length_units = s) {
 
             if (value < 0.0)
-                throw std::invalid_argument("Cannot initialize a time_measurement with a negative value");
+                throw_invalid_argument("Cannot initialize a time_measurement with a negative value");
 
             else if (length_units.base_ != basis::second) 
-                throw std::invalid_argument("Cannot convert from " + length_units.base_.to_string() + " to second in initialization of time_measurement");
+                throw_conversion_error(length_units.base_, "second", "initialization of time_measurement");
 
             else {
 
@@ -145,10 +145,10 @@ namespace measurements {
         constexpr time_measurement(const measurement& other) {
 
             if (other.value_ < 0.0)
-                throw std::invalid_argument("Cannot initialize a time_measurement with a negative value");
+                throw_invalid_argument("Cannot initialize a time_measurement with a negative value");
 
             else if (other.units_.base_ != basis::second) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to second in initialization of time_measurement");
+                throw_conversion_error(other.units_.base_, "second", "initialization of time_measurement");
 
             else {
 
@@ -168,10 +168,10 @@ namespace measurements {
         constexpr time_measurement(measurement&& other)  {
 
             if (other.value_ < 0.0)
-                throw std::invalid_argument("Cannot initialize a time_measurement with a negative value");
+                throw_invalid_argument("Cannot initialize a time_measurement with a negative value");
 
             else if (other.units_.base_ != basis::second) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to second in initialization of time_measurement");
+                throw_conversion_error(other.units_.base_, "second", "initialization of time_measurement");
 
             else {
 
@@ -212,7 +212,7 @@ namespace measurements {
                                              const unit& length_units = m_s) {
 
             if (length_units.base_ != basis::metre / basis::second) 
-                throw std::invalid_argument("Cannot convert from " + length_units.base_.to_string() + " to metre / second in initialization of speed_measurement");
+                throw_conversion_error(length_units.base_, "metre / second", "initialization of speed_measurement");
 
             else {
 
@@ -232,7 +232,7 @@ namespace measurements {
         constexpr speed_measurement(const measurement& other) {
 
             if (other.units_.base_ != basis::metre / basis::second) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to metre / second in initialization of speed_measurement");
+                throw_conversion_error(other.units_.base_, "metre / second", "initialization of speed_measurement");
 
             else {
 
@@ -252,7 +252,7 @@ namespace measurements {
         constexpr speed_measurement(measurement&& other)  {
 
             if (other.units_.base_ != basis::metre / basis::second) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to metre / second in initialization of speed_measurement");
+                throw_conversion_error(other.units_.base_, "metre / second", "initialization of speed_measurement");
 
             else {
 
@@ -293,7 +293,7 @@ namespace measurements {
                                                     const unit& length_units = m_ss) {
 
             if (length_units.base_ != basis::metre / basis::second.square()) 
-                throw std::invalid_argument("Cannot convert from " + length_units.base_.to_string() + " to metre / second^2 in initialization of acceleration_measurement");
+                throw_conversion_error(length_units.base_, "metre / second^2", "initialization of acceleration_measurement");
 
             else {
 
@@ -313,7 +313,7 @@ namespace measurements {
         constexpr acceleration_measurement(const measurement& other) {
 
             if (other.units_.base_ != basis::metre / basis::second.square()) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to metre / second^2 in initialization of acceleration_measurement");
+                throw_conversion_error(other.units_.base_, "metre / second^2", "initialization of acceleration_measurement");
 
             else {
 
@@ -333,7 +333,7 @@ namespace measurements {
         constexpr acceleration_measurement(measurement&& other)  {
 
             if (other.units_.base_ != basis::metre / basis::second.square()) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to metre / second^2 in initialization of acceleration_measurement");
+                throw_conversion_error(other.units_.base_, "metre / second^2", "initialization of acceleration_measurement");
 
             else {
 
@@ -374,10 +374,10 @@ namespace measurements {
                                             const unit& length_units = kg) {
 
             if (value < 0.0)
-                throw std::invalid_argument("Cannot initialize a mass_measurement with a negative value");
+                throw_invalid_argument("Cannot initialize a mass_measurement with a negative value");
 
             else if (length_units.base_ != basis::kilogram) 
-                throw std::invalid_argument("Cannot convert from " + length_units.base_.to_string() + " to kilogram in initialization of mass_measurement");
+                throw_conversion_error(length_units.base_, "kilogram", "initialization of mass_measurement");
 
             else {
 
@@ -397,10 +397,10 @@ namespace measurements {
         constexpr mass_measurement(const measurement& other) {
 
             if (other.value_ < 0.0)
-                throw std::invalid_argument("Cannot initialize a mass_measurement with a negative value");
+                throw_invalid_argument("Cannot initialize a mass_measurement with a negative value");
 
             else if (other.units_.base_ != basis::kilogram) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to kilogram in initialization of mass_measurement");
+                throw_conversion_error(other.units_.base_, "kilogram", "initialization of mass_measurement");
 
             else {
 
@@ -420,10 +420,10 @@ namespace measurements {
         constexpr mass_measurement(measurement&& other)  {
 
             if (other.value_ < 0.0)
-                throw std::invalid_argument("Cannot initialize a mass_measurement with a negative value");
+                throw_invalid_argument("Cannot initialize a mass_measurement with a negative value");
 
             else if (other.units_.base_ != basis::kilogram) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to kilogram in initialization of mass_measurement");
+                throw_conversion_error(other.units_.base_, "kilogram", "initialization of mass_measurement");
 
             else {
 
@@ -464,7 +464,7 @@ namespace measurements {
                                              const unit& force_units = N) {
 
             if (force_units.base_ != basis::kilogram * basis::metre / basis::second.square()) 
-                throw std::invalid_argument("Cannot convert from " + force_units.base_.to_string() + " to Newton in initialization of force_measurement");
+                throw_conversion_error(force_units.base_, "Newton", "initialization of force_measurement");
 
             else {
 
@@ -484,7 +484,7 @@ namespace measurements {
         constexpr force_measurement(const measurement& other) {
 
             if (other.units_.base_ != basis::kilogram * basis::metre / basis::second.square()) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to Newton in initialization of force_measurement");
+                throw_conversion_error(other.units_.base_, "Newton", "initialization of force_measurement");
 
             else {
 
@@ -504,7 +504,7 @@ namespace measurements {
         constexpr force_measurement(measurement&& other)  {
 
             if (other.units_.base_ != basis::kilogram * basis::metre / basis::second.square()) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to Newton in initialization of force_measurement");
+                throw_conversion_error(other.units_.base_, "Newton", "initialization of force_measurement");
 
             else {
 
@@ -548,7 +548,7 @@ namespace measurements {
                                              const unit& angle_units = rad) {
 
             if (angle_units != unitless)
-                throw std::invalid_argument("Cannot convert from " + angle_units.base_.to_string() + " to radians in initialization of angle_measurement");
+                throw_conversion_error(angle_units.base_, "radians", "initialization of angle_measurement");
 
             else {
 
@@ -568,7 +568,7 @@ namespace measurements {
         constexpr angle_measurement(const measurement& other) {
 
             if (other.units_ != unitless)
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to radians in initialization of angle_measurement");
+                throw_conversion_error(other.units_.base_, "radians", "initialization of angle_measurement");
 
             else {
 
@@ -588,7 +588,7 @@ namespace measurements {
         constexpr angle_measurement(measurement&& other)  {
 
             if (other.units_ != unitless)
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to radians in initialization of angle_measurement");
+                throw_conversion_error(other.units_.base_, "radians", "initialization of angle_measurement");
 
             else {
 
@@ -619,7 +619,7 @@ namespace measurements {
 
             else 
 
-                throw std::invalid_argument("Cannot convert from " + this->units_.base_.to_string() + " to " + desired_units.base_.to_string() + " in angle_measurement::convert_to()");
+                throw_conversion_error(this->units_.base_, desired_units.base_, "angle_measurement::convert_to()");
         
         }
 
@@ -0,0 +1,222 @@
+/**
+ * @file    measurement_view.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the definition and implementation of the measurement_view class,
+ *          a non-owning view of a buffer of values sharing the same unit
+ * @date    2023-01-24
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    /**
+     * @brief A class for viewing a contiguous buffer of values sharing the same unit as measurements, without copying them
+     *
+     * @tparam T: type of the values, as float, double or long double
+     * @note The buffer must outlive the measurement_view
+     * @see measurement_array
+     */
+    template <typename T>
+    class basic_measurement_view {
+
+
+        public:
+
+        // =============================================
+        // constructors & destructor
+        // =============================================
+
+            /// @brief Construct a new empty unitless measurement_view object
+            constexpr basic_measurement_view() noexcept :
+
+                values_(),
+                units_() {}
+
+
+            /**
+             * @brief Construct a new measurement_view object
+             *
+             * @param values: buffer of the values
+             * @param units: unit of the values as l-value const reference
+             */
+            constexpr basic_measurement_view(std::span<const T> values,
+                                             const unit& units) noexcept :
+
+                values_(values),
+                units_(units) {}
+
+
+        // =============================================
+        // operators
+        // =============================================
+
+            /**
+             * @brief Get an element of the measurement_view
+             *
+             * @param index: position of the element
+             *
+             * @return measurement
+             */
+            constexpr basic_measurement<T> operator[](const std::size_t& index) const noexcept {
+
+                return { this->values_[index], this->units_ };
+
+            }
+
+
+        // =============================================
+        // operations
+        // =============================================
+
+            /**
+             * @brief Sum all the elements of the measurement_view
+             *
+             * @return measurement
+             */
+            basic_measurement<T> sum() const noexcept {
+
+                return { basic_measurement_view::accumulate(this->values_.data(), this->values_.size()), this->units_ };
+
+            }
+
+
+            /**
+             * @brief Compute the arithmetic mean of the elements of the measurement_view
+             *
+             * @return measurement
+             */
+            basic_measurement<T> mean() const {
+
+                if (this->values_.empty())
+                    throw_runtime_error("Cannot compute the mean of an empty dataset");
+
+                return { basic_measurement_view::accumulate(this->values_.data(), this->values_.size()) / this->values_.size(), this->units_ };
+
+            }
+
+
+            /**
+             * @brief Get the smallest element of the measurement_view
+             *
+             * @return measurement
+             */
+            basic_measurement<T> min() const {
+
+                if (this->values_.empty())
+                    throw_runtime_error("Cannot compute the minimum of an empty dataset");
+
+                return { *std::min_element(this->values_.begin(), this->values_.end()), this->units_ };
+
+            }
+
+
+            /**
+             * @brief Get the largest element of the measurement_view
+             *
+             * @return measurement
+             */
+            basic_measurement<T> max() const {
+
+                if (this->values_.empty())
+                    throw_runtime_error("Cannot compute the maximum of an empty dataset");
+
+                return { *std::max_element(this->values_.begin(), this->values_.end()), this->units_ };
+
+            }
+
+
+            /**
+             * @brief Compute the dot product of two measurement_views
+             *
+             * @param other: measurement_view as l-value const reference
+             *
+             * @return measurement
+             */
+            basic_measurement<T> dot(const basic_measurement_view& other) const {
+
+                if (this->size() != other.size())
+                    throw_invalid_argument("Cannot compute the dot product of datasets with different sizes");
+
+                const T* lhs = this->values_.data();
+                const T* rhs = other.values_.data();
+                T partial[4] = { 0.0, 0.0, 0.0, 0.0 };
+                std::size_t i{0};
+                for (; i + 4 <= this->size(); i += 4)
+                    for (std::size_t j{0}; j < 4; ++j)
+                        partial[j] += lhs[i + j] * rhs[i + j];
+                for (; i < this->size(); ++i)
+                    partial[0] += lhs[i] * rhs[i];
+
+                return { (partial[0] + partial[1]) + (partial[2] + partial[3]), this->units_ * other.units_ };
+
+            }
+
+
+        // =============================================
+        // get methods
+        // =============================================
+
+            /// @brief Get the number of elements of the measurement_view
+            constexpr std::size_t size() const noexcept { return this->values_.size(); }
+
+            /// @brief Check if the measurement_view is empty
+            constexpr bool empty() const noexcept { return this->values_.empty(); }
+
+            /// @brief Get the values of the measurement_view
+            constexpr std::span<const T> values() const noexcept { return this->values_; }
+
+            /// @brief Get the units of the measurement_view
+            constexpr const unit& units() const noexcept { return this->units_; }
+
+
+            /**
+             * @brief Sum a buffer of values using independent partial sums, so that the loop can be vectorized
+             *
+             * @param data: pointer to the values
+             * @param size: number of values
+             *
+             * @return T
+             */
+            static T accumulate(const T* data, const std::size_t& size) noexcept {
+
+                T partial[4] = { 0.0, 0.0, 0.0, 0.0 };
+                std::size_t i{0};
+                for (; i + 4 <= size; i += 4)
+                    for (std::size_t j{0}; j < 4; ++j)
+                        partial[j] += data[i + j];
+                for (; i < size; ++i)
+                    partial[0] += data[i];
+
+                return (partial[0] + partial[1]) + (partial[2] + partial[3]);
+
+            }
+
+
+        private:
+
+        // =============================================
+        // class members
+        // =============================================
+
+            std::span<const T> values_; ///< The numerical values of the measurements
+
+            unit units_; ///< The units shared by all the measurements
+
+
+    }; // class basic_measurement_view
+
+
+    using measurement_view = basic_measurement_view<scalar>; ///< measurement_view of double precision values
+
+    using float_measurement_view = basic_measurement_view<float>; ///< measurement_view of single precision values
+
+    using long_double_measurement_view = basic_measurement_view<long double>; ///< measurement_view of extended precision values
+
+
+} // namespace measurements
@@ -0,0 +1,256 @@
+/**
+ * @file    monte_carlo.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the Monte Carlo propagation of the uncertainties of umeasurements through a function,
+ *          with a counter-based random number generator so that the result does not depend on the number of threads
+ * @date    2023-01-30
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    /**
+     * @brief Counter-based random number generator: every number is a function of a seed, a stream and a counter,
+     *        so any sample can be drawn independently of the others
+     */
+    namespace counter_rng {
+
+
+        /// @brief Mix a 64 bit word with the finalizer of SplitMix64
+        constexpr uint64_t mix(uint64_t x) noexcept {
+
+            x ^= x >> 30;
+            x *= 0xbf58476d1ce4e5b9ULL;
+            x ^= x >> 27;
+            x *= 0x94d049bb133111ebULL;
+            x ^= x >> 31;
+
+            return x;
+
+        }
+
+
+        /**
+         * @brief Get the random word of a seed, a stream and a counter
+         *
+         * @param seed: seed of the generator
+         * @param stream: index of the stream, as the index of an input
+         * @param counter: index of the number in the stream
+         *
+         * @return uint64_t
+         */
+        constexpr uint64_t random(const uint64_t& seed, const uint64_t& stream, const uint64_t& counter) noexcept {
+
+            return mix(mix(mix(seed + 0x9e3779b97f4a7c15ULL) ^ (stream + 0x632be59bd9b4e019ULL)) ^ counter);
+
+        }
+
+
+        /// @brief Get a uniform number in (0, 1) from a random word
+        constexpr scalar uniform(const uint64_t& word) noexcept {
+
+            return (static_cast<scalar>(word >> 11) + 0.5) * 0x1.0p-53;
+
+        }
+
+
+        /**
+         * @brief Get a standard normal number of a seed, a stream and a counter, with the Box-Muller transform
+         *
+         * @param seed: seed of the generator
+         * @param stream: index of the stream
+         * @param counter: index of the number in the stream
+         *
+         * @return scalar
+         *
+         * @note The counters 2k and 2k + 1 share the uniform numbers of the transform and get its two independent normal numbers
+         */
+        inline scalar normal(const uint64_t& seed, const uint64_t& stream, const uint64_t& counter) noexcept {
+
+            const uint64_t pair = counter & ~uint64_t{1};
+            const scalar radius = std::sqrt(-2.0 * std::log(uniform(random(seed, stream, pair))));
+            const scalar angle = 2.0 * std::numbers::pi * uniform(random(seed, stream, pair + 1));
+
+            return radius * ((counter & 1) ? std::sin(angle) : std::cos(angle));
+
+        }
+
+
+    } // namespace counter_rng
+
+
+    /// @brief Options of the Monte Carlo propagation
+    struct monte_carlo_options {
+
+        std::size_t samples{1 << 20}; ///< Number of samples
+
+        uint64_t seed{0}; ///< Seed of the random number generator
+
+        unsigned threads{0}; ///< Number of threads, 0 means one per hardware thread
+
+        std::size_t batch{1 << 14}; ///< Number of samples of a batch, the unit of work of a thread
+
+        std::vector<scalar> probabilities{}; ///< Probabilities of the quantiles to compute, in [0, 1]
+
+    };
+
+
+    /// @brief Result of the Monte Carlo propagation
+    struct monte_carlo_result {
+
+        umeasurement estimate; ///< Mean of the samples, with their standard deviation as uncertainty
+
+        std::vector<measurement> quantiles; ///< Quantiles of the samples, one for each of the requested probabilities
+
+    };
+
+
+    /**
+     * @brief Propagate the uncertainties of umeasurements through a function by Monte Carlo sampling
+     *
+     * @param function: callable as function(const measurement&...) returning a measurement
+     * @param options: monte_carlo_options as l-value const reference
+     * @param inputs: umeasurements, each one sampled from an independent normal distribution
+     *
+     * @return monte_carlo_result
+     *
+     * @note The samples are drawn in batches of options.batch, each batch fills the normal numbers of every input in a loop
+     *       and then evaluates the function on them. The statistics of the batches are combined in order,
+     *       so the result depends only on the options and not on the number of threads
+     * @note The function is invoked concurrently by options.threads threads, so it must be safe to call
+     *       from several threads at once: any state it shares between the calls must be synchronized
+     * @note A sample for which the function returns a NaN or an infinite value throws a std::runtime_error
+     */
+    template <typename Function, typename... Inputs>
+        requires (std::same_as<std::remove_cvref_t<Inputs>, umeasurement> && ...)
+    monte_carlo_result monte_carlo(Function&& function, const monte_carlo_options& options, const Inputs&... inputs) {
+
+        constexpr std::size_t count = sizeof...(Inputs);
+
+        if (options.samples < 2)
+            throw_invalid_argument("Cannot run a Monte Carlo propagation with less than two samples");
+
+        for (const scalar& probability : options.probabilities)
+            if (!(probability >= 0.0 && probability <= 1.0))
+                throw_invalid_argument("Cannot compute a quantile with a probability outside of [0, 1]");
+
+        const std::array<scalar, count> values{ inputs.value()... };
+        const std::array<scalar, count> uncertainties{ inputs.uncertainty()... };
+        const std::array<unit, count> input_units{ inputs.units()... };
+
+        const unit units = measurement(function(inputs.as_measurement()...)).units();
+
+        const std::size_t batch_size = std::max<std::size_t>(options.batch, 1);
+        const std::size_t batches = (options.samples + batch_size - 1) / batch_size;
+
+        struct batch_statistics {
+
+            std::size_t count{0};
+
+            scalar mean{0.0};
+
+            scalar m2{0.0};
+
+            bool mismatch{false};
+
+            bool non_finite{false};
+
+        };
+
+        std::vector<batch_statistics> statistics(batches);
+        std::vector<scalar> samples(options.probabilities.empty() ? 0 : options.samples);
+
+        parallel::for_each(batches, [&](const std::size_t& index) {
+
+            const std::size_t first = index * batch_size;
+            const std::size_t size = std::min(batch_size, options.samples - first);
+
+            std::array<std::vector<scalar>, count> draws;
+            for (std::size_t j{0}; j < count; ++j) {
+
+                draws[j].resize(size);
+                for (std::size_t i{0}; i < size; ++i)
+                    draws[j][i] = values[j] + uncertainties[j] * counter_rng::normal(options.seed, j, first + i);
+
+            }
+
+            batch_statistics& stats = statistics[index];
+            std::vector<scalar> outputs(size);
+            [&]<std::size_t... J>(std::index_sequence<J...>) {
+
+                for (std::size_t i{0}; i < size; ++i) {
+
+                    const measurement output(function(measurement(draws[J][i], input_units[J])...));
+                    if (output.units() != units)
+                        stats.mismatch = true;
+                    if (!std::isfinite(output.value()))
+                        stats.non_finite = true;
+                    outputs[i] = output.value();
+
+                }
+
+            }(std::make_index_sequence<count>{});
+
+            // two-pass statistics of the batch
+            scalar sum{0.0};
+            for (const scalar& x : outputs)
+                sum += x;
+            stats.count = size;
+            stats.mean = sum / static_cast<scalar>(size);
+            for (const scalar& x : outputs)
+                stats.m2 += (x - stats.mean) * (x - stats.mean);
+
+            if (!samples.empty())
+                std::copy(outputs.begin(), outputs.end(), samples.begin() + first);
+
+        }, options.threads);
+
+        // combine the batches in order
+        batch_statistics total;
+        for (const batch_statistics& stats : statistics) {
+
+            if (stats.mismatch)
+                throw_runtime_error("The function of the Monte Carlo propagation returned measurements with different units");
+
+            if (stats.non_finite)
+                throw_runtime_error("The function of the Monte Carlo propagation returned a value that is not finite");
+
+            const std::size_t n = total.count + stats.count;
+            const scalar delta = stats.mean - total.mean;
+            total.mean += delta * static_cast<scalar>(stats.count) / static_cast<scalar>(n);
+            total.m2 += stats.m2 + delta * delta * static_cast<scalar>(total.count) * static_cast<scalar>(stats.count) / static_cast<scalar>(n);
+            total.count = n;
+
+        }
+
+        monte_carlo_result result{ umeasurement(total.mean, std::sqrt(total.m2 / static_cast<scalar>(total.count - 1)), units), {} };
+
+        if (!samples.empty()) {
+
+            std::sort(samples.begin(), samples.end());
+            result.quantiles.reserve(options.probabilities.size());
+            for (const scalar& probability : options.probabilities) {
+
+                // linear interpolation between the order statistics
+                const scalar position = probability * static_cast<scalar>(samples.size() - 1);
+                const std::size_t lower = static_cast<std::size_t>(position);
+                const std::size_t upper = std::min(lower + 1, samples.size() - 1);
+                const scalar weight = position - static_cast<scalar>(lower);
+                result.quantiles.emplace_back(samples[lower] + weight * (samples[upper] - samples[lower]), units);
+
+            }
+
+        }
+
+        return result;
+
+    }
+
+
+} // namespace measurements
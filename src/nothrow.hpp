@@ -0,0 +1,251 @@
+/**
+ * @file    nothrow.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the arithmetic operations of measurements and umeasurements that do not throw,
+ *          returning a result with an error code instead
+ * @date    2023-01-26
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    /**
+     * @brief Arithmetic operations that do not throw
+     *
+     * @note Every operation returns a result: on failure its value is NaN, with the units the operation would have given, and its error code is set.
+     *       Combined with an error_flag, a batch of operations runs without exceptions and is checked once:
+     *
+     *       error_flag flag;
+     *       for (std::size_t i{0}; i < size; ++i)
+     *           out[i] = flag(nothrow::divide(x[i], y[i]));
+     *       flag.check();
+     */
+    namespace nothrow {
+
+
+        // =============================================
+        // measurement
+        // =============================================
+
+        /**
+         * @brief Add two measurements, the result has the units of lhs
+         *
+         * @param lhs: measurement as l-value const reference
+         * @param rhs: measurement as l-value const reference
+         *
+         * @return result<measurement>, measurement_errc::unit_mismatch if the unit_base are different
+         */
+        constexpr result<measurement> add(const measurement& lhs, const measurement& rhs) noexcept {
+
+            const unit units = lhs.units();
+            if (units.base() != rhs.units().base())
+                return { measurement(std::numeric_limits<scalar>::quiet_NaN(), units), measurement_errc::unit_mismatch };
+
+            return measurement(lhs.value() + rhs.units().convertion_factor(units) * rhs.value(), units);
+
+        }
+
+
+        /**
+         * @brief Subtract two measurements, the result has the units of lhs
+         *
+         * @param lhs: measurement as l-value const reference
+         * @param rhs: measurement as l-value const reference
+         *
+         * @return result<measurement>, measurement_errc::unit_mismatch if the unit_base are different
+         */
+        constexpr result<measurement> subtract(const measurement& lhs, const measurement& rhs) noexcept {
+
+            const unit units = lhs.units();
+            if (units.base() != rhs.units().base())
+                return { measurement(std::numeric_limits<scalar>::quiet_NaN(), units), measurement_errc::unit_mismatch };
+
+            return measurement(lhs.value() - rhs.units().convertion_factor(units) * rhs.value(), units);
+
+        }
+
+
+        /**
+         * @brief Multiply two measurements
+         *
+         * @param lhs: measurement as l-value const reference
+         * @param rhs: measurement as l-value const reference
+         *
+         * @return result<measurement>, it never fails
+         */
+        constexpr result<measurement> multiply(const measurement& lhs, const measurement& rhs) noexcept {
+
+            return lhs * rhs;
+
+        }
+
+
+        /**
+         * @brief Divide two measurements
+         *
+         * @param lhs: measurement as l-value const reference
+         * @param rhs: measurement as l-value const reference
+         *
+         * @return result<measurement>, measurement_errc::division_by_zero if rhs is zero
+         */
+        constexpr result<measurement> divide(const measurement& lhs, const measurement& rhs) noexcept {
+
+            const unit units = lhs.units() / rhs.units();
+            if (rhs.value() == 0.0)
+                return { measurement(std::numeric_limits<scalar>::quiet_NaN(), units), measurement_errc::division_by_zero };
+
+            return measurement(lhs.value() / rhs.value(), units);
+
+        }
+
+
+        /**
+         * @brief Divide a measurement by a scalar
+         *
+         * @param lhs: measurement as l-value const reference
+         * @param rhs: scalar as l-value const reference
+         *
+         * @return result<measurement>, measurement_errc::division_by_zero if rhs is zero
+         */
+        constexpr result<measurement> divide(const measurement& lhs, const scalar& rhs) noexcept {
+
+            if (rhs == 0.0)
+                return { measurement(std::numeric_limits<scalar>::quiet_NaN(), lhs.units()), measurement_errc::division_by_zero };
+
+            return measurement(lhs.value() / rhs, lhs.units());
+
+        }
+
+
+        // =============================================
+        // umeasurement
+        // =============================================
+
+        /**
+         * @brief Add two umeasurements with the root sum of squares of the uncertainties, the result has the units of lhs
+         *
+         * @param lhs: umeasurement as l-value const reference
+         * @param rhs: umeasurement as l-value const reference
+         *
+         * @return result<umeasurement>, measurement_errc::unit_mismatch if the unit_base are different
+         */
+        inline result<umeasurement> add(const umeasurement& lhs, const umeasurement& rhs) noexcept {
+
+            const unit units = lhs.units();
+            if (units.base() != rhs.units().base())
+                return { umeasurement(std::numeric_limits<scalar>::quiet_NaN(), std::numeric_limits<scalar>::quiet_NaN(), units), measurement_errc::unit_mismatch };
+
+            const scalar factor = rhs.units().convertion_factor(units);
+
+            return umeasurement(lhs.value() + factor * rhs.value(), std::sqrt(std::pow(lhs.uncertainty(), 2) + std::pow(factor * rhs.uncertainty(), 2)), units);
+
+        }
+
+
+        /**
+         * @brief Subtract two umeasurements with the root sum of squares of the uncertainties, the result has the units of lhs
+         *
+         * @param lhs: umeasurement as l-value const reference
+         * @param rhs: umeasurement as l-value const reference
+         *
+         * @return result<umeasurement>, measurement_errc::unit_mismatch if the unit_base are different
+         */
+        inline result<umeasurement> subtract(const umeasurement& lhs, const umeasurement& rhs) noexcept {
+
+            const unit units = lhs.units();
+            if (units.base() != rhs.units().base())
+                return { umeasurement(std::numeric_limits<scalar>::quiet_NaN(), std::numeric_limits<scalar>::quiet_NaN(), units), measurement_errc::unit_mismatch };
+
+            const scalar factor = rhs.units().convertion_factor(units);
+
+            return umeasurement(lhs.value() - factor * rhs.value(), std::sqrt(std::pow(lhs.uncertainty(), 2) + std::pow(factor * rhs.uncertainty(), 2)), units);
+
+        }
+
+
+        /**
+         * @brief Multiply two umeasurements with the root sum of squares of the uncertainties
+         *
+         * @param lhs: umeasurement as l-value const reference
+         * @param rhs: umeasurement as l-value const reference
+         *
+         * @return result<umeasurement>, it never fails
+         *
+         * @note The uncertainty is computed as sqrt((σx·y)² + (x·σy)²), which is defined also for zero values
+         */
+        inline result<umeasurement> multiply(const umeasurement& lhs, const umeasurement& rhs) noexcept {
+
+            return umeasurement(lhs.value() * rhs.value(), std::sqrt(std::pow(lhs.uncertainty() * rhs.value(), 2) + std::pow(lhs.value() * rhs.uncertainty(), 2)), lhs.units() * rhs.units());
+
+        }
+
+
+        /**
+         * @brief Divide two umeasurements with the root sum of squares of the uncertainties
+         *
+         * @param lhs: umeasurement as l-value const reference
+         * @param rhs: umeasurement as l-value const reference
+         *
+         * @return result<umeasurement>, measurement_errc::division_by_zero if rhs is zero
+         */
+        inline result<umeasurement> divide(const umeasurement& lhs, const umeasurement& rhs) noexcept {
+
+            const unit units = lhs.units() / rhs.units();
+            if (rhs.value() == 0.0)
+                return { umeasurement(std::numeric_limits<scalar>::quiet_NaN(), std::numeric_limits<scalar>::quiet_NaN(), units), measurement_errc::division_by_zero };
+
+            const scalar inv = 1.0 / rhs.value();
+            const scalar value = lhs.value() * inv;
+
+            return umeasurement(value, std::sqrt(std::pow(lhs.uncertainty(), 2) + std::pow(value * rhs.uncertainty(), 2)) * std::fabs(inv), units);
+
+        }
+
+
+        /**
+         * @brief Divide an umeasurement by a scalar
+         *
+         * @param lhs: umeasurement as l-value const reference
+         * @param rhs: scalar as l-value const reference
+         *
+         * @return result<umeasurement>, measurement_errc::division_by_zero if rhs is zero
+         */
+        inline result<umeasurement> divide(const umeasurement& lhs, const scalar& rhs) noexcept {
+
+            if (rhs == 0.0)
+                return { umeasurement(std::numeric_limits<scalar>::quiet_NaN(), std::numeric_limits<scalar>::quiet_NaN(), lhs.units()), measurement_errc::division_by_zero };
+
+            return umeasurement(lhs.value() / rhs, lhs.uncertainty() / std::fabs(rhs), lhs.units());
+
+        }
+
+
+        /**
+         * @brief Build an umeasurement checking its uncertainty
+         *
+         * @param value: scalar as l-value const reference
+         * @param uncertainty: scalar as l-value const reference
+         * @param units: unit as l-value const reference
+         *
+         * @return result<umeasurement>, measurement_errc::negative_uncertainty if the uncertainty is negative
+         */
+        inline result<umeasurement> make_umeasurement(const scalar& value, const scalar& uncertainty, const unit& units) noexcept {
+
+            if (uncertainty < 0.0)
+                return { umeasurement(value, std::numeric_limits<scalar>::quiet_NaN(), units), measurement_errc::negative_uncertainty };
+
+            return umeasurement(value, uncertainty, units);
+
+        }
+
+
+    } // namespace nothrow
+
+
+} // namespace measurements
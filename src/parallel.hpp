@@ -0,0 +1,116 @@
+/**
+ * @file    parallel.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the helpers used to split the work of the bulk operations among threads
+ * @date    2023-01-25
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    namespace parallel {
+
+
+        /**
+         * @brief Get the number of threads to use
+         *
+         * @param threads: requested number of threads, 0 means one per hardware thread
+         *
+         * @return unsigned
+         */
+        inline unsigned concurrency(const unsigned& threads = 0) noexcept {
+
+            if (threads != 0)
+                return threads;
+
+            const unsigned hardware = std::thread::hardware_concurrency();
+
+            return (hardware == 0) ? 1 : hardware;
+
+        }
+
+
+        /**
+         * @brief Call a function on every task index, distributing the tasks among threads
+         *
+         * @param tasks: number of tasks
+         * @param function: callable as function(std::size_t task)
+         * @param threads: number of threads, 0 means one per hardware thread
+         *
+         * @note The tasks are claimed dynamically, so the order of execution is unspecified:
+         *       a function writing only to the slot of its task gives a result independent of the number of threads
+         * @note The first exception thrown by a task is rethrown after every thread has finished, the tasks not yet claimed are skipped
+         */
+        template <typename Function>
+        void for_each(const std::size_t& tasks, Function&& function, const unsigned& threads = 0) {
+
+            const std::size_t workers = std::min<std::size_t>(parallel::concurrency(threads), tasks);
+            if (workers <= 1) {
+
+                for (std::size_t task{0}; task < tasks; ++task)
+                    function(task);
+
+                return;
+
+            }
+
+            std::atomic<std::size_t> next{0};
+            std::atomic<bool> failed{false};
+            std::exception_ptr error;
+
+            const auto work = [&]() noexcept {
+
+                for (std::size_t task = next.fetch_add(1, std::memory_order_relaxed); task < tasks; task = next.fetch_add(1, std::memory_order_relaxed)) {
+
+                    try {
+
+                        function(task);
+
+                    } catch (...) {
+
+                        if (!failed.exchange(true))
+                            error = std::current_exception();
+                        next.store(tasks, std::memory_order_relaxed);
+
+                    }
+
+                }
+
+            };
+
+            std::vector<std::thread> pool;
+            pool.reserve(workers - 1);
+            try {
+
+                for (std::size_t i{1}; i < workers; ++i)
+                    pool.emplace_back(work);
+
+            } catch (...) {
+
+                next.store(tasks, std::memory_order_relaxed);
+                for (std::thread& thread : pool)
+                    thread.join();
+                throw;
+
+            }
+
+            work();
+            for (std::thread& thread : pool)
+                thread.join();
+
+            if (error)
+                std::rethrow_exception(error);
+
+        }
+
+
+    } // namespace parallel
+
+
+} // namespace measurements
@@ -0,0 +1,541 @@
+/**
+ * @file    quantity.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the definition and implementation of the quantity class template,
+ *          a measurement whose unit is fixed at compile time.
+ * @date    2023-01-20
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    /**
+     * @brief A class template for representing a physical quantity whose unit is part of its type
+     *
+     * @tparam Base: unit_base of the quantity
+     * @tparam Prefix: unit_prefix of the quantity
+     *
+     * @note Only the numerical value is stored: sizeof(quantity) == sizeof(scalar)
+     * @note Adding or subtracting quantities with different unit_base does not compile
+     * @see measurement
+     */
+    template <unit_base Base, unit_prefix Prefix = unit_prefix()>
+    class quantity {
+
+
+        public:
+
+        // =============================================
+        // constructors & destructor
+        // =============================================
+
+            /**
+             * @brief Construct a new quantity object
+             *
+             * @note The default value is 0
+             */
+            constexpr quantity() noexcept :
+
+                value_{0.0} {}
+
+
+            /**
+             * @brief Construct a new quantity object from a value expressed in the units of the quantity
+             *
+             * @param value: scalar as l-value const reference
+             */
+            explicit constexpr quantity(const scalar& value) noexcept :
+
+                value_{value} {}
+
+
+            /**
+             * @brief Construct a new quantity object from a quantity with the same unit_base and another unit_prefix
+             *
+             * @param other: quantity as l-value const reference
+             *
+             * @note The conversion factor is evaluated at compile time
+             */
+            template <unit_prefix OtherPrefix>
+            constexpr quantity(const quantity<Base, OtherPrefix>& other) noexcept :
+
+                value_{other.value() * quantity::factor_from<OtherPrefix>()} {}
+
+
+            /**
+             * @brief Construct a new quantity object from a measurement
+             *
+             * @param meas: measurement as l-value const reference
+             *
+             * @note The measurement must have the same unit_base of the quantity
+             * @note The value is converted to the units of the quantity
+             */
+            explicit constexpr quantity(const measurement& meas) {
+
+                if (meas.units().base() != Base)
+                    throw_invalid_argument("Cannot initialize a quantity from a measurement with a different unit_base", measurement_errc::unit_mismatch);
+
+                this->value_ = meas.units().convert(meas.value(), quantity::units());
+
+            }
+
+
+            /**
+             * @brief Copy construct a new quantity object
+             *
+             * @param other: quantity as l-value const reference
+             */
+            constexpr quantity(const quantity& other) noexcept = default;
+
+
+            /// @brief Default destructor
+            ~quantity() noexcept = default;
+
+
+        // =============================================
+        // operators
+        // =============================================
+
+            /**
+             * @brief Copy assign another quantity to this quantity
+             *
+             * @param other: quantity as l-value const reference
+             *
+             * @return constexpr quantity&
+             */
+            constexpr quantity& operator=(const quantity& other) noexcept = default;
+
+
+            /**
+             * @brief Add a quantity with the same unit_base to this quantity
+             *
+             * @param other: quantity as l-value const reference
+             *
+             * @return constexpr quantity&
+             */
+            template <unit_prefix OtherPrefix>
+            constexpr quantity& operator+=(const quantity<Base, OtherPrefix>& other) noexcept {
+
+                this->value_ += other.value() * quantity::factor_from<OtherPrefix>();
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Subtract a quantity with the same unit_base to this quantity
+             *
+             * @param other: quantity as l-value const reference
+             *
+             * @return constexpr quantity&
+             */
+            template <unit_prefix OtherPrefix>
+            constexpr quantity& operator-=(const quantity<Base, OtherPrefix>& other) noexcept {
+
+                this->value_ -= other.value() * quantity::factor_from<OtherPrefix>();
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Multiply this quantity by a scalar
+             *
+             * @param scal: scalar as l-value const reference
+             *
+             * @return constexpr quantity&
+             */
+            constexpr quantity& operator*=(const scalar& scal) noexcept {
+
+                this->value_ *= scal;
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Divide this quantity by a scalar
+             *
+             * @param scal: scalar as l-value const reference
+             *
+             * @return constexpr quantity&
+             *
+             * @note No check is performed on the divisor
+             */
+            constexpr quantity& operator/=(const scalar& scal) noexcept {
+
+                this->value_ /= scal;
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Get the opposite of this quantity
+             *
+             * @return constexpr quantity
+             */
+            constexpr quantity operator-() const noexcept {
+
+                return quantity(-this->value_);
+
+            }
+
+
+            /**
+             * @brief Convert this quantity to a measurement
+             *
+             * @return constexpr measurement
+             */
+            explicit constexpr operator measurement() const noexcept {
+
+                return this->as_measurement();
+
+            }
+
+
+            /**
+             * @brief Output operator for a quantity
+             *
+             * @param os: std::ostream&
+             * @param q: quantity as l-value const reference
+             *
+             * @return std::ostream&
+             */
+            friend std::ostream& operator<<(std::ostream& os, const quantity& q) noexcept {
+
+                os << q.value_ << " " << quantity::units();
+
+                return os;
+
+            }
+
+
+        // =============================================
+        // get methods
+        // =============================================
+
+            /**
+             * @brief Get the value of the quantity
+             *
+             * @return constexpr scalar
+             */
+            constexpr scalar value() const noexcept {
+
+                return this->value_;
+
+            }
+
+
+            /**
+             * @brief Get the value of the quantity
+             *
+             * @return constexpr scalar&
+             */
+            constexpr scalar& value() noexcept {
+
+                return this->value_;
+
+            }
+
+
+            /**
+             * @brief Get the units of the quantity
+             *
+             * @return constexpr unit
+             */
+            static constexpr unit units() noexcept {
+
+                return unit(Prefix, Base);
+
+            }
+
+
+            /**
+             * @brief Get the quantity as a measurement object
+             *
+             * @return constexpr measurement
+             */
+            constexpr measurement as_measurement() const noexcept {
+
+                return measurement(this->value_, quantity::units());
+
+            }
+
+
+            /**
+             * @brief Get the conversion factor from a quantity with the same unit_base and another unit_prefix
+             *
+             * @tparam OtherPrefix: unit_prefix to convert from
+             *
+             * @return constexpr scalar
+             */
+            template <unit_prefix OtherPrefix>
+            static constexpr scalar factor_from() noexcept {
+
+                constexpr scalar factor = OtherPrefix.factor(Prefix);
+
+                return factor;
+
+            }
+
+
+        private:
+
+        // =============================================
+        // class members
+        // =============================================
+
+            scalar value_; ///< The numerical value of the quantity expressed in its units
+
+
+    }; // class quantity
+
+
+    // =============================================
+    // arithmetic operators
+    // =============================================
+
+    /**
+     * @brief Sum two quantities with the same unit_base
+     *
+     * @note The result is expressed with the unit_prefix of the left operand
+     */
+    template <unit_base Base, unit_prefix P1, unit_prefix P2>
+    constexpr quantity<Base, P1> operator+(const quantity<Base, P1>& q1,
+                                           const quantity<Base, P2>& q2) noexcept {
+
+        return quantity<Base, P1>(q1.value() + q2.value() * quantity<Base, P1>::template factor_from<P2>());
+
+    }
+
+
+    /**
+     * @brief Subtract two quantities with the same unit_base
+     *
+     * @note The result is expressed with the unit_prefix of the left operand
+     */
+    template <unit_base Base, unit_prefix P1, unit_prefix P2>
+    constexpr quantity<Base, P1> operator-(const quantity<Base, P1>& q1,
+                                           const quantity<Base, P2>& q2) noexcept {
+
+        return quantity<Base, P1>(q1.value() - q2.value() * quantity<Base, P1>::template factor_from<P2>());
+
+    }
+
+
+    /// @brief Multiply two quantities, the resulting unit is computed at compile time
+    template <unit_base B1, unit_prefix P1, unit_base B2, unit_prefix P2>
+    constexpr quantity<B1 * B2, P1 * P2> operator*(const quantity<B1, P1>& q1,
+                                                   const quantity<B2, P2>& q2) noexcept {
+
+        return quantity<B1 * B2, P1 * P2>(q1.value() * q2.value());
+
+    }
+
+
+    /**
+     * @brief Divide two quantities, the resulting unit is computed at compile time
+     *
+     * @note No check is performed on the divisor
+     */
+    template <unit_base B1, unit_prefix P1, unit_base B2, unit_prefix P2>
+    constexpr quantity<B1 / B2, P1 / P2> operator/(const quantity<B1, P1>& q1,
+                                                   const quantity<B2, P2>& q2) noexcept {
+
+        return quantity<B1 / B2, P1 / P2>(q1.value() / q2.value());
+
+    }
+
+
+    /// @brief Multiply a quantity and a scalar
+    template <unit_base Base, unit_prefix Prefix>
+    constexpr quantity<Base, Prefix> operator*(const quantity<Base, Prefix>& q,
+                                               const scalar& scal) noexcept {
+
+        return quantity<Base, Prefix>(q.value() * scal);
+
+    }
+
+
+    /// @brief Multiply a scalar and a quantity
+    template <unit_base Base, unit_prefix Prefix>
+    constexpr quantity<Base, Prefix> operator*(const scalar& scal,
+                                               const quantity<Base, Prefix>& q) noexcept {
+
+        return quantity<Base, Prefix>(scal * q.value());
+
+    }
+
+
+    /// @brief Divide a quantity by a scalar
+    template <unit_base Base, unit_prefix Prefix>
+    constexpr quantity<Base, Prefix> operator/(const quantity<Base, Prefix>& q,
+                                               const scalar& scal) noexcept {
+
+        return quantity<Base, Prefix>(q.value() / scal);
+
+    }
+
+
+    /// @brief Divide a scalar by a quantity
+    template <unit_base Base, unit_prefix Prefix>
+    constexpr quantity<Base.inv(), Prefix.inv()> operator/(const scalar& scal,
+                                                           const quantity<Base, Prefix>& q) noexcept {
+
+        return quantity<Base.inv(), Prefix.inv()>(scal / q.value());
+
+    }
+
+
+    // =============================================
+    // comparison operators
+    // =============================================
+
+    /// @brief Equality operator between quantities with the same unit_base
+    template <unit_base Base, unit_prefix P1, unit_prefix P2>
+    constexpr bool operator==(const quantity<Base, P1>& q1,
+                              const quantity<Base, P2>& q2) noexcept {
+
+        return q1.value() == q2.value() * quantity<Base, P1>::template factor_from<P2>();
+
+    }
+
+
+    /// @brief Inequality operator between quantities with the same unit_base
+    template <unit_base Base, unit_prefix P1, unit_prefix P2>
+    constexpr bool operator!=(const quantity<Base, P1>& q1,
+                              const quantity<Base, P2>& q2) noexcept {
+
+        return q1.value() != q2.value() * quantity<Base, P1>::template factor_from<P2>();
+
+    }
+
+
+    /// @brief Less than operator between quantities with the same unit_base
+    template <unit_base Base, unit_prefix P1, unit_prefix P2>
+    constexpr bool operator<(const quantity<Base, P1>& q1,
+                             const quantity<Base, P2>& q2) noexcept {
+
+        return q1.value() < q2.value() * quantity<Base, P1>::template factor_from<P2>();
+
+    }
+
+
+    /// @brief More than operator between quantities with the same unit_base
+    template <unit_base Base, unit_prefix P1, unit_prefix P2>
+    constexpr bool operator>(const quantity<Base, P1>& q1,
+                             const quantity<Base, P2>& q2) noexcept {
+
+        return q1.value() > q2.value() * quantity<Base, P1>::template factor_from<P2>();
+
+    }
+
+
+    /// @brief Less than or equal operator between quantities with the same unit_base
+    template <unit_base Base, unit_prefix P1, unit_prefix P2>
+    constexpr bool operator<=(const quantity<Base, P1>& q1,
+                              const quantity<Base, P2>& q2) noexcept {
+
+        return q1.value() <= q2.value() * quantity<Base, P1>::template factor_from<P2>();
+
+    }
+
+
+    /// @brief More than or equal operator between quantities with the same unit_base
+    template <unit_base Base, unit_prefix P1, unit_prefix P2>
+    constexpr bool operator>=(const quantity<Base, P1>& q1,
+                              const quantity<Base, P2>& q2) noexcept {
+
+        return q1.value() >= q2.value() * quantity<Base, P1>::template factor_from<P2>();
+
+    }
+
+
+    // =============================================
+    // operations
+    // =============================================
+
+    /// @brief Get the absolute value of a quantity
+    template <unit_base Base, unit_prefix Prefix>
+    constexpr quantity<Base, Prefix> abs(const quantity<Base, Prefix>& q) noexcept {
+
+        return (q.value() < 0.0) ? -q : q;
+
+    }
+
+
+    /// @brief Take the square of a quantity
+    template <unit_base Base, unit_prefix Prefix>
+    constexpr quantity<Base.square(), Prefix.square()> square(const quantity<Base, Prefix>& q) noexcept {
+
+        return quantity<Base.square(), Prefix.square()>(q.value() * q.value());
+
+    }
+
+
+    /// @brief Take the cube of a quantity
+    template <unit_base Base, unit_prefix Prefix>
+    constexpr quantity<Base.cube(), Prefix.cube()> cube(const quantity<Base, Prefix>& q) noexcept {
+
+        return quantity<Base.cube(), Prefix.cube()>(q.value() * q.value() * q.value());
+
+    }
+
+
+    /// @brief Take the power of a quantity
+    template <int Power, unit_base Base, unit_prefix Prefix>
+    inline quantity<Base.pow(Power), Prefix.pow(Power)> pow(const quantity<Base, Prefix>& q) noexcept {
+
+        return quantity<Base.pow(Power), Prefix.pow(Power)>(std::pow(q.value(), Power));
+
+    }
+
+
+    /// @brief Take the square root of a quantity
+    template <unit_base Base, unit_prefix Prefix>
+        requires (Base.has_valid_root(2))
+    inline quantity<Base.sqrt(), Prefix.sqrt()> sqrt(const quantity<Base, Prefix>& q) noexcept {
+
+        return quantity<Base.sqrt(), Prefix.sqrt()>(std::sqrt(q.value()));
+
+    }
+
+
+    /// @brief Take the cubic root of a quantity
+    template <unit_base Base, unit_prefix Prefix>
+        requires (Base.has_valid_root(3))
+    inline quantity<Base.cbrt(), Prefix.cbrt()> cbrt(const quantity<Base, Prefix>& q) noexcept {
+
+        return quantity<Base.cbrt(), Prefix.cbrt()>(std::cbrt(q.value()));
+
+    }
+
+
+    /**
+     * @brief Convert a quantity to a quantity with the same unit_base and another unit_prefix
+     *
+     * @tparam Target: unit_prefix of the result
+     */
+    template <unit_prefix Target, unit_base Base, unit_prefix Prefix>
+    constexpr quantity<Base, Target> quantity_cast(const quantity<Base, Prefix>& q) noexcept {
+
+        return quantity<Base, Target>(q);
+
+    }
+
+
+    static_assert(sizeof(quantity<basis::metre>) == sizeof(scalar), "quantity must not store anything but its value");
+
+
+} // namespace measurements
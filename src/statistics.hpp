@@ -0,0 +1,309 @@
+/**
+ * @file    statistics.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the reductions combining many umeasurements, as the weighted mean, the chi-square and the Birge ratio
+ * @date    2023-01-31
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    /**
+     * @brief Compensated sum with the Neumaier variant of the Kahan summation
+     */
+    struct compensated_sum {
+
+        scalar sum{0.0}; ///< running sum
+
+        scalar compensation{0.0}; ///< lost low-order bits
+
+
+        /// @brief Add a term
+        constexpr void add(const scalar& term) noexcept {
+
+            const scalar t = this->sum + term;
+            if (std::fabs(this->sum) >= std::fabs(term))
+                this->compensation += (this->sum - t) + term;
+            else
+                this->compensation += (term - t) + this->sum;
+            this->sum = t;
+
+        }
+
+
+        /// @brief Add another compensated_sum
+        constexpr void add(const compensated_sum& other) noexcept {
+
+            this->add(other.sum);
+            this->add(other.compensation);
+
+        }
+
+
+        /// @brief Get the compensated result
+        constexpr scalar result() const noexcept { return this->sum + this->compensation; }
+
+    };
+
+
+    namespace statistics {
+
+
+        constexpr std::size_t chunk_size{1 << 14}; ///< Number of elements of a chunk, the unit of work of a thread
+
+
+        /**
+         * @brief Compute compensated sums over a range of indices, splitting it in chunks of fixed size
+         *
+         * @tparam N: number of sums
+         * @param size: number of indices
+         * @param terms: callable as terms(std::size_t index) returning std::array<scalar, N>
+         * @param threads: number of threads, 0 means one per hardware thread
+         *
+         * @return std::array<scalar, N>
+         *
+         * @note The chunks do not depend on the number of threads and are combined in order, so the result is deterministic
+         */
+        template <std::size_t N, typename Terms>
+        std::array<scalar, N> reduce(const std::size_t& size, Terms&& terms, const unsigned& threads) {
+
+            const std::size_t chunks = (size + chunk_size - 1) / chunk_size;
+            std::vector<std::array<compensated_sum, N>> partials(chunks);
+
+            parallel::for_each(chunks, [&](const std::size_t& chunk) {
+
+                const std::size_t last = std::min(size, (chunk + 1) * chunk_size);
+                for (std::size_t i = chunk * chunk_size; i < last; ++i) {
+
+                    const std::array<scalar, N> term = terms(i);
+                    for (std::size_t k{0}; k < N; ++k)
+                        partials[chunk][k].add(term[k]);
+
+                }
+
+            }, threads);
+
+            std::array<compensated_sum, N> total{};
+            for (const std::array<compensated_sum, N>& partial : partials)
+                for (std::size_t k{0}; k < N; ++k)
+                    total[k].add(partial[k]);
+
+            std::array<scalar, N> result;
+            for (std::size_t k{0}; k < N; ++k)
+                result[k] = total[k].result();
+
+            return result;
+
+        }
+
+
+        /// @brief Throw if an umeasurement_view cannot be weighted
+        inline void check_weights(const umeasurement_view& data) {
+
+            if (data.empty())
+                throw_invalid_argument("Cannot combine an empty dataset");
+
+            for (const scalar& uncertainty : data.uncertainties())
+                if (!(uncertainty > 0.0))
+                    throw_invalid_argument("Cannot weight an umeasurement with zero uncertainty");
+
+        }
+
+
+        /// @brief Copy a range of umeasurements in columns, converted to the units of the first one
+        struct columns {
+
+            std::vector<scalar> values;
+
+            std::vector<scalar> uncertainties;
+
+            unit units;
+
+
+            explicit columns(std::span<const umeasurement> data) :
+
+                values(),
+                uncertainties(),
+                units(data.empty() ? unit() : data.front().units()) {
+
+                this->values.reserve(data.size());
+                this->uncertainties.reserve(data.size());
+                for (const umeasurement& umeas : data) {
+
+                    if (umeas.units().base() != this->units.base())
+                        throw_invalid_argument("Cannot combine umeasurements with different unit_base", measurement_errc::unit_mismatch);
+
+                    const scalar factor = umeas.units().convertion_factor(this->units);
+                    this->values.push_back(factor * umeas.value());
+                    this->uncertainties.push_back(std::fabs(factor) * umeas.uncertainty());
+
+                }
+
+            }
+
+
+            umeasurement_view view() const { return { this->values, this->uncertainties, this->units }; }
+
+        };
+
+
+    } // namespace statistics
+
+
+    /**
+     * @brief Compute the weighted mean of umeasurements, with the weights 1/σ²
+     *
+     * @param data: umeasurement_view as l-value const reference, an umeasurement_array converts implicitly
+     * @param threads: number of threads, 0 means one per hardware thread
+     *
+     * @return umeasurement, with uncertainty 1/sqrt(Σ 1/σ²)
+     *
+     * @note Every uncertainty must be positive
+     */
+    inline umeasurement weighted_mean(const umeasurement_view& data, const unsigned& threads = 0) {
+
+        statistics::check_weights(data);
+
+        const scalar* x = data.values().data();
+        const scalar* s = data.uncertainties().data();
+        const auto [weights, weighted_values] = statistics::reduce<2>(data.size(), [&](const std::size_t& i) noexcept {
+
+            const scalar w = 1.0 / (s[i] * s[i]);
+            return std::array<scalar, 2>{ w, w * x[i] };
+
+        }, threads);
+
+        return { weighted_values / weights, 1.0 / std::sqrt(weights), data.units() };
+
+    }
+
+
+    /**
+     * @brief Compute the arithmetic mean of umeasurements, with the simple uncertainty summation method
+     *
+     * @param data: umeasurement_view as l-value const reference, an umeasurement_array converts implicitly
+     * @param threads: number of threads, 0 means one per hardware thread
+     *
+     * @return umeasurement, with uncertainty Σσ / n
+     */
+    inline umeasurement simple_mean(const umeasurement_view& data, const unsigned& threads = 0) {
+
+        if (data.empty())
+            throw_invalid_argument("Cannot combine an empty dataset");
+
+        const scalar* x = data.values().data();
+        const scalar* s = data.uncertainties().data();
+        const auto [values, uncertainties] = statistics::reduce<2>(data.size(), [&](const std::size_t& i) noexcept {
+
+            return std::array<scalar, 2>{ x[i], s[i] };
+
+        }, threads);
+
+        const scalar size = static_cast<scalar>(data.size());
+
+        return { values / size, uncertainties / size, data.units() };
+
+    }
+
+
+    /**
+     * @brief Compute the chi-square of umeasurements with respect to a reference value
+     *
+     * @param data: umeasurement_view as l-value const reference, an umeasurement_array converts implicitly
+     * @param reference: measurement with the same unit_base of data
+     * @param threads: number of threads, 0 means one per hardware thread
+     *
+     * @return scalar, Σ ((x - reference) / σ)²
+     */
+    inline scalar chi_square(const umeasurement_view& data, const measurement& reference, const unsigned& threads = 0) {
+
+        statistics::check_weights(data);
+        if (reference.units().base() != data.units().base())
+            throw_invalid_argument("Cannot compute the chi-square with respect to a measurement with different unit_base", measurement_errc::unit_mismatch);
+
+        const scalar mu = reference.units().convertion_factor(data.units()) * reference.value();
+        const scalar* x = data.values().data();
+        const scalar* s = data.uncertainties().data();
+
+        return statistics::reduce<1>(data.size(), [&](const std::size_t& i) noexcept {
+
+            const scalar residual = (x[i] - mu) / s[i];
+            return std::array<scalar, 1>{ residual * residual };
+
+        }, threads)[0];
+
+    }
+
+
+    /**
+     * @brief Compute the chi-square of umeasurements with respect to their weighted mean
+     *
+     * @param data: umeasurement_view as l-value const reference, an umeasurement_array converts implicitly
+     * @param threads: number of threads, 0 means one per hardware thread
+     *
+     * @return scalar
+     */
+    inline scalar chi_square(const umeasurement_view& data, const unsigned& threads = 0) {
+
+        return chi_square(data, weighted_mean(data, threads).as_measurement(), threads);
+
+    }
+
+
+    /**
+     * @brief Compute the Birge ratio of umeasurements, sqrt(χ² / (n - 1)) with respect to their weighted mean
+     *
+     * @param data: umeasurement_view as l-value const reference, an umeasurement_array converts implicitly
+     * @param threads: number of threads, 0 means one per hardware thread
+     *
+     * @return scalar, close to 1 if the uncertainties are consistent with the scatter of the values
+     */
+    inline scalar birge_ratio(const umeasurement_view& data, const unsigned& threads = 0) {
+
+        if (data.size() < 2)
+            throw_invalid_argument("Cannot compute the Birge ratio of less than two umeasurements");
+
+        return std::sqrt(chi_square(data, threads) / static_cast<scalar>(data.size() - 1));
+
+    }
+
+
+    /// @brief Compute the weighted mean of a range of umeasurements, converted to the units of the first one
+    inline umeasurement weighted_mean(std::span<const umeasurement> data, const unsigned& threads = 0) {
+
+        return weighted_mean(statistics::columns(data).view(), threads);
+
+    }
+
+
+    /// @brief Compute the arithmetic mean of a range of umeasurements, converted to the units of the first one
+    inline umeasurement simple_mean(std::span<const umeasurement> data, const unsigned& threads = 0) {
+
+        return simple_mean(statistics::columns(data).view(), threads);
+
+    }
+
+
+    /// @brief Compute the chi-square of a range of umeasurements with respect to their weighted mean
+    inline scalar chi_square(std::span<const umeasurement> data, const unsigned& threads = 0) {
+
+        return chi_square(statistics::columns(data).view(), threads);
+
+    }
+
+
+    /// @brief Compute the Birge ratio of a range of umeasurements
+    inline scalar birge_ratio(std::span<const umeasurement> data, const unsigned& threads = 0) {
+
+        return birge_ratio(statistics::columns(data).view(), threads);
+
+    }
+
+
+} // namespace measurements
@@ -0,0 +1,348 @@
+/**
+ * @file    text_reader.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the umeasurement_table struct and the functions reading it
+ *          from delimited text files, as rows of value, uncertainty and unit
+ * @date    2023-01-25
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    /**
+     * @brief Columns of umeasurements read from a text file, stored as structure of arrays
+     *
+     * @note Every row stores the index of its unit in the dictionary of the table, so that rows with different units can share the same columns
+     * @see read_table
+     */
+    struct umeasurement_table {
+
+        using container = std::vector<scalar, aligned_allocator<scalar>>;
+
+
+        container values; ///< Values of the rows
+
+        container uncertainties; ///< Uncertainties of the rows
+
+        std::vector<uint16_t> unit_ids; ///< Index of the units of the rows in the dictionary
+
+        std::vector<unit> units; ///< Dictionary of the units
+
+
+        /// @brief Get the number of rows of the table
+        std::size_t size() const noexcept { return this->values.size(); }
+
+        /// @brief Check if the table is empty
+        bool empty() const noexcept { return this->values.empty(); }
+
+
+        /**
+         * @brief Get a row of the table
+         *
+         * @param index: position of the row
+         *
+         * @return umeasurement
+         */
+        umeasurement operator[](const std::size_t& index) const {
+
+            return { this->values[index], this->uncertainties[index], this->units[this->unit_ids[index]] };
+
+        }
+
+
+        /**
+         * @brief Gather the rows of the table in an umeasurement_array
+         *
+         * @param units: unit of the umeasurement_array as l-value const reference
+         *
+         * @return umeasurement_array
+         *
+         * @note Every row is converted to units, which must have the same unit_base of every unit of the dictionary
+         */
+        umeasurement_array to_array(const unit& units) const {
+
+            std::vector<scalar> factors;
+            factors.reserve(this->units.size());
+            for (const unit& row_units : this->units)
+                factors.push_back(units::convertion_factor(row_units, units));
+
+            umeasurement_array result(units);
+            result.resize(this->size());
+            const std::span<scalar> values = result.values();
+            const std::span<scalar> uncertainties = result.uncertainties();
+            for (std::size_t i{0}; i < this->size(); ++i) {
+
+                const scalar factor = factors[this->unit_ids[i]];
+                values[i] = factor * this->values[i];
+                uncertainties[i] = std::fabs(factor) * this->uncertainties[i];
+
+            }
+
+            return result;
+
+        }
+
+    };
+
+
+    /**
+     * @brief Parse the rows of value, uncertainty and unit of a delimited text, using several threads
+     *
+     * @param text: content of the file
+     * @param delimiter: separator of the fields, as '\t' or ','
+     * @param threads: number of threads, 0 means one per hardware thread
+     *
+     * @return umeasurement_table
+     *
+     * @note The text is split in chunks aligned to the newlines, which are parsed independently with std::from_chars:
+     *       every chunk resolves each distinct unit string only once, then the chunks are merged in order
+     * @note Spaces around the fields and empty lines are ignored, a row without the unit field is unitless
+     * @note The first malformed row throws a std::runtime_error with its line number
+     */
+    inline umeasurement_table parse_table(std::string_view text, const char& delimiter = '\t', const unsigned& threads = 0) {
+
+        // chunks of about 1 MiB, at least one per thread
+        constexpr std::size_t chunk_size{1 << 20};
+        const unsigned workers = parallel::concurrency(threads);
+        const std::size_t chunks = std::max<std::size_t>(std::min<std::size_t>(workers, text.size() / 4096 + 1), (text.size() + chunk_size - 1) / chunk_size);
+
+        std::vector<std::size_t> bounds(chunks + 1, text.size());
+        bounds[0] = 0;
+        for (std::size_t i{1}; i < chunks; ++i) {
+
+            const std::size_t newline = text.find('\n', std::max(bounds[i - 1], i * (text.size() / chunks)));
+            bounds[i] = (newline == std::string_view::npos) ? text.size() : newline + 1;
+
+        }
+
+        struct chunk_result {
+
+            std::vector<scalar> values;
+
+            std::vector<scalar> uncertainties;
+
+            std::vector<uint16_t> unit_ids;
+
+            std::vector<std::string_view> unit_strings;
+
+            std::vector<unit> units;
+
+            std::size_t error_offset{std::string_view::npos};
+
+            const char* error{nullptr};
+
+        };
+
+        std::vector<chunk_result> results(chunks);
+
+        parallel::for_each(chunks, [&](const std::size_t& index) {
+
+            chunk_result& result = results[index];
+            const char* ptr = text.data() + bounds[index];
+            const char* const end = text.data() + bounds[index + 1];
+            result.values.reserve(static_cast<std::size_t>(end - ptr) / 16);
+            result.uncertainties.reserve(static_cast<std::size_t>(end - ptr) / 16);
+            result.unit_ids.reserve(static_cast<std::size_t>(end - ptr) / 16);
+
+            const auto skip_blanks = [&](const char* p, const char* last) noexcept {
+
+                while (p != last && (*p == ' ' || (*p == '\t' && delimiter != '\t') || *p == '\r'))
+                    ++p;
+                return p;
+
+            };
+
+            std::size_t last_hit{0};
+            while (ptr != end) {
+
+                const char* const line = ptr;
+                const char* line_end = static_cast<const char*>(std::memchr(ptr, '\n', static_cast<std::size_t>(end - ptr)));
+                ptr = (line_end == nullptr) ? end : line_end + 1;
+                if (line_end == nullptr)
+                    line_end = end;
+
+                const auto fail = [&](const char* message) noexcept {
+
+                    result.error_offset = static_cast<std::size_t>(line - text.data());
+                    result.error = message;
+
+                };
+
+                const char* p = skip_blanks(line, line_end);
+                if (p == line_end)
+                    continue;
+
+                scalar value, uncertainty;
+                std::from_chars_result parsed = std::from_chars(p, line_end, value);
+                if (parsed.ec != std::errc()) {
+
+                    fail("Cannot parse the value");
+                    return;
+
+                }
+
+                p = skip_blanks(parsed.ptr, line_end);
+                if (p == line_end || *p != delimiter) {
+
+                    fail("Missing the uncertainty");
+                    return;
+
+                }
+
+                p = skip_blanks(p + 1, line_end);
+                parsed = std::from_chars(p, line_end, uncertainty);
+                if (parsed.ec != std::errc()) {
+
+                    fail("Cannot parse the uncertainty");
+                    return;
+
+                }
+
+                if (uncertainty < 0.0) {
+
+                    fail("Negative uncertainty");
+                    return;
+
+                }
+
+                // unit field, without the surrounding blanks
+                p = skip_blanks(parsed.ptr, line_end);
+                if (p != line_end && *p != delimiter) {
+
+                    fail("Unexpected character after the uncertainty");
+                    return;
+
+                }
+
+                const char* unit_end = line_end;
+                if (p != line_end) {
+
+                    p = skip_blanks(p + 1, line_end);
+                    while (unit_end != p && (unit_end[-1] == ' ' || unit_end[-1] == '\t' || unit_end[-1] == '\r'))
+                        --unit_end;
+
+                }
+
+                const std::string_view unit_string(p, static_cast<std::size_t>(unit_end - p));
+                if (last_hit >= result.unit_strings.size() || result.unit_strings[last_hit] != unit_string) {
+
+                    last_hit = std::find(result.unit_strings.begin(), result.unit_strings.end(), unit_string) - result.unit_strings.begin();
+                    if (last_hit == result.unit_strings.size()) {
+
+                        const parse_unit_result units = parse_unit(unit_string);
+                        if (units.ec != std::errc() || units.ptr != unit_end) {
+
+                            fail("Cannot parse the unit");
+                            return;
+
+                        }
+
+                        if (last_hit > std::numeric_limits<uint16_t>::max()) {
+
+                            fail("Too many distinct units");
+                            return;
+
+                        }
+
+                        result.unit_strings.push_back(unit_string);
+                        result.units.push_back(units.units);
+
+                    }
+
+                }
+
+                result.values.push_back(value);
+                result.uncertainties.push_back(uncertainty);
+                result.unit_ids.push_back(static_cast<uint16_t>(last_hit));
+
+            }
+
+        }, workers);
+
+        // report the first malformed row
+        const auto failed = std::min_element(results.begin(), results.end(), [](const chunk_result& a, const chunk_result& b) { return a.error_offset < b.error_offset; });
+        if (failed->error != nullptr) {
+
+            const std::size_t line = static_cast<std::size_t>(std::count(text.begin(), text.begin() + failed->error_offset, '\n')) + 1;
+            throw std::runtime_error(std::string(failed->error) + " at line " + std::to_string(line));
+
+        }
+
+        // merge the unit dictionaries and the offsets of the chunks
+        umeasurement_table table;
+        std::vector<std::vector<uint16_t>> remap(chunks);
+        std::vector<std::size_t> offsets(chunks + 1, 0);
+        for (std::size_t i{0}; i < chunks; ++i) {
+
+            for (const unit& units : results[i].units) {
+
+                const std::size_t id = std::find(table.units.begin(), table.units.end(), units) - table.units.begin();
+                if (id == table.units.size()) {
+
+                    if (id > std::numeric_limits<uint16_t>::max())
+                        throw std::runtime_error("Too many distinct units in the table");
+                    table.units.push_back(units);
+
+                }
+
+                remap[i].push_back(static_cast<uint16_t>(id));
+
+            }
+
+            offsets[i + 1] = offsets[i] + results[i].values.size();
+
+        }
+
+        table.values.resize(offsets[chunks]);
+        table.uncertainties.resize(offsets[chunks]);
+        table.unit_ids.resize(offsets[chunks]);
+
+        parallel::for_each(chunks, [&](const std::size_t& index) {
+
+            const chunk_result& result = results[index];
+            std::copy(result.values.begin(), result.values.end(), table.values.begin() + offsets[index]);
+            std::copy(result.uncertainties.begin(), result.uncertainties.end(), table.uncertainties.begin() + offsets[index]);
+            std::transform(result.unit_ids.begin(), result.unit_ids.end(), table.unit_ids.begin() + offsets[index],
+                           [&](const uint16_t& id) { return remap[index][id]; });
+
+        }, workers);
+
+        return table;
+
+    }
+
+
+    /**
+     * @brief Read the rows of value, uncertainty and unit of a delimited text file, using several threads
+     *
+     * @param path: path of the file
+     * @param delimiter: separator of the fields, as '\t' or ','
+     * @param threads: number of threads, 0 means one per hardware thread
+     *
+     * @return umeasurement_table
+     *
+     * @see parse_table
+     */
+    inline umeasurement_table read_table(const std::string& path, const char& delimiter = '\t', const unsigned& threads = 0) {
+
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file)
+            throw std::runtime_error("Cannot open the file " + path);
+
+        std::string text(static_cast<std::size_t>(file.tellg()), '\0');
+        file.seekg(0);
+        if (!file.read(text.data(), static_cast<std::streamsize>(text.size())))
+            throw std::runtime_error("Cannot read the file " + path);
+
+        return parse_table(text, delimiter, threads);
+
+    }
+
+
+} // namespace measurements
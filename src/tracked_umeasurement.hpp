@@ -0,0 +1,685 @@
+/**
+ * @file    tracked_umeasurement.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the definition and implementation of the uncertainty_tape and tracked_umeasurement classes,
+ *          which propagate the uncertainties with reverse-mode automatic differentiation
+ * @date    2023-01-28
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    class tracked_umeasurement;
+
+
+    /**
+     * @brief A class recording the operations on tracked_umeasurements, to propagate the uncertainties of their inputs
+     *
+     * @note Every operation appends a node with the partial derivatives with respect to its operands, then a backward sweep
+     *       accumulates the derivatives of an output with respect to every input: the propagated uncertainty is
+     *       sqrt(Σ (∂f/∂xᵢ σᵢ)²), exact at first order also when the same input is used more than once, as in x * x or x - x
+     * @note The cost of a backward sweep is linear in the number of recorded operations
+     * @note The nodes are stored contiguously and their storage is reused after clear(), which invalidates every tracked_umeasurement of the tape
+     */
+    class uncertainty_tape {
+
+
+        public:
+
+        // =============================================
+        // constructors & destructor
+        // =============================================
+
+            /**
+             * @brief Construct a new empty uncertainty_tape object
+             *
+             * @param capacity: number of operations to reserve
+             */
+            explicit uncertainty_tape(const std::size_t& capacity = 1024) :
+
+                nodes_(),
+                inputs_(),
+                adjoints_() {
+
+                this->nodes_.reserve(capacity);
+
+            }
+
+
+            uncertainty_tape(const uncertainty_tape& other) = delete;
+
+
+            /// @brief Default destructor
+            ~uncertainty_tape() = default;
+
+
+        // =============================================
+        // operators
+        // =============================================
+
+            uncertainty_tape& operator=(const uncertainty_tape& other) = delete;
+
+
+        // =============================================
+        // methods
+        // =============================================
+
+            /**
+             * @brief Record an input
+             *
+             * @param umeas: umeasurement as l-value const reference
+             *
+             * @return tracked_umeasurement
+             *
+             * @note Different inputs are assumed to be independent
+             */
+            tracked_umeasurement variable(const umeasurement& umeas);
+
+
+            /**
+             * @brief Compute the propagated uncertainty of an output
+             *
+             * @param output: tracked_umeasurement as l-value const reference
+             *
+             * @return scalar
+             */
+            scalar uncertainty(const tracked_umeasurement& output);
+
+
+            /**
+             * @brief Compute the propagated covariance of two outputs
+             *
+             * @param lhs: tracked_umeasurement as l-value const reference
+             * @param rhs: tracked_umeasurement as l-value const reference
+             *
+             * @return scalar
+             */
+            scalar covariance(const tracked_umeasurement& lhs, const tracked_umeasurement& rhs);
+
+
+            /**
+             * @brief Compute the derivatives of an output with respect to every input, in the order in which the inputs were recorded
+             *
+             * @param output: tracked_umeasurement as l-value const reference
+             *
+             * @return std::vector<scalar>
+             */
+            std::vector<scalar> gradient(const tracked_umeasurement& output);
+
+
+            /**
+             * @brief Get an output as an umeasurement with the propagated uncertainty
+             *
+             * @param output: tracked_umeasurement as l-value const reference
+             *
+             * @return umeasurement
+             */
+            umeasurement evaluate(const tracked_umeasurement& output);
+
+
+            /// @brief Remove every recorded operation, keeping the storage
+            void clear() noexcept {
+
+                this->nodes_.clear();
+                this->inputs_.clear();
+
+            }
+
+
+            /// @brief Get the number of recorded operations, inputs included
+            std::size_t size() const noexcept { return this->nodes_.size(); }
+
+            /// @brief Get the number of recorded inputs
+            std::size_t inputs() const noexcept { return this->inputs_.size(); }
+
+
+        private:
+
+            friend class tracked_umeasurement;
+
+
+        // =============================================
+        // helpers
+        // =============================================
+
+            /// @brief Recorded operation, with the partial derivatives with respect to at most two operands
+            struct node {
+
+                uint32_t lhs; ///< index of the first operand
+
+                uint32_t rhs; ///< index of the second operand
+
+                scalar dlhs; ///< derivative with respect to the first operand
+
+                scalar drhs; ///< derivative with respect to the second operand
+
+            };
+
+
+            /// @brief Recorded input, with its uncertainty
+            struct input {
+
+                uint32_t index; ///< index of the node of the input
+
+                scalar uncertainty; ///< uncertainty of the input
+
+            };
+
+
+            /// @brief Append a node and get its index
+            uint32_t push(const uint32_t& lhs, const scalar& dlhs, const uint32_t& rhs, const scalar& drhs) {
+
+                if (this->nodes_.size() >= std::numeric_limits<uint32_t>::max())
+                    throw_runtime_error("Too many operations recorded on the uncertainty_tape");
+
+                this->nodes_.push_back({ lhs, rhs, dlhs, drhs });
+
+                return static_cast<uint32_t>(this->nodes_.size() - 1);
+
+            }
+
+
+            /// @brief Accumulate the derivatives of an output with respect to every node in adjoints_
+            void backward(const tracked_umeasurement& output);
+
+
+        // =============================================
+        // class members
+        // =============================================
+
+            std::vector<node> nodes_; ///< Recorded operations
+
+            std::vector<input> inputs_; ///< Recorded inputs
+
+            std::vector<scalar> adjoints_; ///< Derivatives of the last backward sweep
+
+
+    }; // class uncertainty_tape
+
+
+    /**
+     * @brief A class representing a measurement whose uncertainty is propagated through an uncertainty_tape
+     *
+     * @note The operations record their derivatives on the tape of the operands, which must be the same and must outlive them
+     * @see uncertainty_tape
+     */
+    class tracked_umeasurement {
+
+
+        public:
+
+        // =============================================
+        // get methods
+        // =============================================
+
+            /// @brief Get the value
+            constexpr scalar value() const noexcept { return this->value_; }
+
+            /// @brief Get the units
+            constexpr const unit& units() const noexcept { return this->units_; }
+
+            /// @brief Get the tape
+            constexpr uncertainty_tape& tape() const noexcept { return *this->tape_; }
+
+            /// @brief Get the value and the units as a measurement
+            constexpr measurement as_measurement() const noexcept { return { this->value_, this->units_ }; }
+
+
+        // =============================================
+        // operators
+        // =============================================
+
+            /// @brief Negate the tracked_umeasurement
+            friend tracked_umeasurement operator-(const tracked_umeasurement& x) {
+
+                return x.unary(-x.value_, -1.0, x.units_);
+
+            }
+
+
+            /**
+             * @brief Add two tracked_umeasurements, the result has the units of lhs
+             *
+             * @param lhs: tracked_umeasurement as l-value const reference
+             * @param rhs: tracked_umeasurement as l-value const reference
+             *
+             * @return tracked_umeasurement
+             */
+            friend tracked_umeasurement operator+(const tracked_umeasurement& lhs, const tracked_umeasurement& rhs) {
+
+                const scalar factor = lhs.check_addable(rhs, "Cannot add tracked_umeasurements with different unit_base");
+
+                return lhs.binary(rhs, lhs.value_ + factor * rhs.value_, 1.0, factor, lhs.units_);
+
+            }
+
+
+            /**
+             * @brief Subtract two tracked_umeasurements, the result has the units of lhs
+             *
+             * @param lhs: tracked_umeasurement as l-value const reference
+             * @param rhs: tracked_umeasurement as l-value const reference
+             *
+             * @return tracked_umeasurement
+             */
+            friend tracked_umeasurement operator-(const tracked_umeasurement& lhs, const tracked_umeasurement& rhs) {
+
+                const scalar factor = lhs.check_addable(rhs, "Cannot subtract tracked_umeasurements with different unit_base");
+
+                return lhs.binary(rhs, lhs.value_ - factor * rhs.value_, 1.0, -factor, lhs.units_);
+
+            }
+
+
+            /**
+             * @brief Multiply two tracked_umeasurements
+             *
+             * @param lhs: tracked_umeasurement as l-value const reference
+             * @param rhs: tracked_umeasurement as l-value const reference
+             *
+             * @return tracked_umeasurement
+             */
+            friend tracked_umeasurement operator*(const tracked_umeasurement& lhs, const tracked_umeasurement& rhs) {
+
+                return lhs.binary(rhs, lhs.value_ * rhs.value_, rhs.value_, lhs.value_, lhs.units_ * rhs.units_);
+
+            }
+
+
+            /**
+             * @brief Divide two tracked_umeasurements
+             *
+             * @param lhs: tracked_umeasurement as l-value const reference
+             * @param rhs: tracked_umeasurement as l-value const reference
+             *
+             * @return tracked_umeasurement
+             */
+            friend tracked_umeasurement operator/(const tracked_umeasurement& lhs, const tracked_umeasurement& rhs) {
+
+                if (rhs.value_ == 0.0)
+                    throw_runtime_error("Cannot divide a tracked_umeasurement by a zero tracked_umeasurement", measurement_errc::division_by_zero);
+
+                const scalar inv = 1.0 / rhs.value_;
+
+                return lhs.binary(rhs, lhs.value_ * inv, inv, -lhs.value_ * inv * inv, lhs.units_ / rhs.units_);
+
+            }
+
+
+            /// @brief Add a measurement without uncertainty, the result has the units of lhs
+            friend tracked_umeasurement operator+(const tracked_umeasurement& lhs, const measurement& rhs) {
+
+                if (lhs.units_.base() != rhs.units().base())
+                    throw_invalid_argument("Cannot add a tracked_umeasurement and a measurement with different unit_base", measurement_errc::unit_mismatch);
+
+                return lhs.unary(lhs.value_ + rhs.value_as(lhs.units_), 1.0, lhs.units_);
+
+            }
+
+
+            /// @brief Subtract a measurement without uncertainty, the result has the units of lhs
+            friend tracked_umeasurement operator-(const tracked_umeasurement& lhs, const measurement& rhs) {
+
+                if (lhs.units_.base() != rhs.units().base())
+                    throw_invalid_argument("Cannot subtract a tracked_umeasurement and a measurement with different unit_base", measurement_errc::unit_mismatch);
+
+                return lhs.unary(lhs.value_ - rhs.value_as(lhs.units_), 1.0, lhs.units_);
+
+            }
+
+
+            /// @brief Multiply by a measurement without uncertainty
+            friend tracked_umeasurement operator*(const tracked_umeasurement& lhs, const measurement& rhs) {
+
+                return lhs.unary(lhs.value_ * rhs.value(), rhs.value(), lhs.units_ * rhs.units());
+
+            }
+
+
+            /// @brief Multiply a measurement without uncertainty
+            friend tracked_umeasurement operator*(const measurement& lhs, const tracked_umeasurement& rhs) {
+
+                return rhs.unary(lhs.value() * rhs.value_, lhs.value(), lhs.units() * rhs.units_);
+
+            }
+
+
+            /// @brief Divide by a measurement without uncertainty
+            friend tracked_umeasurement operator/(const tracked_umeasurement& lhs, const measurement& rhs) {
+
+                if (rhs.value() == 0.0)
+                    throw_runtime_error("Cannot divide a tracked_umeasurement by a zero measurement", measurement_errc::division_by_zero);
+
+                return lhs.unary(lhs.value_ / rhs.value(), 1.0 / rhs.value(), lhs.units_ / rhs.units());
+
+            }
+
+
+            /// @brief Divide a measurement without uncertainty
+            friend tracked_umeasurement operator/(const measurement& lhs, const tracked_umeasurement& rhs) {
+
+                if (rhs.value_ == 0.0)
+                    throw_runtime_error("Cannot divide a measurement by a zero tracked_umeasurement", measurement_errc::division_by_zero);
+
+                const scalar inv = 1.0 / rhs.value_;
+
+                return rhs.unary(lhs.value() * inv, -lhs.value() * inv * inv, lhs.units() / rhs.units_);
+
+            }
+
+
+            /// @brief Multiply by a scalar
+            friend tracked_umeasurement operator*(const tracked_umeasurement& lhs, const scalar& rhs) {
+
+                return lhs.unary(lhs.value_ * rhs, rhs, lhs.units_);
+
+            }
+
+
+            /// @brief Multiply a scalar
+            friend tracked_umeasurement operator*(const scalar& lhs, const tracked_umeasurement& rhs) {
+
+                return rhs.unary(lhs * rhs.value_, lhs, rhs.units_);
+
+            }
+
+
+            /// @brief Divide by a scalar
+            friend tracked_umeasurement operator/(const tracked_umeasurement& lhs, const scalar& rhs) {
+
+                if (rhs == 0.0)
+                    throw_runtime_error("Cannot divide a tracked_umeasurement by 0", measurement_errc::division_by_zero);
+
+                return lhs.unary(lhs.value_ / rhs, 1.0 / rhs, lhs.units_);
+
+            }
+
+
+            /// @brief Divide a scalar
+            friend tracked_umeasurement operator/(const scalar& lhs, const tracked_umeasurement& rhs) {
+
+                if (rhs.value_ == 0.0)
+                    throw_runtime_error("Cannot divide a scalar by a zero tracked_umeasurement", measurement_errc::division_by_zero);
+
+                const scalar inv = 1.0 / rhs.value_;
+
+                return rhs.unary(lhs * inv, -lhs * inv * inv, rhs.units_.inv());
+
+            }
+
+
+        // =============================================
+        // operations
+        // =============================================
+
+            /**
+             * @brief Raise a tracked_umeasurement to an integer power
+             *
+             * @param x: tracked_umeasurement as l-value const reference
+             * @param power: int as l-value const reference
+             *
+             * @return tracked_umeasurement
+             *
+             * @note The power 0 is a constant with derivative 0, also at x = 0 where 0 * 0^-1 would be NaN
+             */
+            friend tracked_umeasurement pow(const tracked_umeasurement& x, const int& power) {
+
+                const scalar derivative = (power == 0) ? 0.0 : power * std::pow(x.value_, power - 1);
+
+                return x.unary(std::pow(x.value_, power), derivative, x.units_.pow(power));
+
+            }
+
+
+            /**
+             * @brief Take the square root of a tracked_umeasurement
+             *
+             * @param x: tracked_umeasurement as l-value const reference
+             *
+             * @return tracked_umeasurement
+             */
+            friend tracked_umeasurement sqrt(const tracked_umeasurement& x) {
+
+                if (x.value_ < 0.0)
+                    throw_runtime_error("Cannot take the square root of a negative tracked_umeasurement");
+
+                const scalar root = std::sqrt(x.value_);
+
+                return x.unary(root, 0.5 / root, x.units_.sqrt());
+
+            }
+
+
+            /**
+             * @brief Take the exponential of a unitless tracked_umeasurement
+             *
+             * @param x: tracked_umeasurement as l-value const reference
+             *
+             * @return tracked_umeasurement
+             */
+            friend tracked_umeasurement exp(const tracked_umeasurement& x) {
+
+                if (x.units_ != unitless)
+                    throw_runtime_error("Cannot take the exponential of a tracked_umeasurement that is not unitless");
+
+                const scalar value = std::exp(x.value_);
+
+                return x.unary(value, value, unitless);
+
+            }
+
+
+            /**
+             * @brief Take the natural logarithm of a unitless tracked_umeasurement
+             *
+             * @param x: tracked_umeasurement as l-value const reference
+             *
+             * @return tracked_umeasurement
+             */
+            friend tracked_umeasurement log(const tracked_umeasurement& x) {
+
+                if (x.units_ != unitless)
+                    throw_runtime_error("Cannot take the logarithm of a tracked_umeasurement that is not unitless");
+
+                return x.unary(std::log(x.value_), 1.0 / x.value_, unitless);
+
+            }
+
+
+            /**
+             * @brief Take the sine of a tracked_umeasurement in radians
+             *
+             * @param x: tracked_umeasurement as l-value const reference
+             *
+             * @return tracked_umeasurement
+             */
+            friend tracked_umeasurement sin(const tracked_umeasurement& x) {
+
+                if (x.units_ != rad)
+                    throw_runtime_error("Cannot take the sine of a tracked_umeasurement that is not in radians");
+
+                return x.unary(std::sin(x.value_), std::cos(x.value_), unitless);
+
+            }
+
+
+            /**
+             * @brief Take the cosine of a tracked_umeasurement in radians
+             *
+             * @param x: tracked_umeasurement as l-value const reference
+             *
+             * @return tracked_umeasurement
+             */
+            friend tracked_umeasurement cos(const tracked_umeasurement& x) {
+
+                if (x.units_ != rad)
+                    throw_runtime_error("Cannot take the cosine of a tracked_umeasurement that is not in radians");
+
+                return x.unary(std::cos(x.value_), -std::sin(x.value_), unitless);
+
+            }
+
+
+            /**
+             * @brief Print the value and the units of a tracked_umeasurement
+             *
+             * @note The uncertainty requires a backward sweep, see uncertainty_tape::evaluate
+             */
+            friend std::ostream& operator<<(std::ostream& os, const tracked_umeasurement& x) {
+
+                return os << x.as_measurement();
+
+            }
+
+
+        private:
+
+            friend class uncertainty_tape;
+
+
+        // =============================================
+        // helpers
+        // =============================================
+
+            /// @brief Construct a tracked_umeasurement recorded at index of tape
+            constexpr tracked_umeasurement(uncertainty_tape* tape, const uint32_t& index, const scalar& value, const unit& units) noexcept :
+
+                tape_(tape),
+                index_(index),
+                value_(value),
+                units_(units) {}
+
+
+            /// @brief Record an operation of this tracked_umeasurement
+            tracked_umeasurement unary(const scalar& value, const scalar& derivative, const unit& units) const {
+
+                return { this->tape_, this->tape_->push(this->index_, derivative, this->index_, 0.0), value, units };
+
+            }
+
+
+            /// @brief Record an operation of this tracked_umeasurement and other
+            tracked_umeasurement binary(const tracked_umeasurement& other, const scalar& value, const scalar& dlhs, const scalar& drhs, const unit& units) const {
+
+                if (this->tape_ != other.tape_)
+                    throw_invalid_argument("Cannot combine tracked_umeasurements recorded on different tapes");
+
+                return { this->tape_, this->tape_->push(this->index_, dlhs, other.index_, drhs), value, units };
+
+            }
+
+
+            /// @brief Check that other can be added to this tracked_umeasurement and get its convertion factor
+            scalar check_addable(const tracked_umeasurement& other, const char* message) const {
+
+                if (this->units_.base() != other.units_.base())
+                    throw_invalid_argument(message, measurement_errc::unit_mismatch);
+
+                return other.units_.convertion_factor(this->units_);
+
+            }
+
+
+        // =============================================
+        // class members
+        // =============================================
+
+            uncertainty_tape* tape_; ///< Tape recording the operations
+
+            uint32_t index_; ///< Index of the node on the tape
+
+            scalar value_; ///< Value
+
+            unit units_; ///< Units
+
+
+    }; // class tracked_umeasurement
+
+
+    // =============================================
+    // uncertainty_tape methods
+    // =============================================
+
+    inline tracked_umeasurement uncertainty_tape::variable(const umeasurement& umeas) {
+
+        const uint32_t index = this->push(0, 0.0, 0, 0.0);
+        this->inputs_.push_back({ index, umeas.uncertainty() });
+
+        return { this, index, umeas.value(), umeas.units() };
+
+    }
+
+
+    inline void uncertainty_tape::backward(const tracked_umeasurement& output) {
+
+        if (output.tape_ != this)
+            throw_invalid_argument("Cannot propagate a tracked_umeasurement recorded on another tape");
+
+        this->adjoints_.assign(output.index_ + 1, 0.0);
+        this->adjoints_[output.index_] = 1.0;
+
+        // the operands of a node are always recorded before it, so a single reverse sweep visits every node after all its uses
+        for (std::size_t i = output.index_ + 1; i-- > 0; ) {
+
+            const scalar adjoint = this->adjoints_[i];
+            if (adjoint == 0.0)
+                continue;
+
+            const node& current = this->nodes_[i];
+            this->adjoints_[current.lhs] += adjoint * current.dlhs;
+            this->adjoints_[current.rhs] += adjoint * current.drhs;
+
+        }
+
+    }
+
+
+    inline std::vector<scalar> uncertainty_tape::gradient(const tracked_umeasurement& output) {
+
+        this->backward(output);
+
+        std::vector<scalar> result;
+        result.reserve(this->inputs_.size());
+        for (const input& in : this->inputs_)
+            result.push_back((in.index < this->adjoints_.size()) ? this->adjoints_[in.index] : 0.0);
+
+        return result;
+
+    }
+
+
+    inline scalar uncertainty_tape::uncertainty(const tracked_umeasurement& output) {
+
+        return std::sqrt(this->covariance(output, output));
+
+    }
+
+
+    inline scalar uncertainty_tape::covariance(const tracked_umeasurement& lhs, const tracked_umeasurement& rhs) {
+
+        const std::vector<scalar> dlhs = this->gradient(lhs);
+        const std::vector<scalar> drhs = (&lhs == &rhs || lhs.index_ == rhs.index_) ? dlhs : this->gradient(rhs);
+
+        scalar result{0.0};
+        for (std::size_t i{0}; i < this->inputs_.size(); ++i)
+            result += dlhs[i] * drhs[i] * this->inputs_[i].uncertainty * this->inputs_[i].uncertainty;
+
+        return result;
+
+    }
+
+
+    inline umeasurement uncertainty_tape::evaluate(const tracked_umeasurement& output) {
+
+        return { output.value_, this->uncertainty(output), output.units_ };
+
+    }
+
+
+} // namespace measurements
@@ -17,9 +17,14 @@ namespace measurements {
 
     /** 
      * @brief A class for representing a physical quantity with a numerical value, an uncertanty and an unit
+     * 
+     * @tparam T: type of the value and of the uncertainty, as float, double or long double
+     * @note basic_umeasurement<float> takes 32 bytes, against 40 bytes of basic_umeasurement<double>, because the unit takes 24 bytes.
+     *       A stream of float values sharing an unit should be stored in a float_umeasurement_array
      * @see units::unit  
      */
-    class umeasurement {     
+    template <typename T>
+    class basic_umeasurement {     
         
 
         public: 
@@ -29,7 +34,7 @@ namespace measurements {
         // =============================================  
 
             /// @brief default constructor
-            explicit constexpr umeasurement() noexcept = default;
+            explicit constexpr basic_umeasurement() noexcept = default;
 
 
             /**
@@ -42,12 +47,12 @@ namespace measurements {
              * @note The uncertainty must be positive
              * @note The uncertainty must be expressed as the same unit of the measurement
              */
-            constexpr umeasurement(const scalar& value, 
-                                            const scalar& uncertainty, 
+            constexpr basic_umeasurement(const T& value, 
+                                            const T& uncertainty, 
                                             const unit& units) {
 
                 if (uncertainty < 0.0) 
-                    throw std::invalid_argument("Cannot instantiate an umeasurement with a negative uncertainty");
+                    throw_invalid_argument("Cannot instantiate an umeasurement with a negative uncertainty");
 
                 else {
 
@@ -70,12 +75,12 @@ namespace measurements {
              * @note The uncertainty must be positive
              * @note The uncertainty must be expressed as the same unit of the measurement
              */
-            constexpr umeasurement(scalar&& value, 
-                                            scalar&& uncertainty, 
+            constexpr basic_umeasurement(T&& value, 
+                                            T&& uncertainty, 
                                             unit&& units) {
 
                 if (uncertainty < 0.0) 
-                    throw std::invalid_argument("Cannot instantiate an umeasurement with a negative uncertainty");
+                    throw_invalid_argument("Cannot instantiate an umeasurement with a negative uncertainty");
 
                 else {
 
@@ -98,11 +103,11 @@ namespace measurements {
              * @note The uncertainty must be expressed as the same unit of the measurement
              * @note The uncertainty is set to zero by default
              */
-            constexpr umeasurement(const measurement& other, 
-                                            const scalar& uncertainty = 0.0) {
+            constexpr basic_umeasurement(const basic_measurement<T>& other, 
+                                            const T& uncertainty = 0.0) {
 
                 if (uncertainty < 0.0) 
-                    throw std::invalid_argument("Cannot instantiate an umeasurement with a negative uncertainty");
+                    throw_invalid_argument("Cannot instantiate an umeasurement with a negative uncertainty");
 
                 else {
 
@@ -125,11 +130,11 @@ namespace measurements {
              * @note The uncertainty must be expressed as the same unit of the measurement
              * @note The uncertainty is set to zero by default
              */
-            constexpr umeasurement(measurement&& other, 
-                                            scalar&& uncertainty = 0.0) {
+            constexpr basic_umeasurement(basic_measurement<T>&& other, 
+                                            T&& uncertainty = 0.0) {
 
                 if (uncertainty < 0.0) 
-                    throw std::invalid_argument("Cannot instantiate an umeasurement with a negative uncertainty");
+                    throw_invalid_argument("Cannot instantiate an umeasurement with a negative uncertainty");
 
                 else {
 
@@ -152,14 +157,14 @@ namespace measurements {
              * @note The uncertainty value must be positive
              * @note The uncertainty value will be converted to the same units of the value measurement
              */
-            constexpr umeasurement(const measurement& value, 
-                                            const measurement& uncertainty) {
+            constexpr basic_umeasurement(const basic_measurement<T>& value, 
+                                            const basic_measurement<T>& uncertainty) {
                         
                 if (value.units_.base_ != uncertainty.units_.base_) 
-                    throw std::invalid_argument("Cannot instantiate an umeasurement with two measurements that have not the same base_unit");
+                    throw_invalid_argument("Cannot instantiate an umeasurement with two measurements that have not the same base_unit", measurement_errc::unit_mismatch);
 
                 if (uncertainty.value_ < 0.0) 
-                    throw std::invalid_argument("Cannot instantiate an umeasurement with a negative uncertainty");
+                    throw_invalid_argument("Cannot instantiate an umeasurement with a negative uncertainty");
 
                 else {
 
@@ -182,14 +187,14 @@ namespace measurements {
              * @note The uncertainty value must be positive
              * @note The uncertainty value will be converted to the same units of the value measurement
              */
-            constexpr umeasurement(measurement&& value, 
-                                            measurement&& uncertainty) {
+            constexpr basic_umeasurement(basic_measurement<T>&& value, 
+                                            basic_measurement<T>&& uncertainty) {
                         
                 if (value.units_.base_ != uncertainty.units_.base_) 
-                    throw std::invalid_argument("Cannot instantiate an umeasurement with two measurements that have not the same base_unit");
+                    throw_invalid_argument("Cannot instantiate an umeasurement with two measurements that have not the same base_unit", measurement_errc::unit_mismatch);
 
                 if (uncertainty.value_ < 0.0) 
-                    throw std::invalid_argument("Cannot instantiate an umeasurement with a negative uncertainty");
+                    throw_invalid_argument("Cannot instantiate an umeasurement with a negative uncertainty");
 
                 else {
 
@@ -207,7 +212,7 @@ namespace measurements {
              * 
              * @param other: umeasurement as a l-value const reference
              */
-            constexpr umeasurement(const umeasurement& other) noexcept :
+            constexpr basic_umeasurement(const basic_umeasurement& other) noexcept :
 
                 value_{other.value_},
                 uncertainty_{other.uncertainty_},
@@ -219,7 +224,7 @@ namespace measurements {
              * 
              * @param other: umeasurement to move from as a r-value reference
              */
-            constexpr umeasurement(umeasurement&& other) noexcept :
+            constexpr basic_umeasurement(basic_umeasurement&& other) noexcept :
 
                 value_{std::move(other.value_)},
                 uncertainty_{std::move(other.uncertainty_)},
@@ -227,7 +232,7 @@ namespace measurements {
 
 
             /// @brief default destructor
-            ~umeasurement() = default;
+            ~basic_umeasurement() = default;
             
 
         // =============================================                                                                                         
@@ -241,7 +246,7 @@ namespace measurements {
              * 
              * @return uncertai_measurement& 
              */
-            constexpr umeasurement& operator=(const umeasurement& other) noexcept {
+            constexpr basic_umeasurement& operator=(const basic_umeasurement& other) noexcept {
                 
                 this->value_ = other.value_;
                 this->uncertainty_ = other.uncertainty_; 
@@ -259,7 +264,7 @@ namespace measurements {
              * 
              * @return uncertai_measurement& 
              */
-            constexpr umeasurement& operator=(umeasurement&& other) noexcept {
+            constexpr basic_umeasurement& operator=(basic_umeasurement&& other) noexcept {
                 
                 this->value_ = std::move(other.value_);
                 this->uncertainty_ = std::move(other.uncertainty_); 
@@ -277,7 +282,7 @@ namespace measurements {
              * 
              * @return uncertai_measurement& 
              */
-            constexpr umeasurement& operator=(const measurement& other) noexcept {
+            constexpr basic_umeasurement& operator=(const basic_measurement<T>& other) noexcept {
                 
                 this->value_ = other.value_;
                 this->uncertainty_ = 0.0; 
@@ -295,7 +300,7 @@ namespace measurements {
              * 
              * @return uncertai_measurement& 
              */
-            constexpr umeasurement& operator=(measurement&& other) noexcept {
+            constexpr basic_umeasurement& operator=(basic_measurement<T>&& other) noexcept {
                 
                 this->value_ = std::move(other.value_);
                 this->uncertainty_ = 0.0; 
@@ -313,14 +318,14 @@ namespace measurements {
              *  
              * @return umeasurement 
              */
-            umeasurement operator*(const umeasurement& other) const noexcept {
+            basic_umeasurement operator*(const basic_umeasurement& other) const noexcept {
 
-                scalar tval1 = this->uncertainty_ / this->value_;
-                scalar tval2 = other.uncertainty_ / other.value_;
-                scalar nunc = std::sqrt(std::pow(tval1, 2) + std::pow(tval2, 2));
-                scalar nval = this->value_ * other.value_;
+                T tval1 = this->uncertainty_ / this->value_;
+                T tval2 = other.uncertainty_ / other.value_;
+                T nunc = std::sqrt(std::pow(tval1, 2) + std::pow(tval2, 2));
+                T nval = this->value_ * other.value_;
 
-                return { nval, std::fabs(nval) * nunc, this->units_ * other.units_ };
+                return basic_umeasurement(nval, std::fabs(nval) * nunc, this->units_ * other.units_);
 
             }
     
@@ -332,14 +337,14 @@ namespace measurements {
              *  
              * @return umeasurement 
              */
-            umeasurement operator*(umeasurement&& other) const noexcept {
+            basic_umeasurement operator*(basic_umeasurement&& other) const noexcept {
 
-                scalar tval1 = this->uncertainty_ / this->value_;
-                scalar tval2 = other.uncertainty_ / other.value_;
-                scalar ntol = std::sqrt(std::pow(tval1, 2) + std::pow(tval2, 2));
-                scalar nval = this->value_ * other.value_;
+                T tval1 = this->uncertainty_ / this->value_;
+                T tval2 = other.uncertainty_ / other.value_;
+                T ntol = std::sqrt(std::pow(tval1, 2) + std::pow(tval2, 2));
+                T nval = this->value_ * other.value_;
 
-                return { nval, std::fabs(nval) * ntol, this->units_ * other.units_ };
+                return basic_umeasurement(nval, std::fabs(nval) * ntol, this->units_ * other.units_);
 
             }
     
@@ -351,12 +356,12 @@ namespace measurements {
              * 
              * @return umeasurement 
              */
-            umeasurement simple_product(const umeasurement& other) const noexcept {
+            basic_umeasurement simple_product(const basic_umeasurement& other) const noexcept {
                 
-                scalar ntol = this->uncertainty_ / std::fabs(this->value_) + other.uncertainty_ / std::fabs(other.value_);
-                scalar nval = this->value_ * other.value_;
+                T ntol = this->uncertainty_ / std::fabs(this->value_) + other.uncertainty_ / std::fabs(other.value_);
+                T nval = this->value_ * other.value_;
 
-                return { nval, std::fabs(nval) * ntol, this->units_ * other.units_ };
+                return basic_umeasurement(nval, std::fabs(nval) * ntol, this->units_ * other.units_);
             
             }
 
@@ -368,12 +373,12 @@ namespace measurements {
              * 
              * @return umeasurement 
              */
-            umeasurement simple_product(umeasurement&& other) const noexcept {
+            basic_umeasurement simple_product(basic_umeasurement&& other) const noexcept {
                 
-                scalar nunc = this->uncertainty_ / std::fabs(this->value_) + other.uncertainty_ / std::fabs(other.value_);
-                scalar nval = this->value_ * other.value_;
+                T nunc = this->uncertainty_ / std::fabs(this->value_) + other.uncertainty_ / std::fabs(other.value_);
+                T nval = this->value_ * other.value_;
 
-                return { nval, std::fabs(nval) * nunc, this->units_ * other.units_ };
+                return basic_umeasurement(nval, std::fabs(nval) * nunc, this->units_ * other.units_);
             
             }
 
@@ -385,9 +390,9 @@ namespace measurements {
              *  
              * @return umeasurement 
              */
-            inline umeasurement operator*(const measurement& other) const noexcept {
+            inline basic_umeasurement operator*(const basic_measurement<T>& other) const noexcept {
                 
-                return { this->value_ * other.value_, std::fabs(other.value_) * this->uncertainty_, this->units_ * other.units_ };
+                return basic_umeasurement(this->value_ * other.value_, std::fabs(other.value_) * this->uncertainty_, this->units_ * other.units_);
             
             }
 
@@ -399,9 +404,9 @@ namespace measurements {
              *  
              * @return umeasurement 
              */
-            inline umeasurement operator*(measurement&& other) const noexcept {
+            inline basic_umeasurement operator*(basic_measurement<T>&& other) const noexcept {
                 
-                return { this->value_ * other.value_, std::fabs(other.value_) * this->uncertainty_, this->units_ * other.units_ };
+                return basic_umeasurement(this->value_ * other.value_, std::fabs(other.value_) * this->uncertainty_, this->units_ * other.units_);
             
             }
 
@@ -413,9 +418,9 @@ namespace measurements {
              * 
              * @return umeasurement 
              */
-            inline umeasurement operator*(const scalar& val) const noexcept { 
+            inline basic_umeasurement operator*(const T& val) const noexcept { 
                 
-                return { val * this->value_, std::fabs(val) * this->uncertainty_, this->units_ }; 
+                return basic_umeasurement(val * this->value_, std::fabs(val) * this->uncertainty_, this->units_);
             
             }
 
@@ -427,9 +432,9 @@ namespace measurements {
              * 
              * @return umeasurement 
              */
-            inline umeasurement operator*(scalar&& val) const noexcept { 
+            inline basic_umeasurement operator*(T&& val) const noexcept { 
                 
-                return { val * this->value_, std::fabs(val) * this->uncertainty_, this->units_ }; 
+                return basic_umeasurement(val * this->value_, std::fabs(val) * this->uncertainty_, this->units_);
             
             }
 
@@ -441,17 +446,17 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement operator/(const umeasurement& other) const {
+            constexpr basic_umeasurement operator/(const basic_umeasurement& other) const {
                 
                 if (other.value_ == 0.0) 
-                    throw std::invalid_argument("Cannot divide umeasurement by 0");
+                    throw_runtime_error("Cannot divide umeasurement by 0", measurement_errc::division_by_zero);
 
-                scalar tval1 = this->uncertainty_ / this->value_;
-                scalar tval2 = other.uncertainty_ / other.value_;
-                scalar ntol = std::sqrt(std::pow(tval1, 2) + std::pow(tval2, 2));
-                scalar nval = this->value_ / other.value_;
+                T tval1 = this->uncertainty_ / this->value_;
+                T tval2 = other.uncertainty_ / other.value_;
+                T ntol = std::sqrt(std::pow(tval1, 2) + std::pow(tval2, 2));
+                T nval = this->value_ / other.value_;
 
-                return { nval, std::fabs(nval) * ntol, this->units_ / other.units_ };
+                return basic_umeasurement(nval, std::fabs(nval) * ntol, this->units_ / other.units_);
             
             }
 
@@ -463,17 +468,17 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement operator/(umeasurement&& other) const {
+            constexpr basic_umeasurement operator/(basic_umeasurement&& other) const {
                 
                 if (other.value_ == 0.0) 
-                    throw std::invalid_argument("Cannot divide umeasurement by 0");
+                    throw_runtime_error("Cannot divide umeasurement by 0", measurement_errc::division_by_zero);
 
-                scalar tval1 = this->uncertainty_ / this->value_;
-                scalar tval2 = other.uncertainty_ / other.value_;
-                scalar ntol = std::sqrt(std::pow(tval1, 2) + std::pow(tval2, 2));
-                scalar nval = this->value_ / other.value_;
+                T tval1 = this->uncertainty_ / this->value_;
+                T tval2 = other.uncertainty_ / other.value_;
+                T ntol = std::sqrt(std::pow(tval1, 2) + std::pow(tval2, 2));
+                T nval = this->value_ / other.value_;
 
-                return { nval, std::fabs(nval) * ntol, this->units_ / other.units_ };
+                return basic_umeasurement(nval, std::fabs(nval) * ntol, this->units_ / other.units_);
             
             }
 
@@ -485,15 +490,15 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement simple_divide(const umeasurement& other) const {
+            constexpr basic_umeasurement simple_divide(const basic_umeasurement& other) const {
                 
                 if (other.value_ == 0.0) 
-                    throw std::invalid_argument("Cannot divide umeasurement by 0");
+                    throw_runtime_error("Cannot divide umeasurement by 0", measurement_errc::division_by_zero);
 
-                scalar ntol = this->uncertainty_ / std::fabs(this->value_) + other.uncertainty_ / std::fabs(other.value_);
-                scalar nval = this->value_ / other.value_;
+                T ntol = this->uncertainty_ / std::fabs(this->value_) + other.uncertainty_ / std::fabs(other.value_);
+                T nval = this->value_ / other.value_;
 
-                return { nval, std::fabs(nval) * ntol, this->units_ / other.units_ };
+                return basic_umeasurement(nval, std::fabs(nval) * ntol, this->units_ / other.units_);
             
             }
 
@@ -505,15 +510,15 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement simple_divide(umeasurement&& other) const {
+            constexpr basic_umeasurement simple_divide(basic_umeasurement&& other) const {
                 
                 if (other.value_ == 0.0) 
-                    throw std::invalid_argument("Cannot divide umeasurement by 0");
+                    throw_runtime_error("Cannot divide umeasurement by 0", measurement_errc::division_by_zero);
 
-                scalar ntol = this->uncertainty_ / std::fabs(this->value_) + other.uncertainty_ / std::fabs(other.value_);
-                scalar nval = this->value_ / other.value_;
+                T ntol = this->uncertainty_ / std::fabs(this->value_) + other.uncertainty_ / std::fabs(other.value_);
+                T nval = this->value_ / other.value_;
 
-                return { nval, std::fabs(nval) * ntol, this->units_ / other.units_ };
+                return basic_umeasurement(nval, std::fabs(nval) * ntol, this->units_ / other.units_);
             
             }
 
@@ -525,12 +530,12 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement operator/(const measurement& other) const {
+            constexpr basic_umeasurement operator/(const basic_measurement<T>& other) const {
                 
                 if (other.value_ == 0.0) 
-                    throw std::invalid_argument("Cannot divide umeasurement by 0");
+                    throw_runtime_error("Cannot divide umeasurement by 0", measurement_errc::division_by_zero);
 
-                return { this->value_ / other.value_, this->uncertainty_ / std::fabs(other.value_), this->units_ / other.units_ };
+                return basic_umeasurement(this->value_ / other.value_, this->uncertainty_ / std::fabs(other.value_), this->units_ / other.units_);
             
             }
 
@@ -542,12 +547,12 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement operator/(measurement&& other) const {
+            constexpr basic_umeasurement operator/(basic_measurement<T>&& other) const {
                 
                 if (other.value_ == 0.0) 
-                    throw std::invalid_argument("Cannot divide umeasurement by 0");
+                    throw_runtime_error("Cannot divide umeasurement by 0", measurement_errc::division_by_zero);
 
-                return { this->value_ / other.value_, this->uncertainty_ / std::fabs(other.value_), this->units_ / other.units_ };
+                return basic_umeasurement(this->value_ / other.value_, this->uncertainty_ / std::fabs(other.value_), this->units_ / other.units_);
             
             }
 
@@ -559,12 +564,12 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement operator/(const scalar& val) const {
+            constexpr basic_umeasurement operator/(const T& val) const {
 
                 if (val == 0.0) 
-                    throw std::invalid_argument("Cannot divide umeasurement by 0");
+                    throw_runtime_error("Cannot divide umeasurement by 0", measurement_errc::division_by_zero);
 
-                return { this->value_ / val, this->uncertainty_ / std::fabs(val), this->units_ };
+                return basic_umeasurement(this->value_ / val, this->uncertainty_ / std::fabs(val), this->units_);
             
             }
 
@@ -576,12 +581,12 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement operator/(scalar&& val) const {
+            constexpr basic_umeasurement operator/(T&& val) const {
 
                 if (val == 0.0) 
-                    throw std::invalid_argument("Cannot divide umeasurement by 0");
+                    throw_runtime_error("Cannot divide umeasurement by 0", measurement_errc::division_by_zero);
 
-                return { this->value_ / val, this->uncertainty_ / std::fabs(val), this->units_ };
+                return basic_umeasurement(this->value_ / val, this->uncertainty_ / std::fabs(val), this->units_);
             
             }
 
@@ -593,15 +598,15 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement operator+(const umeasurement& other) const {
+            constexpr basic_umeasurement operator+(const basic_umeasurement& other) const {
                 
                 if (this->units_.base_ != other.units_.base_) 
-                    throw std::invalid_argument("Cannot add umeasurements with different unit bases");
+                    throw_invalid_argument("Cannot add umeasurements with different unit bases", measurement_errc::unit_mismatch);
 
-                scalar cval = other.units_.convertion_factor(this->units_);
-                scalar ntol = std::sqrt(std::pow(this->uncertainty_, 2) + std::pow(cval * other.uncertainty_, 2));
+                T cval = other.units_.convertion_factor(this->units_);
+                T ntol = std::sqrt(std::pow(this->uncertainty_, 2) + std::pow(cval * other.uncertainty_, 2));
 
-                return { this->value_ + cval * other.value_, ntol, this->units_ };
+                return basic_umeasurement(this->value_ + cval * other.value_, ntol, this->units_);
             
             }
 
@@ -613,15 +618,15 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement operator+(umeasurement&& other) const {
+            constexpr basic_umeasurement operator+(basic_umeasurement&& other) const {
                 
                 if (this->units_.base_ != other.units_.base_) 
-                    throw std::invalid_argument("Cannot add umeasurements with different unit bases");
+                    throw_invalid_argument("Cannot add umeasurements with different unit bases", measurement_errc::unit_mismatch);
 
-                scalar cval = other.units_.convertion_factor(this->units_);
-                scalar ntol = std::sqrt(std::pow(this->uncertainty_, 2) + std::pow(cval * other.uncertainty_, 2));
+                T cval = other.units_.convertion_factor(this->units_);
+                T ntol = std::sqrt(std::pow(this->uncertainty_, 2) + std::pow(cval * other.uncertainty_, 2));
 
-                return { this->value_ + cval * other.value_, ntol, this->units_ };
+                return basic_umeasurement(this->value_ + cval * other.value_, ntol, this->units_);
             
             }
 
@@ -633,15 +638,15 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement simple_add(const umeasurement& other) const {
+            constexpr basic_umeasurement simple_add(const basic_umeasurement& other) const {
                 
                 if (this->units_.base_ != other.units_.base_) 
-                    throw std::invalid_argument("Cannot add umeasurements with different unit bases");
+                    throw_invalid_argument("Cannot add umeasurements with different unit bases", measurement_errc::unit_mismatch);
 
-                scalar cval = other.units_.convertion_factor(this->units_);
-                scalar ntol = this->uncertainty_ + other.uncertainty_ * cval;
+                T cval = other.units_.convertion_factor(this->units_);
+                T ntol = this->uncertainty_ + other.uncertainty_ * cval;
 
-                return { this->value_ + cval * other.value_, ntol, this->units_ };
+                return basic_umeasurement(this->value_ + cval * other.value_, ntol, this->units_);
             
             }
 
@@ -653,15 +658,15 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement simple_add(umeasurement&& other) const {
+            constexpr basic_umeasurement simple_add(basic_umeasurement&& other) const {
                 
                 if (this->units_.base_ != other.units_.base_) 
-                    throw std::invalid_argument("Cannot add umeasurements with different unit bases");
+                    throw_invalid_argument("Cannot add umeasurements with different unit bases", measurement_errc::unit_mismatch);
 
-                scalar cval = other.units_.convertion_factor(this->units_);
-                scalar ntol = this->uncertainty_ + other.uncertainty_ * cval;
+                T cval = other.units_.convertion_factor(this->units_);
+                T ntol = this->uncertainty_ + other.uncertainty_ * cval;
 
-                return { this->value_ + cval * other.value_, ntol, this->units_ };
+                return basic_umeasurement(this->value_ + cval * other.value_, ntol, this->units_);
             
             }
 
@@ -673,12 +678,12 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement operator+(const measurement& other) const {
+            constexpr basic_umeasurement operator+(const basic_measurement<T>& other) const {
                 
                 if (this->units_.base_ != other.units_.base_) 
-                    throw std::invalid_argument("Cannot add umeasurement and measurement with different unit bases");
+                    throw_invalid_argument("Cannot add umeasurement and measurement with different unit bases", measurement_errc::unit_mismatch);
 
-                return { this->value_ + other.value_as(this->units_), this->uncertainty_, this->units_ };
+                return basic_umeasurement(this->value_ + other.value_as(this->units_), this->uncertainty_, this->units_);
             
             }
 
@@ -690,12 +695,12 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement operator+(measurement&& other) const {
+            constexpr basic_umeasurement operator+(basic_measurement<T>&& other) const {
                 
                 if (this->units_.base_ != other.units_.base_) 
-                    throw std::invalid_argument("Cannot add umeasurement and measurement with different unit bases");
+                    throw_invalid_argument("Cannot add umeasurement and measurement with different unit bases", measurement_errc::unit_mismatch);
 
-                return { this->value_ + other.value_as(this->units_), this->uncertainty_, this->units_ };
+                return basic_umeasurement(this->value_ + other.value_as(this->units_), this->uncertainty_, this->units_);
             
             }
 
@@ -705,9 +710,9 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement operator-() const noexcept {
+            constexpr basic_umeasurement operator-() const noexcept {
 
-                return { -this->value_, this->uncertainty_, this->units_ };
+                return basic_umeasurement(-this->value_, this->uncertainty_, this->units_);
             
             }
             
@@ -719,15 +724,15 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement operator-(const umeasurement& other) const {
+            constexpr basic_umeasurement operator-(const basic_umeasurement& other) const {
                 
                 if (this->units_.base_ != other.units_.base_) 
-                    throw std::invalid_argument("Cannot subtract umeasurements with different unit bases");
+                    throw_invalid_argument("Cannot subtract umeasurements with different unit bases", measurement_errc::unit_mismatch);
 
-                scalar cval = other.units_.convertion_factor(this->units_);
-                scalar ntol = std::sqrt(std::pow(this->uncertainty_, 2) + std::pow(cval * other.uncertainty_, 2));
+                T cval = other.units_.convertion_factor(this->units_);
+                T ntol = std::sqrt(std::pow(this->uncertainty_, 2) + std::pow(cval * other.uncertainty_, 2));
 
-                return { this->value_ - cval * other.value_, ntol, this->units_ };
+                return basic_umeasurement(this->value_ - cval * other.value_, ntol, this->units_);
             
             }
 
@@ -739,15 +744,15 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement operator-(umeasurement&& other) const {
+            constexpr basic_umeasurement operator-(basic_umeasurement&& other) const {
                 
                 if (this->units_.base_ != other.units_.base_) 
-                    throw std::invalid_argument("Cannot subtract umeasurements with different unit bases");
+                    throw_invalid_argument("Cannot subtract umeasurements with different unit bases", measurement_errc::unit_mismatch);
 
-                scalar cval = other.units_.convertion_factor(this->units_);
-                scalar ntol = std::sqrt(std::pow(this->uncertainty_, 2) + std::pow(cval * other.uncertainty_, 2));
+                T cval = other.units_.convertion_factor(this->units_);
+                T ntol = std::sqrt(std::pow(this->uncertainty_, 2) + std::pow(cval * other.uncertainty_, 2));
 
-                return { this->value_ - cval * other.value_, ntol, this->units_ };
+                return basic_umeasurement(this->value_ - cval * other.value_, ntol, this->units_);
             
             }
 
@@ -759,15 +764,15 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement simple_subtract(const umeasurement& other) const {
+            constexpr basic_umeasurement simple_subtract(const basic_umeasurement& other) const {
                 
                 if (this->units_.base_ != other.units_.base_) 
-                    throw std::invalid_argument("Cannot subtract umeasurements with different unit bases");
+                    throw_invalid_argument("Cannot subtract umeasurements with different unit bases", measurement_errc::unit_mismatch);
 
-                scalar cval = other.units_.convertion_factor(this->units_);
-                scalar ntol = this->uncertainty_ + other.uncertainty_ * cval;
+                T cval = other.units_.convertion_factor(this->units_);
+                T ntol = this->uncertainty_ + other.uncertainty_ * cval;
 
-                return { this->value_ - cval * other.value_, ntol, this->units_ };
+                return basic_umeasurement(this->value_ - cval * other.value_, ntol, this->units_);
             
             }
 
@@ -779,15 +784,15 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement simple_subtract(umeasurement&& other) const {
+            constexpr basic_umeasurement simple_subtract(basic_umeasurement&& other) const {
                 
                 if (this->units_.base_ != other.units_.base_) 
-                    throw std::invalid_argument("Cannot subtract umeasurements with different unit bases");
+                    throw_invalid_argument("Cannot subtract umeasurements with different unit bases", measurement_errc::unit_mismatch);
 
-                scalar cval = other.units_.convertion_factor(this->units_);
-                scalar ntol = this->uncertainty_ + other.uncertainty_ * cval;
+                T cval = other.units_.convertion_factor(this->units_);
+                T ntol = this->uncertainty_ + other.uncertainty_ * cval;
 
-                return { this->value_ - cval * other.value_, ntol, this->units_ };
+                return basic_umeasurement(this->value_ - cval * other.value_, ntol, this->units_);
             
             }
 
@@ -799,12 +804,12 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement operator-(const measurement& other) const {
+            constexpr basic_umeasurement operator-(const basic_measurement<T>& other) const {
 
                 if (this->units_.base_ != other.units_.base_) 
-                    throw std::invalid_argument("Cannot subtract umeasurement and measurement with different unit bases");
+                    throw_invalid_argument("Cannot subtract umeasurement and measurement with different unit bases", measurement_errc::unit_mismatch);
 
-                return { this->value_ - other.value_as(this->units_), this->uncertainty_, this->units_ };
+                return basic_umeasurement(this->value_ - other.value_as(this->units_), this->uncertainty_, this->units_);
             
             }
 
@@ -816,12 +821,12 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement operator-(measurement&& other) const {
+            constexpr basic_umeasurement operator-(basic_measurement<T>&& other) const {
 
                 if (this->units_.base_ != other.units_.base_) 
-                    throw std::invalid_argument("Cannot subtract umeasurement and measurement with different unit bases");
+                    throw_invalid_argument("Cannot subtract umeasurement and measurement with different unit bases", measurement_errc::unit_mismatch);
 
-                return { this->value_ - other.value_as(this->units_), this->uncertainty_, this->units_ };
+                return basic_umeasurement(this->value_ - other.value_as(this->units_), this->uncertainty_, this->units_);
             
             }
 
@@ -833,7 +838,7 @@ namespace measurements {
              * 
              * @return bool
              */
-            constexpr bool operator==(const measurement& other) const noexcept {
+            constexpr bool operator==(const basic_measurement<T>& other) const noexcept {
                 
                 if (this->uncertainty_ == 0.0) 
                     return this->value_ == other.value_as(this->units_); 
@@ -851,9 +856,9 @@ namespace measurements {
              * 
              * @return bool
              */
-            constexpr bool operator==(const umeasurement& other) const noexcept { 
+            constexpr bool operator==(const basic_umeasurement& other) const noexcept { 
                 
-                return this->simple_subtract(other) == measurement(0.0, this->units_); 
+                return this->simple_subtract(other) == basic_measurement<T>(0.0, this->units_); 
                 
             }
 
@@ -865,7 +870,7 @@ namespace measurements {
              * 
              * @return bool
              */
-            constexpr bool operator!=(const measurement& other) const noexcept { 
+            constexpr bool operator!=(const basic_measurement<T>& other) const noexcept { 
                 
                 return !operator==(other); 
                 
@@ -879,7 +884,7 @@ namespace measurements {
              * 
              * @return bool
              */
-            constexpr bool operator!=(const umeasurement& other) const noexcept { 
+            constexpr bool operator!=(const basic_umeasurement& other) const noexcept { 
                 
                 return !operator==(other); 
                 
@@ -893,7 +898,7 @@ namespace measurements {
              * 
              * @return bool
              */
-            constexpr bool operator>(const umeasurement& other) const noexcept { 
+            constexpr bool operator>(const basic_umeasurement& other) const noexcept { 
                 
                 return this->value_ > other.value_as(this->units_); 
                 
@@ -907,7 +912,7 @@ namespace measurements {
              * 
              * @return bool
              */
-            constexpr bool operator>(const measurement& other) const noexcept { 
+            constexpr bool operator>(const basic_measurement<T>& other) const noexcept { 
                 
                 return this->value_ > other.value_as(this->units_); 
                 
@@ -921,7 +926,7 @@ namespace measurements {
              * 
              * @return bool
              */
-            constexpr bool operator>(const scalar& val) const noexcept { 
+            constexpr bool operator>(const T& val) const noexcept { 
                 
                 return this->value_ > val; 
                 
@@ -935,7 +940,7 @@ namespace measurements {
              * 
              * @return bool
              */
-            constexpr bool operator<(const umeasurement& other) const noexcept { 
+            constexpr bool operator<(const basic_umeasurement& other) const noexcept { 
                 
                 return this->value_ < other.value_as(this->units_); 
                 
@@ -949,7 +954,7 @@ namespace measurements {
              * 
              * @return bool
              */
-            constexpr bool operator<(const measurement& other) const noexcept { 
+            constexpr bool operator<(const basic_measurement<T>& other) const noexcept { 
                 
                 return this->value_ < other.value_as(this->units_); 
                 
@@ -963,7 +968,7 @@ namespace measurements {
              * 
              * @return bool
              */
-            constexpr bool operator<(const scalar& val) const noexcept { 
+            constexpr bool operator<(const T& val) const noexcept { 
                 
                 return this->value_ < val; 
                 
@@ -977,7 +982,7 @@ namespace measurements {
              * 
              * @return bool
              */
-            constexpr bool operator>=(const umeasurement& other) const noexcept {
+            constexpr bool operator>=(const basic_umeasurement& other) const noexcept {
                 
                 return this->simple_subtract(other).value_ >= 0.0;
             
@@ -991,7 +996,7 @@ namespace measurements {
              * 
              * @return bool
              */
-            constexpr bool operator>=(const measurement& other) const noexcept {
+            constexpr bool operator>=(const basic_measurement<T>& other) const noexcept {
                 
                 return this->value_ >= other.value_as(this->units_); 
             
@@ -1005,7 +1010,7 @@ namespace measurements {
              * 
              * @return bool
              */
-            constexpr bool operator>=(const scalar& val) const noexcept { 
+            constexpr bool operator>=(const T& val) const noexcept { 
 
                 return this->value_ >= val; 
                 
@@ -1019,7 +1024,7 @@ namespace measurements {
              * 
              * @return bool
              */
-            constexpr bool operator<=(const umeasurement& other) const noexcept {
+            constexpr bool operator<=(const basic_umeasurement& other) const noexcept {
                 
                 return this->simple_subtract(other).value_ <= 0.0; 
             
@@ -1033,7 +1038,7 @@ namespace measurements {
              * 
              * @return bool
              */
-            constexpr bool operator<=(const measurement& other) const noexcept {
+            constexpr bool operator<=(const basic_measurement<T>& other) const noexcept {
                 
                 return (this->value_ <= other.value_as(this->units_)); 
             
@@ -1047,7 +1052,7 @@ namespace measurements {
              * 
              * @return bool
              */
-            constexpr bool operator<=(const scalar& val) const noexcept { 
+            constexpr bool operator<=(const T& val) const noexcept { 
 
                 return this->value_ <= val; 
                 
@@ -1062,8 +1067,8 @@ namespace measurements {
              *  
              * @return umeasurement 
              */
-            friend inline umeasurement operator*(const measurement& meas, 
-                                                 const umeasurement& umeas) noexcept { 
+            friend inline basic_umeasurement operator*(const basic_measurement<T>& meas, 
+                                                       const basic_umeasurement& umeas) noexcept { 
                                 
                 return umeas.operator*(meas); 
                             
@@ -1078,8 +1083,8 @@ namespace measurements {
              * 
              * @return umeasurement 
              */
-            friend inline umeasurement operator*(const scalar& value, 
-                                          const umeasurement& umeas) noexcept { 
+            friend inline basic_umeasurement operator*(const T& value, 
+                                          const basic_umeasurement& umeas) noexcept { 
                                 
                 return umeas.operator*(value); 
                             
@@ -1094,16 +1099,16 @@ namespace measurements {
              *  
              * @return constexpr umeasurement 
              */
-            friend constexpr umeasurement operator/(const measurement& meas, 
-                                                             const umeasurement& umeas) {
+            friend constexpr basic_umeasurement operator/(const basic_measurement<T>& meas, 
+                                                             const basic_umeasurement& umeas) {
                                                         
                 if (umeas.value_ == 0.0) 
-                    throw std::runtime_error("Cannot divide a measurement by a zero umeasurement");
+                    throw_runtime_error("Cannot divide a measurement by a zero umeasurement", measurement_errc::division_by_zero);
 
-                scalar ntol = umeas.uncertainty_ / umeas.value_;
-                scalar nval = meas.value() / umeas.value_;
+                T ntol = umeas.uncertainty_ / umeas.value_;
+                T nval = meas.value() / umeas.value_;
 
-                return umeasurement(nval, std::fabs(nval * ntol), meas.units() / umeas.units_);
+                return basic_umeasurement(nval, std::fabs(nval * ntol), meas.units() / umeas.units_);
             
             }
 
@@ -1116,15 +1121,15 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            friend constexpr umeasurement operator/(const scalar& v1, 
-                                                             const umeasurement& umeas) {
+            friend constexpr basic_umeasurement operator/(const T& v1, 
+                                                             const basic_umeasurement& umeas) {
 
                 if (umeas.value_ == 0.0) 
-                    throw std::runtime_error("Cannot divide a scalar by a zero umeasurement");
+                    throw_runtime_error("Cannot divide a scalar by a zero umeasurement", measurement_errc::division_by_zero);
 
-                scalar ntol = umeas.uncertainty_ / umeas.value_;
-                scalar nval = v1 / umeas.value_;
-                return umeasurement(nval, std::fabs(nval * ntol), umeas.units_.inv());
+                T ntol = umeas.uncertainty_ / umeas.value_;
+                T nval = v1 / umeas.value_;
+                return basic_umeasurement(nval, std::fabs(nval * ntol), umeas.units_.inv());
             
             }
 
@@ -1137,16 +1142,16 @@ namespace measurements {
              *  
              * @return constexpr umeasurement 
              */
-            friend constexpr umeasurement operator+(const measurement& meas, 
-                                                             const umeasurement& umeas) {
+            friend constexpr basic_umeasurement operator+(const basic_measurement<T>& meas, 
+                                                             const basic_umeasurement& umeas) {
                 
                 if (meas.units().base_ != umeas.units_.base_) 
-                    throw std::invalid_argument("Cannot sum measurement and umeasurement with different unit bases");
+                    throw_invalid_argument("Cannot sum measurement and umeasurement with different unit bases", measurement_errc::unit_mismatch);
 
-                scalar cval = umeas.units_.convertion_factor(meas.units());
-                scalar ntol = umeas.uncertainty_ * cval;
+                T cval = umeas.units_.convertion_factor(meas.units());
+                T ntol = umeas.uncertainty_ * cval;
 
-                return umeasurement(meas.value() + cval * umeas.value_, ntol, meas.units());
+                return basic_umeasurement(meas.value() + cval * umeas.value_, ntol, meas.units());
             
             }
 
@@ -1159,16 +1164,16 @@ namespace measurements {
              *  
              * @return constexpr umeasurement 
              */
-            friend constexpr umeasurement operator-(const measurement& meas, 
-                                                             const umeasurement& umeas) {
+            friend constexpr basic_umeasurement operator-(const basic_measurement<T>& meas, 
+                                                             const basic_umeasurement& umeas) {
 
                 if (meas.units().base_ != umeas.units_.base_) 
-                    throw std::invalid_argument("Cannot sum measurement and umeasurement with different unit bases");
+                    throw_invalid_argument("Cannot sum measurement and umeasurement with different unit bases", measurement_errc::unit_mismatch);
 
-                scalar cval = umeas.units_.convertion_factor(meas.units());
-                scalar ntol = umeas.uncertainty_ * cval;
+                T cval = umeas.units_.convertion_factor(meas.units());
+                T ntol = umeas.uncertainty_ * cval;
 
-                return umeasurement(meas.value() - cval * umeas.value_, ntol, meas.units());
+                return basic_umeasurement(meas.value() - cval * umeas.value_, ntol, meas.units());
             
             }
 
@@ -1181,8 +1186,8 @@ namespace measurements {
              * 
              * @return bool
              */
-            friend constexpr bool operator==(const measurement& meas, 
-                                             const umeasurement& umeas) noexcept { 
+            friend constexpr bool operator==(const basic_measurement<T>& meas, 
+                                             const basic_umeasurement& umeas) noexcept { 
                 
                 return umeas == meas; 
             
@@ -1197,8 +1202,8 @@ namespace measurements {
              * 
              * @return bool
              */
-            friend constexpr bool operator!=(const measurement& meas, 
-                                             const umeasurement& umeas) noexcept { 
+            friend constexpr bool operator!=(const basic_measurement<T>& meas, 
+                                             const basic_umeasurement& umeas) noexcept { 
                 
                 return umeas != meas; 
             
@@ -1213,8 +1218,8 @@ namespace measurements {
              * 
              * @return bool
              */
-            friend constexpr bool operator>(const measurement& meas, 
-                                            const umeasurement& umeas) noexcept { 
+            friend constexpr bool operator>(const basic_measurement<T>& meas, 
+                                            const basic_umeasurement& umeas) noexcept { 
                 
                 return meas.value() > umeas.value_; 
             
@@ -1229,8 +1234,8 @@ namespace measurements {
              * 
              * @return bool
              */
-            friend constexpr bool operator<(const measurement& meas, 
-                                            const umeasurement& umeas) noexcept { 
+            friend constexpr bool operator<(const basic_measurement<T>& meas, 
+                                            const basic_umeasurement& umeas) noexcept { 
                 
                 return meas.value() < umeas.value_; 
             
@@ -1245,8 +1250,8 @@ namespace measurements {
              * 
              * @return bool
              */
-            friend constexpr bool operator>=(const measurement& meas, 
-                                             const umeasurement& umeas) noexcept { 
+            friend constexpr bool operator>=(const basic_measurement<T>& meas, 
+                                             const basic_umeasurement& umeas) noexcept { 
                 
                 return (meas > umeas) ? true : (umeas == meas); 
             
@@ -1262,8 +1267,8 @@ namespace measurements {
             * @return bool
             * 
             */
-            friend constexpr bool operator<=(const measurement& meas, 
-                                             const umeasurement& umeas) noexcept { 
+            friend constexpr bool operator<=(const basic_measurement<T>& meas, 
+                                             const basic_umeasurement& umeas) noexcept { 
                 
                 return (meas < umeas) ? true : (umeas == meas); 
             
@@ -1281,9 +1286,41 @@ namespace measurements {
              * 
              * @return std::ostream&
              */
-            friend std::ostream& operator<<(std::ostream& os, const umeasurement& umeas) noexcept { 
+            friend std::ostream& operator<<(std::ostream& os, const basic_umeasurement& umeas) noexcept { 
 
-                scalar abs_value = std::fabs(umeas.value_);
+                char buffer[basic_umeasurement::max_chars];
+                const std::to_chars_result result = to_chars(buffer, buffer + basic_umeasurement::max_chars, umeas);
+                if (result.ec != std::errc()) 
+                    os.setstate(std::ios_base::failbit);
+                else 
+                    os.write(buffer, result.ptr - buffer);
+                
+                return os; 
+                
+            }
+
+
+            /**
+             * @brief Write the umeasurement in a buffer as "(value ± uncertainty) unit", without allocating
+             * 
+             * @param first: begin of the buffer
+             * @param last: end of the buffer
+             * @param umeas: umeasurement as l-value const reference
+             * 
+             * @return std::to_chars_result
+             * 
+             * @note The value is rounded to the first significative digit of the uncertainty, 
+             *       the scientific notation is used for values or uncertainties outside (1e-4, 1e4)
+             * @note umeasurement::max_chars is always enough
+             */
+            friend std::to_chars_result to_chars(char* first, char* last, const basic_umeasurement& umeas) noexcept { 
+
+                // check if the uncertainty needs to be printed
+                if (umeas.uncertainty_ == 0.0) 
+                    return to_chars(first, last, umeas.as_measurement()); 
+
+                instrumentation::count(instrumentation::counter::format);
+                T abs_value = std::fabs(umeas.value_);
                 
                 // first significative digit positions
                 int32_t n_val = ((umeas.uncertainty_ >= 1) ? 
@@ -1303,33 +1340,40 @@ namespace measurements {
                                                     (umeas.uncertainty_ >= 1e4) || 
                                                     (umeas.uncertainty_ <= 1e-4);
 
-                // check if the uncertainty needs to be printed
-                if (umeas.uncertainty_ == 0.0) 
-                    os << umeas.as_measurement(); 
-                
-                // check if scientific notation is needed
-                if (scientific_notation_needed) {
+                const std::chars_format fmt = scientific_notation_needed ? std::chars_format::scientific : std::chars_format::fixed;
+                const int value_prec = scientific_notation_needed ? std::min(prec, std::numeric_limits<T>::max_digits10) : 
+                                            ((umeas.uncertainty_ >= 1.) ? 0 : std::abs(n_unc));
+                const int unc_prec = scientific_notation_needed ? 0 : value_prec;
 
-                    os << std::scientific; 
-                    os << std::setprecision(prec) << "(" << umeas.value_ << " ± "; 
-                    os << std::setprecision(0) << umeas.uncertainty_ << ") " << umeas.units_;
+                const auto put = [&](std::string_view text) noexcept {
 
-                } else {
+                    if (static_cast<std::size_t>(last - first) < text.size()) 
+                        return false;
+                    first = std::copy(text.begin(), text.end(), first);
+                    return true;
 
-                    os << std::fixed; 
+                };
 
-                    if (umeas.uncertainty_ >= 1.) 
-                        os << std::setprecision(0); 
-                    else 
-                        os << std::setprecision(std::fabs(n_unc)); 
-                        
-                    os << "(" << umeas.value_ << " ± " << umeas.uncertainty_ << ") " << umeas.units_;
+                if (!put("(")) 
+                    return { last, std::errc::value_too_large };
 
-                }
+                std::to_chars_result result = std::to_chars(first, last, umeas.value_, fmt, value_prec);
+                if (result.ec != std::errc()) 
+                    return result;
+                first = result.ptr;
 
-                os << std::defaultfloat << std::setprecision(6);
-                
-                return os; 
+                if (!put(" ± ")) 
+                    return { last, std::errc::value_too_large };
+
+                result = std::to_chars(first, last, umeas.uncertainty_, fmt, unc_prec);
+                if (result.ec != std::errc()) 
+                    return result;
+                first = result.ptr;
+
+                if (!put(") ")) 
+                    return { last, std::errc::value_too_large };
+
+                return to_chars(first, last, umeas.units_);
                 
             }
 
@@ -1342,8 +1386,9 @@ namespace measurements {
              * 
              * @return std::ofstream&
              */
-            friend std::ofstream& operator<<(std::ofstream& file, const umeasurement& umeas) noexcept { 
+            friend std::ofstream& operator<<(std::ofstream& file, const basic_umeasurement& umeas) noexcept { 
 
+                instrumentation::count(instrumentation::counter::format);
                 file << umeas.value_ << '\t' << umeas.uncertainty_ << '\t' << umeas.units_;
                 
                 return file; 
@@ -1359,11 +1404,15 @@ namespace measurements {
              * 
              * @return std::ifstream&
              */
-            friend std::ifstream& operator>>(std::ifstream& file, umeasurement& umeas) noexcept { 
+            friend std::ifstream& operator>>(std::ifstream& file, basic_umeasurement& umeas) noexcept { 
 
                 std::string unit_string; 
                 file >> umeas.value_ >> umeas.uncertainty_ >> unit_string; 
-                umeas.units_ = unit(unit_string);
+                const parse_unit_result result = parse_unit(unit_string);
+                if (result.ec != std::errc() || result.ptr != unit_string.data() + unit_string.size()) 
+                    file.setstate(std::ios_base::failbit);
+                else 
+                    umeas.units_ = result.units;
 
                 return file;
             
@@ -1381,7 +1430,7 @@ namespace measurements {
              * 
              * @return constexpr umeasurement
              */
-            friend constexpr umeasurement abs(const umeasurement& umeas) noexcept { 
+            friend constexpr basic_umeasurement abs(const basic_umeasurement& umeas) noexcept { 
                 
                 return (umeas.value_ < 0.0) ? -umeas : umeas; 
             
@@ -1396,12 +1445,12 @@ namespace measurements {
              * @note Cannot invert an umeasurement with a zero value
              * @note The uncertainty is not inverted
              */
-            constexpr umeasurement inv() const { 
+            constexpr basic_umeasurement inv() const { 
                 
                 if (this->value_ == 0) 
-                    throw std::runtime_error("Cannot invert an umeasurement with a zero value");
+                    throw_runtime_error("Cannot invert an umeasurement with a zero value", measurement_errc::division_by_zero);
 
-                return { 1 / this->value_, this->uncertainty_ / std::pow(this->value_, 2), this->units_.inv() };
+                return basic_umeasurement(1 / this->value_, this->uncertainty_ / std::pow(this->value_, 2), this->units_.inv());
                 
             } 
 
@@ -1416,12 +1465,12 @@ namespace measurements {
              * @note Cannot invert an umeasurement with a zero value
              * @note The uncertainty is not inverted
              */
-            friend constexpr umeasurement inv(const umeasurement& umeas) { 
+            friend constexpr basic_umeasurement inv(const basic_umeasurement& umeas) { 
                 
                 if (umeas.value_ == 0) 
-                    throw std::runtime_error("Cannot invert an umeasurement with a zero value");
+                    throw_runtime_error("Cannot invert an umeasurement with a zero value", measurement_errc::division_by_zero);
 
-                return { 1 / umeas.value_, umeas.uncertainty_ / std::pow(umeas.value_, 2), umeas.units_.inv() };
+                return basic_umeasurement(1 / umeas.value_, umeas.uncertainty_ / std::pow(umeas.value_, 2), umeas.units_.inv());
                 
             } 
 
@@ -1433,9 +1482,9 @@ namespace measurements {
              * 
              * @return umeasurement 
              */
-            inline umeasurement pow(const int& power) const noexcept { 
+            inline basic_umeasurement pow(const int& power) const noexcept { 
                 
-                return { std::pow(this->value_, power), std::fabs(power * std::pow(this->value_, power - 1)) * this->uncertainty_, this->units_.pow(power) };
+                return basic_umeasurement(std::pow(this->value_, power), std::fabs(power * std::pow(this->value_, power - 1)) * this->uncertainty_, this->units_.pow(power));
                 
             }
 
@@ -1448,9 +1497,9 @@ namespace measurements {
              * 
              * @return umeasurement 
              */
-            friend inline umeasurement pow(const umeasurement& umeas, const int& power) noexcept { 
+            friend inline basic_umeasurement pow(const basic_umeasurement& umeas, const int& power) noexcept { 
                 
-                return { std::pow(umeas.value_, power), std::fabs(power * std::pow(umeas.value_, power - 1)) * umeas.uncertainty_, umeas.units_.pow(power) };
+                return basic_umeasurement(std::pow(umeas.value_, power), std::fabs(power * std::pow(umeas.value_, power - 1)) * umeas.uncertainty_, umeas.units_.pow(power));
                 
             }
             
@@ -1460,9 +1509,9 @@ namespace measurements {
              * 
              * @return umeasurement 
              */
-            friend inline umeasurement square(const umeasurement& umeas) noexcept { 
+            friend inline basic_umeasurement square(const basic_umeasurement& umeas) noexcept { 
                 
-                return { std::pow(umeas.value_, 2), 2. * std::fabs(umeas.value_) * umeas.uncertainty_, umeas.units_.square() }; 
+                return basic_umeasurement(std::pow(umeas.value_, 2), 2. * std::fabs(umeas.value_) * umeas.uncertainty_, umeas.units_.square());
                 
             }
 
@@ -1472,9 +1521,9 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            friend constexpr umeasurement cube(const umeasurement& umeas) noexcept { 
+            friend constexpr basic_umeasurement cube(const basic_umeasurement& umeas) noexcept { 
                 
-                return { std::pow(umeas.value_, 3), 3. * std::pow(umeas.value_, 2) * umeas.uncertainty_, umeas.units_.cube() };
+                return basic_umeasurement(std::pow(umeas.value_, 3), 3. * std::pow(umeas.value_, 2) * umeas.uncertainty_, umeas.units_.cube());
                 
             }
 
@@ -1486,9 +1535,9 @@ namespace measurements {
              * 
              * @return umeasurement 
              */
-            inline umeasurement root(const int& power) const { 
+            inline basic_umeasurement root(const int& power) const { 
                 
-                return { std::pow(this->value_, 1.0 / power), std::fabs(std::pow(this->value_, 1.0 / power - 1)) * this->uncertainty_ / power, this->units_.root(power) }; 
+                return basic_umeasurement(std::pow(this->value_, 1.0 / power), std::fabs(std::pow(this->value_, 1.0 / power - 1)) * this->uncertainty_ / power, this->units_.root(power));
                 
             }
 
@@ -1501,9 +1550,9 @@ namespace measurements {
              * 
              * @return umeasurement 
              */
-            friend inline umeasurement root(const umeasurement &umeas, const int& power) { 
+            friend inline basic_umeasurement root(const basic_umeasurement &umeas, const int& power) { 
                 
-                return { std::pow(umeas.value_, 1.0 / power), std::fabs(std::pow(umeas.value_, 1.0 / power - 1)) * umeas.uncertainty_ / power, umeas.units_.root(power) }; 
+                return basic_umeasurement(std::pow(umeas.value_, 1.0 / power), std::fabs(std::pow(umeas.value_, 1.0 / power - 1)) * umeas.uncertainty_ / power, umeas.units_.root(power));
                 
             }
 
@@ -1513,9 +1562,9 @@ namespace measurements {
              * 
              * @return umeasurement
              */
-            friend inline umeasurement sqrt(const umeasurement& umeas) { 
+            friend inline basic_umeasurement sqrt(const basic_umeasurement& umeas) { 
                 
-                return { std::sqrt(umeas.value_), umeas.uncertainty_ / (2. * std::sqrt(umeas.value_)), umeas.units_.sqrt() }; 
+                return basic_umeasurement(std::sqrt(umeas.value_), umeas.uncertainty_ / (2. * std::sqrt(umeas.value_)), umeas.units_.sqrt());
                 
             }
 
@@ -1525,9 +1574,9 @@ namespace measurements {
              * 
              * @return umeasurement
              */                
-            friend inline umeasurement cbrt(const umeasurement& umeas) { 
+            friend inline basic_umeasurement cbrt(const basic_umeasurement& umeas) { 
                 
-                return { std::cbrt(umeas.value_), std::pow(umeas.value_, - 2. / 3.) * umeas.uncertainty_ / 3., umeas.units_.cbrt() };
+                return basic_umeasurement(std::cbrt(umeas.value_), std::pow(umeas.value_, - 2. / 3.) * umeas.uncertainty_ / 3., umeas.units_.cbrt());
                 
             }
 
@@ -1539,12 +1588,12 @@ namespace measurements {
              * 
              * @return constexpr measurement
              */
-            friend constexpr umeasurement sin(const umeasurement& umeas) { 
+            friend constexpr basic_umeasurement sin(const basic_umeasurement& umeas) { 
                 
                 if (umeas.units_ != rad) 
-                    throw std::runtime_error("Cannot take the sine of an umeasurement that is not in radians"); 
+                    throw_runtime_error("Cannot take the sine of an umeasurement that is not in radians"); 
 
-                return { std::sin(umeas.value_), std::fabs(std::cos(umeas.value_)) * umeas.uncertainty_, unitless };
+                return basic_umeasurement(std::sin(umeas.value_), std::fabs(std::cos(umeas.value_)) * umeas.uncertainty_, unitless);
             
             }
 
@@ -1556,12 +1605,12 @@ namespace measurements {
              * 
              * @return constexpr measurement
              */
-            friend constexpr umeasurement cos(const umeasurement& umeas) { 
+            friend constexpr basic_umeasurement cos(const basic_umeasurement& umeas) { 
                 
                 if (umeas.units_ != rad) 
-                    throw std::runtime_error("Cannot take the cosine of an umeasurement that is not in radians"); 
+                    throw_runtime_error("Cannot take the cosine of an umeasurement that is not in radians"); 
 
-                return { std::cos(umeas.value_), std::fabs(-std::sin(umeas.value_)) * umeas.uncertainty_, unitless };
+                return basic_umeasurement(std::cos(umeas.value_), std::fabs(-std::sin(umeas.value_)) * umeas.uncertainty_, unitless);
             
             }
 
@@ -1573,13 +1622,13 @@ namespace measurements {
              * 
              * @return constexpr measurement
              */
-            friend constexpr umeasurement tan(const umeasurement& meas) { 
+            friend constexpr basic_umeasurement tan(const basic_umeasurement& meas) { 
                 
                 if (meas.units_ != rad) 
-                    throw std::runtime_error("Cannot take the tangent of an umeasurement that is not in radians");
+                    throw_runtime_error("Cannot take the tangent of an umeasurement that is not in radians");
 
                 
-                return { std::tan(meas.value_), (1 + std::pow(meas.value_, 2)) * meas.uncertainty_, unitless };
+                return basic_umeasurement(std::tan(meas.value_), (1 + std::pow(meas.value_, 2)) * meas.uncertainty_, unitless);
 
             }
 
@@ -1591,12 +1640,12 @@ namespace measurements {
              * 
              * @return constexpr measurement
              */
-            friend constexpr umeasurement asin(const umeasurement& umeas) { 
+            friend constexpr basic_umeasurement asin(const basic_umeasurement& umeas) { 
                 
                 if (umeas.units_ != unitless) 
-                    throw std::runtime_error("Cannot take the arcsine of an umeasurement that is not unitless"); 
+                    throw_runtime_error("Cannot take the arcsine of an umeasurement that is not unitless"); 
                 
-                return { std::asin(umeas.value_), umeas.uncertainty_ / std::sqrt(1 - std::pow(umeas.value_, 2)), rad };
+                return basic_umeasurement(std::asin(umeas.value_), umeas.uncertainty_ / std::sqrt(1 - std::pow(umeas.value_, 2)), rad);
 
             }
 
@@ -1608,12 +1657,12 @@ namespace measurements {
              * 
              * @return constexpr measurement
              */
-            friend constexpr umeasurement acos(const umeasurement& umeas) { 
+            friend constexpr basic_umeasurement acos(const basic_umeasurement& umeas) { 
                 
                 if (umeas.units_ != unitless) 
-                    throw std::runtime_error("Cannot take the arccosine of an umeasurement that is not unitless"); 
+                    throw_runtime_error("Cannot take the arccosine of an umeasurement that is not unitless"); 
                 
-                return { std::acos(umeas.value_), umeas.uncertainty_ / std::sqrt(1 - std::pow(umeas.value_, 2)), rad };
+                return basic_umeasurement(std::acos(umeas.value_), umeas.uncertainty_ / std::sqrt(1 - std::pow(umeas.value_, 2)), rad);
 
             }
 
@@ -1625,12 +1674,12 @@ namespace measurements {
              * 
              * @return constexpr measurement
              */
-            friend constexpr umeasurement atan(const umeasurement& umeas) { 
+            friend constexpr basic_umeasurement atan(const basic_umeasurement& umeas) { 
                 
                 if (umeas.units_ != unitless) 
-                    throw std::runtime_error("Cannot take the arctangent of an umeasurement that is not unitless"); 
+                    throw_runtime_error("Cannot take the arctangent of an umeasurement that is not unitless"); 
                 
-                return { std::atan(umeas.value_), umeas.uncertainty_ / (1 + std::pow(umeas.value_, 2)), rad };
+                return basic_umeasurement(std::atan(umeas.value_), umeas.uncertainty_ / (1 + std::pow(umeas.value_, 2)), rad);
 
             }
 
@@ -1642,12 +1691,12 @@ namespace measurements {
              * 
              * @return constexpr measurement
              */
-            friend constexpr umeasurement sinh(const umeasurement& umeas) { 
+            friend constexpr basic_umeasurement sinh(const basic_umeasurement& umeas) { 
                 
                 if (umeas.units_ != rad) 
-                    throw std::runtime_error("Cannot take the hyperbolic sine of an umeasurement that is not in radians"); 
+                    throw_runtime_error("Cannot take the hyperbolic sine of an umeasurement that is not in radians"); 
                 
-                return { std::sinh(umeas.value_), std::cosh(umeas.value_) * umeas.uncertainty_, unitless };
+                return basic_umeasurement(std::sinh(umeas.value_), std::cosh(umeas.value_) * umeas.uncertainty_, unitless);
 
             }
 
@@ -1659,12 +1708,12 @@ namespace measurements {
              * 
              * @return constexpr measurement
              */
-            friend constexpr umeasurement cosh(const umeasurement& umeas) { 
+            friend constexpr basic_umeasurement cosh(const basic_umeasurement& umeas) { 
                 
                 if (umeas.units_ != rad) 
-                    throw std::runtime_error("Cannot take the hyperbolic cosine of an umeasurement that is not in radians"); 
+                    throw_runtime_error("Cannot take the hyperbolic cosine of an umeasurement that is not in radians"); 
                 
-                return { std::cosh(umeas.value_), std::fabs(std::sinh(umeas.value_)) * umeas.uncertainty_, unitless };
+                return basic_umeasurement(std::cosh(umeas.value_), std::fabs(std::sinh(umeas.value_)) * umeas.uncertainty_, unitless);
             
             }
 
@@ -1676,12 +1725,12 @@ namespace measurements {
              * 
              * @return constexpr measurement
              */
-            friend constexpr umeasurement tanh(const umeasurement& umeas) { 
+            friend constexpr basic_umeasurement tanh(const basic_umeasurement& umeas) { 
                 
                 if (umeas.units_ != rad) 
-                    throw std::runtime_error("Cannot take the hyperbolic tangent of an umeasurement that is not in radians"); 
+                    throw_runtime_error("Cannot take the hyperbolic tangent of an umeasurement that is not in radians"); 
                 
-                return { std::tanh(umeas.value_), std::fabs((1 - std::pow(umeas.value_, 2))) * umeas.uncertainty_, unitless };
+                return basic_umeasurement(std::tanh(umeas.value_), std::fabs((1 - std::pow(umeas.value_, 2))) * umeas.uncertainty_, unitless);
 
             }
 
@@ -1693,12 +1742,12 @@ namespace measurements {
              * 
              * @return constexpr measurement
              */
-            friend constexpr umeasurement asinh(const umeasurement& umeas) { 
+            friend constexpr basic_umeasurement asinh(const basic_umeasurement& umeas) { 
                 
                 if (umeas.units_ != unitless) 
-                    throw std::runtime_error("Cannot take the hyperbolic arcsine of an umeasurement that is not unitless"); 
+                    throw_runtime_error("Cannot take the hyperbolic arcsine of an umeasurement that is not unitless"); 
                 
-                return { std::asinh(umeas.value_), umeas.uncertainty_ / std::sqrt(std::pow(umeas.value_, 2) + 1), rad };
+                return basic_umeasurement(std::asinh(umeas.value_), umeas.uncertainty_ / std::sqrt(std::pow(umeas.value_, 2) + 1), rad);
 
             }
 
@@ -1710,12 +1759,12 @@ namespace measurements {
              * 
              * @return constexpr measurement
              */
-            friend constexpr umeasurement acosh(const umeasurement& umeas) { 
+            friend constexpr basic_umeasurement acosh(const basic_umeasurement& umeas) { 
                 
                 if (umeas.units_ != unitless) 
-                    throw std::runtime_error("Cannot take the hyperbolic arccosine of an umeasurement that is not unitless"); 
+                    throw_runtime_error("Cannot take the hyperbolic arccosine of an umeasurement that is not unitless"); 
                 
-                return { std::acosh(umeas.value_), umeas.uncertainty_ / std::fabs(std::sqrt(std::pow(umeas.value_, 2) - 1)), rad };
+                return basic_umeasurement(std::acosh(umeas.value_), umeas.uncertainty_ / std::fabs(std::sqrt(std::pow(umeas.value_, 2) - 1)), rad);
             
             }
 
@@ -1727,12 +1776,12 @@ namespace measurements {
              * 
              * @return constexpr measurement
              */
-            friend constexpr umeasurement atanh(const umeasurement& umeas) { 
+            friend constexpr basic_umeasurement atanh(const basic_umeasurement& umeas) { 
                 
                 if (umeas.units_ != unitless) 
-                    throw std::runtime_error("Cannot take the hyperbolic arctangent of an umeasurement that is not unitless"); 
+                    throw_runtime_error("Cannot take the hyperbolic arctangent of an umeasurement that is not unitless"); 
                 
-                return { std::atanh(umeas.value_), umeas.uncertainty_ / std::fabs(std::sqrt(1 - std::pow(umeas.value_, 2))), rad };
+                return basic_umeasurement(std::atanh(umeas.value_), umeas.uncertainty_ / std::fabs(std::sqrt(1 - std::pow(umeas.value_, 2))), rad);
 
             }
 
@@ -1746,7 +1795,7 @@ namespace measurements {
              * 
              * @return constexpr const scalar
              */
-            constexpr scalar value() const noexcept { 
+            constexpr T value() const noexcept { 
                 
                 return this->value_; 
             
@@ -1758,7 +1807,7 @@ namespace measurements {
              * 
              * @return constexpr scalar& 
              */
-            constexpr scalar& value() noexcept { 
+            constexpr T& value() noexcept { 
                 
                 return this->value_; 
             
@@ -1771,9 +1820,13 @@ namespace measurements {
              * @param desired_units 
              * @return constexpr scalar 
              */
-            constexpr scalar value_as(const unit& desired_units) const { 
+            constexpr T value_as(const unit& desired_units) const { 
                 
-                return (this->units_ == desired_units) ? this->value_ : this->units_.convert(this->value_, desired_units); 
+                if (this->units_ == desired_units)
+                    return this->value_;
+
+                instrumentation::count_conversion(this->units_, desired_units);
+                return this->units_.convert(this->value_, desired_units); 
             
             }
 
@@ -1783,9 +1836,9 @@ namespace measurements {
              * 
              * @return measurement 
              */
-            constexpr measurement as_measurement() const noexcept { 
+            constexpr basic_measurement<T> as_measurement() const noexcept { 
                 
-                return { this->value_, this->units_ };
+                return basic_measurement<T>(this->value_, this->units_);
                 
             }
 
@@ -1795,7 +1848,7 @@ namespace measurements {
              * 
              * @return constexpr const scalar
              */
-            constexpr scalar uncertainty() const noexcept { 
+            constexpr T uncertainty() const noexcept { 
                 
                 return this->uncertainty_; 
             
@@ -1807,7 +1860,7 @@ namespace measurements {
              * 
              * @return constexpr scalar& 
              */
-            constexpr scalar& uncertainty() noexcept { 
+            constexpr T& uncertainty() noexcept { 
                 
                 return this->uncertainty_; 
             
@@ -1820,7 +1873,7 @@ namespace measurements {
              * @param desired_units: unit desired as l-value const reference
              * @return constexpr scalar 
              */
-            constexpr scalar uncertainty_as(const unit& desired_units) const { 
+            constexpr T uncertainty_as(const unit& desired_units) const { 
                 
                 return (this->units_ == desired_units) ? this->uncertainty_ : this->units_.convert(this->uncertainty_, desired_units); 
             
@@ -1832,7 +1885,7 @@ namespace measurements {
              * 
              * @return constexpr scalar
              */
-            constexpr scalar relative_uncertainty() const noexcept { 
+            constexpr T relative_uncertainty() const noexcept { 
                 
                 return this->uncertainty_ / this->value_;
 
@@ -1844,7 +1897,7 @@ namespace measurements {
              * 
              * @return constexpr measurement 
              */
-            constexpr measurement weight() const {
+            constexpr basic_measurement<T> weight() const {
                     
                 return square(this->uncertainty_as_measurement().inv());
 
@@ -1856,9 +1909,9 @@ namespace measurements {
              * 
              * @return constexpr measurement 
              */
-            constexpr measurement uncertainty_as_measurement() const noexcept { 
+            constexpr basic_measurement<T> uncertainty_as_measurement() const noexcept { 
                 
-                return { this->uncertainty_, this->units_ }; 
+                return basic_measurement<T>(this->uncertainty_, this->units_);
             
             }
 
@@ -1892,7 +1945,7 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement as_umeasurement() const noexcept {
+            constexpr basic_umeasurement as_umeasurement() const noexcept {
 
                 return *this; 
 
@@ -1904,7 +1957,7 @@ namespace measurements {
              * 
              * @return constexpr umeasurement&
              */
-            constexpr umeasurement& as_umeasurement() noexcept {
+            constexpr basic_umeasurement& as_umeasurement() noexcept {
 
                 return *this; 
 
@@ -1918,7 +1971,7 @@ namespace measurements {
              * 
              * @return void
              */
-            inline void add_uncertainty(const scalar new_uncertainty) noexcept { 
+            inline void add_uncertainty(const T new_uncertainty) noexcept { 
                 
                 this->uncertainty_ = std::sqrt(std::pow(this->uncertainty_, 2) + std::pow(new_uncertainty, 2));
 
@@ -1932,11 +1985,12 @@ namespace measurements {
              * 
              * @return constexpr umeasurement 
              */
-            constexpr umeasurement convert_to(const unit& newUnits) const noexcept {
+            constexpr basic_umeasurement convert_to(const unit& newUnits) const noexcept {
 
-                scalar cval = this->units_.convertion_factor(newUnits);
+                instrumentation::count_conversion(this->units_, newUnits);
+                T cval = this->units_.convertion_factor(newUnits);
 
-                return umeasurement(cval * this->value_, this->uncertainty_ * cval, newUnits);
+                return basic_umeasurement(cval * this->value_, this->uncertainty_ * cval, newUnits);
 
             }
 
@@ -1957,15 +2011,18 @@ namespace measurements {
             }
 
 
+            static constexpr std::size_t max_chars{unit::max_chars + 64}; ///< Size of a buffer always large enough for to_chars
+
+
         private:
 
         // =============================================                                                                                         
         // class members
         // =============================================  
 
-            scalar value_{}; ///< the numerical value of the measurement
+            T value_{}; ///< the numerical value of the measurement
             
-            scalar uncertainty_{}; ///< the uncertainty of the measurement
+            T uncertainty_{}; ///< the uncertainty of the measurement
 
             unit units_; ///< the units of the measurement
 
@@ -1980,7 +2037,14 @@ namespace measurements {
             friend class angle_umeasurement; ///< angle_umeasurement is a friend of umeasurement
 
 
-    }; // class umeasurement
+    }; // class basic_umeasurement
+
+
+    using umeasurement = basic_umeasurement<scalar>; ///< umeasurement with a double precision value
+
+    using float_umeasurement = basic_umeasurement<float>; ///< umeasurement with a single precision value
+
+    using long_double_umeasurement = basic_umeasurement<long double>; ///< umeasurement with an extended precision value
     
     
 } // namespace measurements
\ No newline at end of file
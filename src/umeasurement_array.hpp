@@ -0,0 +1,996 @@
+/**
+ * @file    umeasurement_array.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the definition and implementation of the umeasurement_array class,
+ *          with all its methods, operators and possibly operations.
+ * @date    2023-01-20
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    /**
+     * @brief A class for representing a dataset of umeasurements sharing the same unit,
+     *        stored as two contiguous aligned buffers of values and uncertainties and a single unit
+     *
+     * @tparam T: type of the values and of the uncertainties, as float, double or long double
+     *
+     * @note The propagation formulas are written without per-element branches and,
+     *       where possible, without divisions, so that every loop can be vectorized
+     * @note The loops calling std::sqrt are vectorized only when errno is not required (-fno-math-errno)
+     * @note A float_umeasurement_array stores 8 bytes per element against the 16 bytes of an umeasurement_array
+     * @see umeasurement
+     */
+    template <typename T>
+    class basic_umeasurement_array {
+
+
+        public:
+
+            using container = std::vector<T, aligned_allocator<T>>;
+
+
+        // =============================================
+        // constructors & destructor
+        // =============================================
+
+            /**
+             * @brief Construct a new empty umeasurement_array object
+             *
+             * @param units: unit as l-value const reference
+             *
+             * @note If the unit is not specified, the unit is set to unitless
+             */
+            explicit basic_umeasurement_array(const unit& units = unit()) noexcept :
+
+                values_(),
+                uncertainties_(),
+                units_(units) {}
+
+
+            /**
+             * @brief Construct a new umeasurement_array object with a size, a value and an uncertainty for every element
+             *
+             * @param size: number of elements
+             * @param value: value of every element as l-value const reference
+             * @param uncertainty: uncertainty of every element as l-value const reference
+             * @param units: unit as l-value const reference
+             *
+             * @note The uncertainty must be positive
+             */
+            basic_umeasurement_array(const std::size_t& size,
+                                     const T& value,
+                                     const T& uncertainty,
+                                     const unit& units) :
+
+                values_(size, value),
+                uncertainties_(size, uncertainty),
+                units_(units) {
+
+                if (uncertainty < 0.0)
+                    throw_invalid_argument("Cannot instantiate an basic_umeasurement_array with a negative uncertainty");
+
+            }
+
+
+            /**
+             * @brief Construct a new umeasurement_array object from the values, the uncertainties and an unit
+             *
+             * @param values: values of the elements
+             * @param uncertainties: uncertainties of the elements
+             * @param units: unit as l-value const reference
+             *
+             * @note The uncertainties must be positive and as many as the values
+             */
+            basic_umeasurement_array(std::span<const T> values,
+                                     std::span<const T> uncertainties,
+                                     const unit& units) :
+
+                values_(values.begin(), values.end()),
+                uncertainties_(uncertainties.begin(), uncertainties.end()),
+                units_(units) {
+
+                this->check_uncertainties();
+
+            }
+
+
+            /**
+             * @brief Construct a new umeasurement_array object from the values, the uncertainties and an unit
+             *
+             * @param values: values of the elements
+             * @param uncertainties: uncertainties of the elements
+             * @param units: unit as l-value const reference
+             *
+             * @note The uncertainties must be positive and as many as the values
+             */
+            basic_umeasurement_array(std::initializer_list<T> values,
+                                     std::initializer_list<T> uncertainties,
+                                     const unit& units) :
+
+                values_(values),
+                uncertainties_(uncertainties),
+                units_(units) {
+
+                this->check_uncertainties();
+
+            }
+
+
+            /**
+             * @brief Construct a new umeasurement_array object from a measurement_array and the uncertainties
+             *
+             * @param values: measurement_array as l-value const reference
+             * @param uncertainties: uncertainties of the elements, expressed in the units of values
+             */
+            basic_umeasurement_array(const basic_measurement_array<T>& values,
+                                     std::span<const T> uncertainties) :
+
+                basic_umeasurement_array(values.values(), uncertainties, values.units()) {}
+
+
+            /**
+             * @brief Construct a new umeasurement_array object copying an umeasurement_view
+             *
+             * @param view: umeasurement_view as l-value const reference
+             *
+             * @note The uncertainties must be positive
+             */
+            explicit basic_umeasurement_array(const basic_umeasurement_view<T>& view) :
+
+                basic_umeasurement_array(view.values(), view.uncertainties(), view.units()) {}
+
+
+            /**
+             * @brief Construct a new umeasurement_array object from a range of umeasurements
+             *
+             * @param umeasurements: umeasurements to copy
+             * @param units: unit of the umeasurement_array as l-value const reference
+             *
+             * @note Every umeasurement must have the same unit_base of units and is converted to units
+             */
+            basic_umeasurement_array(std::span<const basic_umeasurement<T>> umeasurements,
+                                     const unit& units) :
+
+                values_(),
+                uncertainties_(),
+                units_(units) {
+
+                this->reserve(umeasurements.size());
+                for (const basic_umeasurement<T>& umeas : umeasurements)
+                    this->push_back(umeas);
+
+            }
+
+
+            /// @brief Copy construct a new umeasurement_array object
+            basic_umeasurement_array(const basic_umeasurement_array& other) = default;
+
+
+            /// @brief Move construct a new umeasurement_array object
+            basic_umeasurement_array(basic_umeasurement_array&& other) noexcept = default;
+
+
+            /// @brief Default destructor
+            ~basic_umeasurement_array() = default;
+
+
+        // =============================================
+        // operators
+        // =============================================
+
+            /// @brief Copy assign another umeasurement_array to this umeasurement_array
+            basic_umeasurement_array& operator=(const basic_umeasurement_array& other) = default;
+
+
+            /// @brief Move assign another umeasurement_array to this umeasurement_array
+            basic_umeasurement_array& operator=(basic_umeasurement_array&& other) noexcept = default;
+
+
+            /**
+             * @brief Multiply element-wise this umeasurement_array by another umeasurement_array,
+             *        propagating the uncertainties with the root sum of squares(rss) method
+             *
+             * @param other: umeasurement_view as l-value const reference, an umeasurement_array converts implicitly
+             *
+             * @return umeasurement_array&
+             *
+             * @note The uncertainty is computed as sqrt((σx * y)^2 + (x * σy)^2),
+             *       which is the rss of the relative uncertainties without dividing by the values
+             */
+            basic_umeasurement_array& operator*=(const basic_umeasurement_view<T>& other) {
+
+                this->check_size(other, "Cannot multiply umeasurement_arrays with different sizes");
+
+                T* x = this->values_.data();
+                T* sx = this->uncertainties_.data();
+                const T* y = other.values().data();
+                const T* sy = other.uncertainties().data();
+                const std::size_t size = this->size();
+                for (std::size_t i{0}; i < size; ++i) {
+
+                    const T a = sx[i] * y[i];
+                    const T b = x[i] * sy[i];
+                    sx[i] = std::sqrt(a * a + b * b);
+                    x[i] *= y[i];
+
+                }
+
+                this->units_ *= other.units();
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Divide element-wise this umeasurement_array by another umeasurement_array,
+             *        propagating the uncertainties with the root sum of squares(rss) method
+             *
+             * @param other: umeasurement_view as l-value const reference, an umeasurement_array converts implicitly
+             *
+             * @return umeasurement_array&
+             *
+             * @note The uncertainty is computed as sqrt(σx^2 + (z * σy)^2) / |y|, with a single division per element
+             * @note The divisors are not checked element by element, a zero divisor gives an infinite or NaN value
+             */
+            basic_umeasurement_array& operator/=(const basic_umeasurement_view<T>& other) {
+
+                this->check_size(other, "Cannot divide umeasurement_arrays with different sizes");
+
+                T* x = this->values_.data();
+                T* sx = this->uncertainties_.data();
+                const T* y = other.values().data();
+                const T* sy = other.uncertainties().data();
+                const std::size_t size = this->size();
+                for (std::size_t i{0}; i < size; ++i) {
+
+                    const T inv = T(1) / y[i];
+                    const T z = x[i] * inv;
+                    const T b = z * sy[i];
+                    sx[i] = std::sqrt(sx[i] * sx[i] + b * b) * std::fabs(inv);
+                    x[i] = z;
+
+                }
+
+                this->units_ /= other.units();
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Add element-wise another umeasurement_array to this umeasurement_array,
+             *        propagating the uncertainties with the root sum of squares(rss) method
+             *
+             * @param other: umeasurement_view as l-value const reference, an umeasurement_array converts implicitly
+             *
+             * @return umeasurement_array&
+             *
+             * @note The values of other are converted to the units of this umeasurement_array
+             */
+            basic_umeasurement_array& operator+=(const basic_umeasurement_view<T>& other) {
+
+                const T factor = this->check_addable(other, "Cannot add umeasurement_arrays with different sizes");
+
+                T* x = this->values_.data();
+                T* sx = this->uncertainties_.data();
+                const T* y = other.values().data();
+                const T* sy = other.uncertainties().data();
+                const std::size_t size = this->size();
+                for (std::size_t i{0}; i < size; ++i) {
+
+                    const T b = factor * sy[i];
+                    sx[i] = std::sqrt(sx[i] * sx[i] + b * b);
+                    x[i] += factor * y[i];
+
+                }
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Subtract element-wise another umeasurement_array to this umeasurement_array,
+             *        propagating the uncertainties with the root sum of squares(rss) method
+             *
+             * @param other: umeasurement_view as l-value const reference, an umeasurement_array converts implicitly
+             *
+             * @return umeasurement_array&
+             *
+             * @note The values of other are converted to the units of this umeasurement_array
+             */
+            basic_umeasurement_array& operator-=(const basic_umeasurement_view<T>& other) {
+
+                const T factor = this->check_addable(other, "Cannot subtract umeasurement_arrays with different sizes");
+
+                T* x = this->values_.data();
+                T* sx = this->uncertainties_.data();
+                const T* y = other.values().data();
+                const T* sy = other.uncertainties().data();
+                const std::size_t size = this->size();
+                for (std::size_t i{0}; i < size; ++i) {
+
+                    const T b = factor * sy[i];
+                    sx[i] = std::sqrt(sx[i] * sx[i] + b * b);
+                    x[i] -= factor * y[i];
+
+                }
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Multiply every element of this umeasurement_array by a scalar
+             *
+             * @param scal: scalar as l-value const reference
+             *
+             * @return umeasurement_array&
+             */
+            basic_umeasurement_array& operator*=(const T& scal) noexcept {
+
+                const T abs_scal = std::fabs(scal);
+                const std::size_t size = this->size();
+                for (std::size_t i{0}; i < size; ++i) {
+
+                    this->values_[i] *= scal;
+                    this->uncertainties_[i] *= abs_scal;
+
+                }
+
+                return *this;
+
+            }
+
+
+            /**
+             * @brief Divide every element of this umeasurement_array by a scalar
+             *
+             * @param scal: scalar as l-value const reference
+             *
+             * @return umeasurement_array&
+             */
+            basic_umeasurement_array& operator/=(const T& scal) {
+
+                if (scal == 0.0)
+                    throw_runtime_error("Cannot divide an basic_umeasurement_array by 0", measurement_errc::division_by_zero);
+
+                return *this *= (T(1) / scal);
+
+            }
+
+
+            /// @brief Multiply element-wise two umeasurement_arrays with the rss method
+            friend basic_umeasurement_array operator*(basic_umeasurement_array lhs, const basic_umeasurement_view<T>& rhs) { return lhs *= rhs; }
+
+            /// @brief Divide element-wise two umeasurement_arrays with the rss method
+            friend basic_umeasurement_array operator/(basic_umeasurement_array lhs, const basic_umeasurement_view<T>& rhs) { return lhs /= rhs; }
+
+            /// @brief Sum element-wise two umeasurement_arrays with the rss method, the result has the units of the left operand
+            friend basic_umeasurement_array operator+(basic_umeasurement_array lhs, const basic_umeasurement_view<T>& rhs) { return lhs += rhs; }
+
+            /// @brief Subtract element-wise two umeasurement_arrays with the rss method, the result has the units of the left operand
+            friend basic_umeasurement_array operator-(basic_umeasurement_array lhs, const basic_umeasurement_view<T>& rhs) { return lhs -= rhs; }
+
+            /// @brief Multiply every element of an umeasurement_array by a scalar
+            friend basic_umeasurement_array operator*(basic_umeasurement_array lhs, const T& rhs) noexcept { return lhs *= rhs; }
+
+            /// @brief Multiply every element of an umeasurement_array by a scalar
+            friend basic_umeasurement_array operator*(const T& lhs, basic_umeasurement_array rhs) noexcept { return rhs *= lhs; }
+
+            /// @brief Divide every element of an umeasurement_array by a scalar
+            friend basic_umeasurement_array operator/(basic_umeasurement_array lhs, const T& rhs) { return lhs /= rhs; }
+
+
+            /**
+             * @brief Get an element of the umeasurement_array
+             *
+             * @param index: position of the element
+             *
+             * @return umeasurement
+             */
+            basic_umeasurement<T> operator[](const std::size_t& index) const {
+
+                return { this->values_[index], this->uncertainties_[index], this->units_ };
+
+            }
+
+
+            /**
+             * @brief Output operator for an umeasurement_array
+             *
+             * @param os: std::ostream&
+             * @param array: umeasurement_array as l-value const reference
+             *
+             * @return std::ostream&
+             */
+            friend std::ostream& operator<<(std::ostream& os, const basic_umeasurement_array& array) noexcept {
+
+                os << "[";
+                for (std::size_t i{0}; i < array.size(); ++i)
+                    os << ((i == 0) ? "" : ", ") << array.values_[i] << " ± " << array.uncertainties_[i];
+                os << "] " << array.units_;
+
+                return os;
+
+            }
+
+
+        // =============================================
+        // operations
+        // =============================================
+
+            /**
+             * @brief Convert the umeasurement_array to another units
+             *
+             * @param desired_units: desired unit of measurement
+             *
+             * @return umeasurement_array
+             *
+             * @note Every element is counted as a conversion by the instrumentation, see units::convert
+             */
+            basic_umeasurement_array convert_to(const unit& desired_units) const {
+
+                basic_umeasurement_array result(desired_units);
+                result.resize(this->size());
+                units::convert<T>(this->values_, this->uncertainties_, this->units_, desired_units, result.values_, result.uncertainties_);
+
+                return result;
+
+            }
+
+
+            /**
+             * @brief Multiply element-wise this umeasurement_array by another umeasurement_array,
+             *        propagating the uncertainties with the simple method
+             *
+             * @param other: umeasurement_view as l-value const reference, an umeasurement_array converts implicitly
+             *
+             * @return umeasurement_array
+             *
+             * @note The uncertainty is computed as |σx * y| + |x * σy|
+             */
+            basic_umeasurement_array simple_product(const basic_umeasurement_view<T>& other) const {
+
+                this->check_size(other, "Cannot multiply umeasurement_arrays with different sizes");
+
+                basic_umeasurement_array result(this->units_ * other.units());
+                result.resize(this->size());
+                const std::size_t size = this->size();
+                for (std::size_t i{0}; i < size; ++i) {
+
+                    result.uncertainties_[i] = std::fabs(this->uncertainties_[i] * other.values()[i]) + std::fabs(this->values_[i] * other.uncertainties()[i]);
+                    result.values_[i] = this->values_[i] * other.values()[i];
+
+                }
+
+                return result;
+
+            }
+
+
+            /**
+             * @brief Add element-wise another umeasurement_array to this umeasurement_array,
+             *        propagating the uncertainties with the simple method
+             *
+             * @param other: umeasurement_view as l-value const reference, an umeasurement_array converts implicitly
+             *
+             * @return umeasurement_array
+             *
+             * @note The values of other are converted to the units of this umeasurement_array
+             */
+            basic_umeasurement_array simple_add(const basic_umeasurement_view<T>& other) const {
+
+                const T factor = this->check_addable(other, "Cannot add umeasurement_arrays with different sizes");
+
+                basic_umeasurement_array result(this->units_);
+                result.resize(this->size());
+                const std::size_t size = this->size();
+                for (std::size_t i{0}; i < size; ++i) {
+
+                    result.uncertainties_[i] = this->uncertainties_[i] + factor * other.uncertainties()[i];
+                    result.values_[i] = this->values_[i] + factor * other.values()[i];
+
+                }
+
+                return result;
+
+            }
+
+
+            /**
+             * @brief Take the power of every element of an umeasurement_array
+             *
+             * @param array: umeasurement_array as l-value const reference
+             * @param power: int as l-value const reference
+             *
+             * @return umeasurement_array
+             *
+             * @note The power is computed by repeated squaring over the whole buffer, so every pass is a vectorizable loop
+             */
+            friend basic_umeasurement_array pow(const basic_umeasurement_array& array, const int& power) {
+
+                const std::size_t size = array.size();
+                basic_umeasurement_array result(array.units_.pow(power));
+                result.resize(size);
+
+                if (power == 0) {
+
+                    std::fill(result.values_.begin(), result.values_.end(), 1.0);
+                    return result;
+
+                }
+
+                // previous = x^(|n| - 1)
+                container previous = basic_umeasurement_array::power(array.values_, static_cast<unsigned>(std::abs(power) - 1));
+                const T n = std::fabs(static_cast<T>(power));
+                const T* x = array.values_.data();
+                const T* sx = array.uncertainties_.data();
+                const T* p = previous.data();
+
+                if (power > 0)
+                    for (std::size_t i{0}; i < size; ++i) {
+
+                        result.values_[i] = p[i] * x[i];
+                        result.uncertainties_[i] = n * std::fabs(p[i]) * sx[i];
+
+                    }
+
+                else
+                    for (std::size_t i{0}; i < size; ++i) {
+
+                        // z = x^n = 1 / x^|n|, and x^(n - 1) = z^2 * x^(|n| - 1)
+                        const T z = T(1) / (p[i] * x[i]);
+                        result.values_[i] = z;
+                        result.uncertainties_[i] = n * std::fabs(z * z * p[i]) * sx[i];
+
+                    }
+
+                return result;
+
+            }
+
+
+            /**
+             * @brief Take the square root of every element of an umeasurement_array
+             *
+             * @param array: umeasurement_array as l-value const reference
+             *
+             * @return umeasurement_array
+             */
+            friend basic_umeasurement_array sqrt(const basic_umeasurement_array& array) {
+
+                const std::size_t size = array.size();
+                basic_umeasurement_array result(array.units_.sqrt());
+                result.resize(size);
+                for (std::size_t i{0}; i < size; ++i) {
+
+                    const T z = std::sqrt(array.values_[i]);
+                    result.values_[i] = z;
+                    result.uncertainties_[i] = T(0.5) * array.uncertainties_[i] / z;
+
+                }
+
+                return result;
+
+            }
+
+
+            /**
+             * @brief Take the sine of every element of an umeasurement_array
+             *
+             * @param array: umeasurement_array as l-value const reference
+             *
+             * @return umeasurement_array
+             */
+            friend basic_umeasurement_array sin(const basic_umeasurement_array& array) {
+
+                if (array.units_ != rad)
+                    throw_runtime_error("Cannot take the sine of an basic_umeasurement_array that is not in radians");
+
+                basic_umeasurement_array result(unitless);
+                result.resize(array.size());
+                for (std::size_t i{0}; i < array.size(); ++i) {
+
+                    result.values_[i] = std::sin(array.values_[i]);
+                    result.uncertainties_[i] = std::fabs(std::cos(array.values_[i])) * array.uncertainties_[i];
+
+                }
+
+                return result;
+
+            }
+
+
+            /**
+             * @brief Take the cosine of every element of an umeasurement_array
+             *
+             * @param array: umeasurement_array as l-value const reference
+             *
+             * @return umeasurement_array
+             */
+            friend basic_umeasurement_array cos(const basic_umeasurement_array& array) {
+
+                if (array.units_ != rad)
+                    throw_runtime_error("Cannot take the cosine of an basic_umeasurement_array that is not in radians");
+
+                basic_umeasurement_array result(unitless);
+                result.resize(array.size());
+                for (std::size_t i{0}; i < array.size(); ++i) {
+
+                    result.values_[i] = std::cos(array.values_[i]);
+                    result.uncertainties_[i] = std::fabs(std::sin(array.values_[i])) * array.uncertainties_[i];
+
+                }
+
+                return result;
+
+            }
+
+
+            /**
+             * @brief Take the tangent of every element of an umeasurement_array
+             *
+             * @param array: umeasurement_array as l-value const reference
+             *
+             * @return umeasurement_array
+             *
+             * @note The uncertainty is propagated with the derivative 1 + tan(x)^2
+             */
+            friend basic_umeasurement_array tan(const basic_umeasurement_array& array) {
+
+                if (array.units_ != rad)
+                    throw_runtime_error("Cannot take the tangent of an basic_umeasurement_array that is not in radians");
+
+                basic_umeasurement_array result(unitless);
+                result.resize(array.size());
+                for (std::size_t i{0}; i < array.size(); ++i) {
+
+                    const T z = std::tan(array.values_[i]);
+                    result.values_[i] = z;
+                    result.uncertainties_[i] = (T(1) + z * z) * array.uncertainties_[i];
+
+                }
+
+                return result;
+
+            }
+
+
+            /**
+             * @brief Take the arcsine of every element of an umeasurement_array
+             *
+             * @param array: umeasurement_array as l-value const reference
+             *
+             * @return umeasurement_array
+             */
+            friend basic_umeasurement_array asin(const basic_umeasurement_array& array) {
+
+                if (array.units_ != unitless)
+                    throw_runtime_error("Cannot take the arcsine of an basic_umeasurement_array that is not unitless");
+
+                basic_umeasurement_array result(rad);
+                result.resize(array.size());
+                for (std::size_t i{0}; i < array.size(); ++i) {
+
+                    const T x = array.values_[i];
+                    result.values_[i] = std::asin(x);
+                    result.uncertainties_[i] = array.uncertainties_[i] / std::sqrt(T(1) - x * x);
+
+                }
+
+                return result;
+
+            }
+
+
+            /**
+             * @brief Take the arccosine of every element of an umeasurement_array
+             *
+             * @param array: umeasurement_array as l-value const reference
+             *
+             * @return umeasurement_array
+             */
+            friend basic_umeasurement_array acos(const basic_umeasurement_array& array) {
+
+                if (array.units_ != unitless)
+                    throw_runtime_error("Cannot take the arccosine of an basic_umeasurement_array that is not unitless");
+
+                basic_umeasurement_array result(rad);
+                result.resize(array.size());
+                for (std::size_t i{0}; i < array.size(); ++i) {
+
+                    const T x = array.values_[i];
+                    result.values_[i] = std::acos(x);
+                    result.uncertainties_[i] = array.uncertainties_[i] / std::sqrt(T(1) - x * x);
+
+                }
+
+                return result;
+
+            }
+
+
+            /**
+             * @brief Take the arctangent of every element of an umeasurement_array
+             *
+             * @param array: umeasurement_array as l-value const reference
+             *
+             * @return umeasurement_array
+             */
+            friend basic_umeasurement_array atan(const basic_umeasurement_array& array) {
+
+                if (array.units_ != unitless)
+                    throw_runtime_error("Cannot take the arctangent of an basic_umeasurement_array that is not unitless");
+
+                basic_umeasurement_array result(rad);
+                result.resize(array.size());
+                for (std::size_t i{0}; i < array.size(); ++i) {
+
+                    const T x = array.values_[i];
+                    result.values_[i] = std::atan(x);
+                    result.uncertainties_[i] = array.uncertainties_[i] / (T(1) + x * x);
+
+                }
+
+                return result;
+
+            }
+
+
+        // =============================================
+        // set & get methods
+        // =============================================
+
+            /**
+             * @brief Append an umeasurement to the umeasurement_array
+             *
+             * @param umeas: umeasurement as l-value const reference
+             *
+             * @note The umeasurement is converted to the units of the umeasurement_array
+             */
+            void push_back(const basic_umeasurement<T>& umeas) {
+
+                if (this->units_.base() != umeas.units().base())
+                    throw_invalid_argument("Cannot append an basic_umeasurement<T> with a different unit_base to an basic_umeasurement_array", measurement_errc::unit_mismatch);
+
+                const T factor = umeas.units().convertion_factor(this->units_);
+                this->values_.push_back(factor * umeas.value());
+                this->uncertainties_.push_back(factor * umeas.uncertainty());
+
+            }
+
+
+            /// @brief Reserve memory for a number of elements
+            void reserve(const std::size_t& size) {
+
+                this->values_.reserve(size);
+                this->uncertainties_.reserve(size);
+
+            }
+
+
+            /// @brief Resize the umeasurement_array, the new elements are set to zero
+            void resize(const std::size_t& size) {
+
+                this->values_.resize(size);
+                this->uncertainties_.resize(size);
+
+            }
+
+
+            /// @brief Remove all the elements of the umeasurement_array
+            void clear() noexcept {
+
+                this->values_.clear();
+                this->uncertainties_.clear();
+
+            }
+
+
+            /// @brief Get the number of elements of the umeasurement_array
+            std::size_t size() const noexcept { return this->values_.size(); }
+
+            /// @brief Check if the umeasurement_array is empty
+            bool empty() const noexcept { return this->values_.empty(); }
+
+
+            /**
+             * @brief Get the values of the umeasurement_array
+             *
+             * @return std::span<T>
+             */
+            std::span<T> values() noexcept {
+
+                return this->values_;
+
+            }
+
+
+            /**
+             * @brief Get the values of the umeasurement_array
+             *
+             * @return std::span<const T>
+             */
+            std::span<const T> values() const noexcept {
+
+                return this->values_;
+
+            }
+
+
+            /**
+             * @brief Get the uncertainties of the umeasurement_array
+             *
+             * @return std::span<T>
+             *
+             * @note The uncertainties must be kept positive
+             */
+            std::span<T> uncertainties() noexcept {
+
+                return this->uncertainties_;
+
+            }
+
+
+            /**
+             * @brief Get the uncertainties of the umeasurement_array
+             *
+             * @return std::span<const T>
+             */
+            std::span<const T> uncertainties() const noexcept {
+
+                return this->uncertainties_;
+
+            }
+
+
+            /**
+             * @brief Get an umeasurement_view of the umeasurement_array
+             *
+             * @return umeasurement_view
+             *
+             * @note The view is invalidated by any operation that reallocates the umeasurement_array
+             */
+            basic_umeasurement_view<T> view() const noexcept {
+
+                return { this->values_, this->uncertainties_, this->units_ };
+
+            }
+
+
+            /// @brief Get an umeasurement_view of the umeasurement_array
+            operator basic_umeasurement_view<T>() const noexcept {
+
+                return this->view();
+
+            }
+
+
+            /**
+             * @brief Get the units of the umeasurement_array
+             *
+             * @return const unit&
+             */
+            const unit& units() const noexcept {
+
+                return this->units_;
+
+            }
+
+
+            /**
+             * @brief Print the umeasurement_array
+             *
+             * @param newline: if set to true it prints a newline character at the end of the umeasurement_array
+             */
+            inline void print(const bool& newline = true) const noexcept {
+
+                std::cout << *this;
+                if (newline)
+                    std::cout << "\n";
+
+            }
+
+
+        protected:
+
+        // =============================================
+        // helpers
+        // =============================================
+
+            /// @brief Throw if the sizes of two umeasurement_arrays are different
+            void check_size(const basic_umeasurement_view<T>& other, const char* message) const {
+
+                if (this->size() != other.size())
+                    throw_invalid_argument(message);
+
+            }
+
+
+            /// @brief Check that two umeasurement_arrays can be added and get the factor converting other to the units of this
+            T check_addable(const basic_umeasurement_view<T>& other, const char* message) const {
+
+                this->check_size(other, message);
+                if (this->units_.base() != other.units().base())
+                    throw_invalid_argument("Cannot add umeasurement_arrays with different unit bases", measurement_errc::unit_mismatch);
+
+                return other.units().convertion_factor(this->units_);
+
+            }
+
+
+            /// @brief Throw if the uncertainties are not as many as the values or if any of them is negative
+            void check_uncertainties() const {
+
+                if (this->values_.size() != this->uncertainties_.size())
+                    throw_invalid_argument("Cannot instantiate an basic_umeasurement_array with a different number of values and uncertainties");
+
+                if (std::any_of(this->uncertainties_.begin(), this->uncertainties_.end(), [](const T& unc) { return unc < 0.0; }))
+                    throw_invalid_argument("Cannot instantiate an basic_umeasurement_array with a negative uncertainty");
+
+            }
+
+
+            /**
+             * @brief Raise every value of a buffer to a natural power by repeated squaring
+             *
+             * @param base: buffer of values
+             * @param power: unsigned as l-value const reference
+             *
+             * @return container
+             */
+            static container power(const container& base, const unsigned& power) {
+
+                const std::size_t size = base.size();
+                container result(size, 1.0);
+                container square(base);
+                for (unsigned n{power}; n != 0; n >>= 1) {
+
+                    if (n & 1)
+                        for (std::size_t i{0}; i < size; ++i)
+                            result[i] *= square[i];
+
+                    if (n > 1)
+                        for (std::size_t i{0}; i < size; ++i)
+                            square[i] *= square[i];
+
+                }
+
+                return result;
+
+            }
+
+
+        // =============================================
+        // class members
+        // =============================================
+
+            container values_; ///< The numerical values of the umeasurements
+
+            container uncertainties_; ///< The uncertainties of the umeasurements
+
+            unit units_; ///< The units shared by all the umeasurements
+
+
+    }; // class basic_umeasurement_array
+
+
+    using umeasurement_array = basic_umeasurement_array<scalar>; ///< umeasurement_array of double precision values and uncertainties
+
+    using float_umeasurement_array = basic_umeasurement_array<float>; ///< umeasurement_array of single precision values and uncertainties
+
+    using long_double_umeasurement_array = basic_umeasurement_array<long double>; ///< umeasurement_array of extended precision values and uncertainties
+
+
+} // namespace measurements
@@ -45,13 +45,13 @@ namespace measurements {
                                     const unit& mass_units = kg) { 
 
             if (mass_units.base_ != basis::kilogram) 
-                throw std::invalid_argument("Cannot convert from " + mass_units.base_.to_string() + " to kilogram in initialization of mass_umeasurement");
+                throw_conversion_error(mass_units.base_, "kilogram", "initialization of mass_umeasurement");
 
             else if (uncertainty < 0.0)
-                throw std::invalid_argument("Cannot initialize a mass_umeasurement with a negative uncertainty");
+                throw_invalid_argument("Cannot initialize a mass_umeasurement with a negative uncertainty");
 
             else if (value < 0.0)
-                throw std::invalid_argument("Cannot initialize a mass_umeasurement with a negative value");
+                throw_invalid_argument("Cannot initialize a mass_umeasurement with a negative value");
 
             else {
 
@@ -75,10 +75,10 @@ namespace measurements {
         constexpr mass_umeasurement(const umeasurement& other) {
 
             if (other.units_.base_ != basis::kilogram) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to kilogram in initialization of mass_umeasurement");
+                throw_conversion_error(other.units_.base_, "kilogram", "initialization of mass_umeasurement");
 
             else if (other.value_ < 0.0)
-                throw std::invalid_argument("Cannot initialize a mass_umeasurement with a negative value");
+                throw_invalid_argument("Cannot initialize a mass_umeasurement with a negative value");
 
             else {
 
@@ -102,10 +102,10 @@ namespace measurements {
         constexpr mass_umeasurement(umeasurement&& other) {
 
             if (other.units_.base_ != basis::kilogram) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to kilogram in initialization of mass_umeasurement");
+                throw_conversion_error(other.units_.base_, "kilogram", "initialization of mass_umeasurement");
 
             else if (other.value_ < 0.0)
-                throw std::invalid_argument("Cannot initialize a mass_umeasurement with a negative value");
+                throw_invalid_argument("Cannot initialize a mass_umeasurement with a negative value");
 
             else {
 
@@ -146,10 +146,10 @@ namespace measurements {
         constexpr mass_umeasurement& operator=(const umeasurement& other) {
 
             if (other.units_.base_ != basis::kilogram) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to rad in initialization of mass_umeasurement");
+                throw_conversion_error(other.units_.base_, "rad", "initialization of mass_umeasurement");
 
             else if (other.value_ < 0.0)
-                throw std::invalid_argument("Cannot initialize a mass_umeasurement with a negative value");
+                throw_invalid_argument("Cannot initialize a mass_umeasurement with a negative value");
 
             else {
 
@@ -172,10 +172,10 @@ namespace measurements {
         constexpr mass_umeasurement& operator=(umeasurement&& other) {
 
             if (other.units_.base_ != basis::kilogram) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to rad in initialization of mass_umeasurement");
+                throw_conversion_error(other.units_.base_, "rad", "initialization of mass_umeasurement");
 
             else if (other.value_ < 0.0)
-                throw std::invalid_argument("Cannot initialize a mass_umeasurement with a negative value");
+                throw_invalid_argument("Cannot initialize a mass_umeasurement with a negative value");
 
             else {
 
@@ -255,13 +255,13 @@ namespace measurements {
                                       const unit& length_units = m) { 
 
             if (length_units.base_ != basis::metre) 
-                throw std::invalid_argument("Cannot convert from " + length_units.base_.to_string() + " to metre in initialization of length_umeasurement");
+                throw_conversion_error(length_units.base_, "metre", "initialization of length_umeasurement");
 
             else if (uncertainty < 0.0)
-                throw std::invalid_argument("Cannot initialize a length_umeasurement with a negative uncertainty");
+                throw_invalid_argument("Cannot initialize a length_umeasurement with a negative uncertainty");
 
             else if (value < 0.0)
-                throw std::invalid_argument("Cannot initialize a length_umeasurement with a negative value");
+                throw_invalid_argument("Cannot initialize a length_umeasurement with a negative value");
 
             else {
 
@@ -285,10 +285,10 @@ namespace measurements {
         constexpr length_umeasurement(const umeasurement& other) {
 
             if (other.units_.base_ != basis::metre) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to metre in initialization of length_umeasurement");
+                throw_conversion_error(other.units_.base_, "metre", "initialization of length_umeasurement");
 
             else if (other.value_ < 0.0)
-                throw std::invalid_argument("Cannot initialize a length_umeasurement with a negative value");
+                throw_invalid_argument("Cannot initialize a length_umeasurement with a negative value");
 
             else {
 
@@ -312,10 +312,10 @@ namespace measurements {
         constexpr length_umeasurement(umeasurement&& other) {
 
             if (other.units_.base_ != basis::metre) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to metre in initialization of length_umeasurement");
+                throw_conversion_error(other.units_.base_, "metre", "initialization of length_umeasurement");
 
             else if (other.value_ < 0.0)
-                throw std::invalid_argument("Cannot initialize a length_umeasurement with a negative value");
+                throw_invalid_argument("Cannot initialize a length_umeasurement with a negative value");
 
             else {
 
@@ -356,10 +356,10 @@ namespace measurements {
         constexpr length_umeasurement& operator=(const umeasurement& other) {
 
             if (other.units_.base_ != basis::metre) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to rad in initialization of length_umeasurement");
+                throw_conversion_error(other.units_.base_, "rad", "initialization of length_umeasurement");
 
             else if (other.value_ < 0.0)
-                throw std::invalid_argument("Cannot initialize a length_umeasurement with a negative value");
+                throw_invalid_argument("Cannot initialize a length_umeasurement with a negative value");
 
             else {
 
@@ -382,10 +382,10 @@ namespace measurements {
         constexpr length_umeasurement& operator=(umeasurement&& other) {
 
             if (other.units_.base_ != basis::metre) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to rad in initialization of length_umeasurement");
+                throw_conversion_error(other.units_.base_, "rad", "initialization of length_umeasurement");
 
             else if (other.value_ < 0.0)
-                throw std::invalid_argument("Cannot initialize a length_umeasurement with a negative value");
+                throw_invalid_argument("Cannot initialize a length_umeasurement with a negative value");
 
             else {
 
@@ -465,13 +465,13 @@ namespace measurements {
                                     const unit& time_units = s) { 
 
             if (time_units.base_ != basis::second) 
-                throw std::invalid_argument("Cannot convert from " + time_units.base_.to_string() + " to second in initialization of time_umeasurement");
+                throw_conversion_error(time_units.base_, "second", "initialization of time_umeasurement");
 
             else if (uncertainty < 0.0)
-                throw std::invalid_argument("Cannot initialize a time_umeasurement with a negative uncertainty");
+                throw_invalid_argument("Cannot initialize a time_umeasurement with a negative uncertainty");
 
             else if (value < 0.0)
-                throw std::invalid_argument("Cannot initialize a time_umeasurement with a negative value");
+                throw_invalid_argument("Cannot initialize a time_umeasurement with a negative value");
 
             else {
 
@@ -495,10 +495,10 @@ namespace measurements {
         constexpr time_umeasurement(const umeasurement& other) {
 
             if (other.units_.base_ != basis::second) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to second in initialization of time_umeasurement");
+                throw_conversion_error(other.units_.base_, "second", "initialization of time_umeasurement");
 
             else if (other.value_ < 0.0)
-                throw std::invalid_argument("Cannot initialize a time_umeasurement with a negative value");
+                throw_invalid_argument("Cannot initialize a time_umeasurement with a negative value");
 
             else {
 
@@ -522,10 +522,10 @@ namespace measurements {
         constexpr time_umeasurement(umeasurement&& other) {
 
             if (other.units_.base_ != basis::second) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to second in initialization of time_umeasurement");
+                throw_conversion_error(other.units_.base_, "second", "initialization of time_umeasurement");
 
             else if (other.value_ < 0.0)
-                throw std::invalid_argument("Cannot initialize a time_umeasurement with a negative value");
+                throw_invalid_argument("Cannot initialize a time_umeasurement with a negative value");
 
             else {
 
@@ -566,10 +566,10 @@ namespace measurements {
         constexpr time_umeasurement& operator=(const umeasurement& other) {
 
             if (other.units_.base_ != basis::second) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to rad in initialization of time_umeasurement");
+                throw_conversion_error(other.units_.base_, "rad", "initialization of time_umeasurement");
 
             else if (other.value_ < 0.0)
-                throw std::invalid_argument("Cannot initialize a time_umeasurement with a negative value");
+                throw_invalid_argument("Cannot initialize a time_umeasurement with a negative value");
 
             else {
 
@@ -592,10 +592,10 @@ namespace measurements {
         constexpr time_umeasurement& operator=(umeasurement&& other) {
 
             if (other.units_.base_ != basis::second) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to rad in initialization of time_umeasurement");
+                throw_conversion_error(other.units_.base_, "rad", "initialization of time_umeasurement");
 
             else if (other.value_ < 0.0)
-                throw std::invalid_argument("Cannot initialize a time_umeasurement with a negative value");
+                throw_invalid_argument("Cannot initialize a time_umeasurement with a negative value");
 
             else {
 
@@ -674,10 +674,10 @@ namespace measurements {
                                      const unit& speed_units = m / s) {
 
             if (speed_units.base_ != basis::metre / basis::second) 
-                throw std::invalid_argument("Cannot convert from " + speed_units.base_.to_string() + " to metre / second in initialization of speed_umeasurement");
+                throw_conversion_error(speed_units.base_, "metre / second", "initialization of speed_umeasurement");
 
             else if (uncertainty < 0.0)
-                throw std::invalid_argument("Cannot initialize a speed_umeasurement with a negative uncertainty");
+                throw_invalid_argument("Cannot initialize a speed_umeasurement with a negative uncertainty");
 
             else {
 
@@ -699,7 +699,7 @@ namespace measurements {
 
 
             if (other.units_.base_ != basis::metre / basis::second) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to metre / second in initialization of speed_umeasurement");
+                throw_conversion_error(other.units_.base_, "metre / second", "initialization of speed_umeasurement");
 
             else {
 
@@ -720,7 +720,7 @@ namespace measurements {
         constexpr speed_umeasurement(umeasurement&& other)  {
 
             if (other.units_.base_ != basis::metre / basis::second) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to metre / second in initialization of speed_umeasurement");
+                throw_conversion_error(other.units_.base_, "metre / second", "initialization of speed_umeasurement");
 
             else {
 
@@ -785,10 +785,10 @@ namespace measurements {
                                             const unit& acceleration_units = m / s.square()) {
 
             if (acceleration_units.base_ != basis::metre / basis::second.square()) 
-                throw std::invalid_argument("Cannot convert from " + acceleration_units.base_.to_string() + " to metre / second^2 in initialization of acceleration_umeasurement");
+                throw_conversion_error(acceleration_units.base_, "metre / second^2", "initialization of acceleration_umeasurement");
 
             else if (uncertainty < 0.0)
-                throw std::invalid_argument("Cannot initialize a acceleration_umeasurement with a negative uncertainty");
+                throw_invalid_argument("Cannot initialize a acceleration_umeasurement with a negative uncertainty");
 
             else {
 
@@ -810,7 +810,7 @@ namespace measurements {
 
 
             if (other.units_.base_ != basis::metre / basis::second.square()) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to metre / second^2 in initialization of acceleration_umeasurement");
+                throw_conversion_error(other.units_.base_, "metre / second^2", "initialization of acceleration_umeasurement");
 
             else {
 
@@ -831,7 +831,7 @@ namespace measurements {
         constexpr acceleration_umeasurement(umeasurement&& other)  {
 
             if (other.units_.base_ != basis::metre / basis::second.square()) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to metre / second^2 in initialization of acceleration_umeasurement");
+                throw_conversion_error(other.units_.base_, "metre / second^2", "initialization of acceleration_umeasurement");
 
             else {
 
@@ -896,10 +896,10 @@ namespace measurements {
                                      const unit& force_units = N) {
 
             if (force_units.base_ != basis::kilogram * basis::metre / basis::second.square()) 
-                throw std::invalid_argument("Cannot convert from " + force_units.base_.to_string() + " to kilogram * metre / second^2 in initialization of force_umeasurement");
+                throw_conversion_error(force_units.base_, "kilogram * metre / second^2", "initialization of force_umeasurement");
 
             else if (uncertainty < 0.0)
-                throw std::invalid_argument("Cannot initialize a force_umeasurement with a negative uncertainty");
+                throw_invalid_argument("Cannot initialize a force_umeasurement with a negative uncertainty");
 
             else {
 
@@ -921,7 +921,7 @@ namespace measurements {
 
 
             if (other.units_.base_ != basis::kilogram * basis::metre / basis::second.square()) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to kilogram * metre / second^2 in initialization of force_umeasurement");
+                throw_conversion_error(other.units_.base_, "kilogram * metre / second^2", "initialization of force_umeasurement");
 
             else {
 
@@ -942,7 +942,7 @@ namespace measurements {
         constexpr force_umeasurement(umeasurement&& other)  {
 
             if (other.units_.base_ != basis::kilogram * basis::metre / basis::second.square()) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to kilogram * metre / second^2 in initialization of force_umeasurement");
+                throw_conversion_error(other.units_.base_, "kilogram * metre / second^2", "initialization of force_umeasurement");
 
             else {
 
@@ -1007,10 +1007,10 @@ namespace measurements {
                                      const unit& angle_units = rad) {
 
             if (angle_units.base_ != basis::default_type) 
-                throw std::invalid_argument("Cannot convert from " + angle_units.base_.to_string() + " to rad in initialization of angle_umeasurement");
+                throw_conversion_error(angle_units.base_, "rad", "initialization of angle_umeasurement");
 
             else if (uncertainty < 0.0)
-                throw std::invalid_argument("Cannot initialize a angle_umeasurement with a negative uncertainty");
+                throw_invalid_argument("Cannot initialize a angle_umeasurement with a negative uncertainty");
 
             else {
 
@@ -1032,7 +1032,7 @@ namespace measurements {
 
 
             if (other.units_.base_ != basis::default_type) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to rad in initialization of angle_umeasurement");
+                throw_conversion_error(other.units_.base_, "rad", "initialization of angle_umeasurement");
 
             else {
 
@@ -1053,7 +1053,7 @@ namespace measurements {
         constexpr angle_umeasurement(umeasurement&& other)  {
 
             if (other.units_.base_ != basis::default_type) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to rad in initialization of angle_umeasurement");
+                throw_conversion_error(other.units_.base_, "rad", "initialization of angle_umeasurement");
 
             else {
 
@@ -1094,7 +1094,7 @@ namespace measurements {
         constexpr angle_umeasurement& operator=(const umeasurement& other) {
 
             if (other.units_.base_ != basis::default_type) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to rad in initialization of angle_umeasurement");
+                throw_conversion_error(other.units_.base_, "rad", "initialization of angle_umeasurement");
 
             else {
 
@@ -1117,7 +1117,7 @@ namespace measurements {
         constexpr angle_umeasurement& operator=(umeasurement&& other) {
 
             if (other.units_.base_ != basis::default_type) 
-                throw std::invalid_argument("Cannot convert from " + other.units_.base_.to_string() + " to rad in initialization of angle_umeasurement");
+                throw_conversion_error(other.units_.base_, "rad", "initialization of angle_umeasurement");
 
             else {
 
@@ -0,0 +1,133 @@
+/**
+ * @file    umeasurement_view.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the definition and implementation of the umeasurement_view class,
+ *          a non-owning view of buffers of values and uncertainties sharing the same unit
+ * @date    2023-01-24
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    /**
+     * @brief A class for viewing two contiguous buffers of values and uncertainties sharing the same unit as umeasurements, without copying them
+     *
+     * @tparam T: type of the values and of the uncertainties, as float, double or long double
+     * @note The buffers must outlive the umeasurement_view
+     * @see umeasurement_array
+     */
+    template <typename T>
+    class basic_umeasurement_view {
+
+
+        public:
+
+        // =============================================
+        // constructors & destructor
+        // =============================================
+
+            /// @brief Construct a new empty unitless umeasurement_view object
+            constexpr basic_umeasurement_view() noexcept :
+
+                values_(),
+                uncertainties_(),
+                units_() {}
+
+
+            /**
+             * @brief Construct a new umeasurement_view object
+             *
+             * @param values: buffer of the values
+             * @param uncertainties: buffer of the uncertainties, as many as the values
+             * @param units: unit of the values as l-value const reference
+             */
+            basic_umeasurement_view(std::span<const T> values,
+                                    std::span<const T> uncertainties,
+                                    const unit& units) :
+
+                values_(values),
+                uncertainties_(uncertainties),
+                units_(units) {
+
+                if (values.size() != uncertainties.size())
+                    throw std::invalid_argument("Cannot view a different number of values and uncertainties");
+
+            }
+
+
+        // =============================================
+        // operators
+        // =============================================
+
+            /**
+             * @brief Get an element of the umeasurement_view
+             *
+             * @param index: position of the element
+             *
+             * @return umeasurement
+             */
+            basic_umeasurement<T> operator[](const std::size_t& index) const {
+
+                return { this->values_[index], this->uncertainties_[index], this->units_ };
+
+            }
+
+
+            /// @brief Get the values of the umeasurement_view as a measurement_view
+            constexpr operator basic_measurement_view<T>() const noexcept {
+
+                return { this->values_, this->units_ };
+
+            }
+
+
+        // =============================================
+        // get methods
+        // =============================================
+
+            /// @brief Get the number of elements of the umeasurement_view
+            constexpr std::size_t size() const noexcept { return this->values_.size(); }
+
+            /// @brief Check if the umeasurement_view is empty
+            constexpr bool empty() const noexcept { return this->values_.empty(); }
+
+            /// @brief Get the values of the umeasurement_view
+            constexpr std::span<const T> values() const noexcept { return this->values_; }
+
+            /// @brief Get the uncertainties of the umeasurement_view
+            constexpr std::span<const T> uncertainties() const noexcept { return this->uncertainties_; }
+
+            /// @brief Get the units of the umeasurement_view
+            constexpr const unit& units() const noexcept { return this->units_; }
+
+
+        private:
+
+        // =============================================
+        // class members
+        // =============================================
+
+            std::span<const T> values_; ///< The numerical values of the umeasurements
+
+            std::span<const T> uncertainties_; ///< The uncertainties of the umeasurements
+
+            unit units_; ///< The units shared by all the umeasurements
+
+
+    }; // class basic_umeasurement_view
+
+
+    using umeasurement_view = basic_umeasurement_view<scalar>; ///< umeasurement_view of double precision values and uncertainties
+
+    using float_umeasurement_view = basic_umeasurement_view<float>; ///< umeasurement_view of single precision values and uncertainties
+
+    using long_double_umeasurement_view = basic_umeasurement_view<long double>; ///< umeasurement_view of extended precision values and uncertainties
+
+
+} // namespace measurements
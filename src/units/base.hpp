@@ -29,8 +29,7 @@ namespace measurements {
                 /// @brief Construct a new default unit_base object
                 explicit constexpr unit_base() noexcept :
 
-                    metre_{0}, second_{0}, kilogram_{0}, 
-                    ampere_{0}, kelvin_{0}, mole_{0}, candela_{0} {}
+                    data_{bitwidth::bias_word} {}
 
 
                 /**
@@ -43,6 +42,8 @@ namespace measurements {
                  * @param kelvins: power of kelvin
                  * @param moles: power of mole
                  * @param candelas: power of candela
+                 * 
+                 * @note A power outside [bitwidth::min_exponent, bitwidth::max_exponent] flags the unit_base as overflowed
                  */
                 explicit constexpr unit_base(int metres, 
                                              int seconds, 
@@ -52,134 +53,26 @@ namespace measurements {
                                              int moles, 
                                              int candelas) noexcept : 
                         
-                    metre_(metres), second_(seconds), kilogram_(kilograms), 
-                    ampere_(amperes), kelvin_(kelvins), mole_(moles), candela_(candelas) {}
+                    data_{unit_base::pack({ metres, seconds, kilograms, amperes, kelvins, moles, candelas })} {}
 
 
                 /**
                  * @brief Construct a new unit_base object from a string
                  * 
                  * @param unit_string: string represents the unit_base
+                 * 
+                 * @note The string is read by parse_unit and the prefixes are discarded, it throws if the string is not a valid unit
+                 * @see parse_unit
                  */
-                constexpr unit_base(const std::string& unit_string) noexcept : 
-                    
-                    metre_{0}, second_{0}, kilogram_{0},
-                    ampere_{0}, kelvin_{0}, mole_{0}, candela_{0} {
-                    
-                    if (!unit_string.empty()) {
-
-                        std::size_t finder = unit_string.find('m');
-                        if (finder != std::string::npos) {
-
-                            if (finder == unit_string.size() - 1 || unit_string.at(finder + 1) != '^') 
-                                this->metre_ = 1; 
-                            else {
-                                if (unit_string.at(finder + 2) == '-') 
-                                    this->metre_ -= std::stoi(unit_string.substr(finder + 3));
-                                else 
-                                    this->metre_ = std::stoi(unit_string.substr(finder + 2));
-                            }
-                            
-                        }
-
-                        finder = unit_string.find('s');
-                        if (finder != std::string::npos) {
-
-                            if (finder == unit_string.size() - 1 || unit_string.at(finder + 1) != '^') 
-                                this->second_ = 1; 
-                            else {
-                                if (unit_string.at(finder + 2) == '-') 
-                                    this->second_ -= std::stoi(unit_string.substr(finder + 3));
-                                else 
-                                    this->second_ = std::stoi(unit_string.substr(finder + 2));
-                            }
-                            
-                        }
-
-                        finder = unit_string.find("kg");
-                        if (finder != std::string::npos) {
-
-                            if (finder == unit_string.size() - 1 || unit_string.at(finder + 1) != '^') 
-                                this->kilogram_ = 1; 
-                            else {
-                                if (unit_string.at(finder + 2) == '-') 
-                                    this->kilogram_ -= std::stoi(unit_string.substr(finder + 3));
-                                else 
-                                    this->kilogram_ = std::stoi(unit_string.substr(finder + 2));
-                            }
-
-                        }
-
-                        finder = unit_string.find('A');
-                        if (finder != std::string::npos) {
-
-                            if (finder == unit_string.size() - 1 || unit_string.at(finder + 1) != '^') 
-                                this->ampere_ = 1; 
-                            else {
-                                if (unit_string.at(finder + 2) == '-') 
-                                    this->ampere_ -= std::stoi(unit_string.substr(finder + 3));
-                                else 
-                                    this->ampere_ = std::stoi(unit_string.substr(finder + 2));
-                            }                            
-                        }
-
-                        finder = unit_string.find('K');
-                        if (finder != std::string::npos) {
-
-                            if (finder == unit_string.size() - 1 || unit_string.at(finder + 1) != '^') 
-                                this->kelvin_ = 1; 
-                            else {
-                                if (unit_string.at(finder + 2) == '-') 
-                                    this->kelvin_ -= std::stoi(unit_string.substr(finder + 3));
-                                else 
-                                    this->kelvin_ = std::stoi(unit_string.substr(finder + 2));
-                            }
+                explicit constexpr unit_base(std::string_view unit_string);
 
-                        }
-
-                        finder = unit_string.find("mol");
-                        if (finder != std::string::npos) {
-
-                            if (finder == unit_string.size() - 1 || unit_string.at(finder + 1) != '^') 
-                                this->mole_ = 1; 
-                            else {
-                                if (unit_string.at(finder + 2) == '-') 
-                                    this->mole_ -= std::stoi(unit_string.substr(finder + 3));
-                                else 
-                                    this->mole_ = std::stoi(unit_string.substr(finder + 2));
-                            }
-
-                        }
-
-                        finder = unit_string.find("cd");
-                        if (finder != std::string::npos) {
-
-                            if (finder == unit_string.size() - 1 || unit_string.at(finder + 1) != '^') 
-                                this->candela_ = 1; 
-                            else {
-                                if (unit_string.at(finder + 2) == '-') 
-                                    this->candela_ -= std::stoi(unit_string.substr(finder + 3));
-                                else 
-                                    this->candela_ = std::stoi(unit_string.substr(finder + 2));
-                            }
-                            
-                        }
-
-                    } 
-
-                }
-                
 
                 /**
                  * @brief Copy construct a new unit_base from an other unit_base object
                  * 
                  * @param other: unit_base object to copy as l-value const reference
                  */
-                constexpr unit_base(const unit_base& other) noexcept : 
-
-                    metre_(other.metre_), second_(other.second_), 
-                    kilogram_(other.kilogram_), ampere_(other.ampere_), 
-                    kelvin_(other.kelvin_), mole_(other.mole_), candela_(other.candela_) {}
+                constexpr unit_base(const unit_base& other) noexcept = default;
 
 
                 /// @brief Default destructor
@@ -197,23 +90,7 @@ namespace measurements {
                  * 
                  * @return constexpr unit_base&
                  */
-                constexpr unit_base& operator=(const unit_base& other) noexcept {
-
-                    if (*this != other) {
-
-                        this->metre_ = other.metre_; 
-                        this->second_ = other.second_; 
-                        this->kilogram_ = other.kilogram_; 
-                        this->ampere_ = other.ampere_; 
-                        this->kelvin_ = other.kelvin_; 
-                        this->mole_ = other.mole_; 
-                        this->candela_ = other.candela_; 
-
-                    }
-
-                    return *this; 
-
-                }
+                constexpr unit_base& operator=(const unit_base& other) noexcept = default;
 
 
                 /**
@@ -225,13 +102,7 @@ namespace measurements {
                  */
                 constexpr unit_base& operator*=(const unit_base& other) noexcept {
 
-                    this->metre_ += other.metre_; 
-                    this->second_ += other.second_; 
-                    this->kilogram_ += other.kilogram_; 
-                    this->ampere_ += other.ampere_; 
-                    this->kelvin_ += other.kelvin_; 
-                    this->mole_ += other.mole_; 
-                    this->candela_ += other.candela_; 
+                    this->data_ = unit_base::checked(this->data_ + other.data_ - bitwidth::bias_word, this->data_ | other.data_); 
 
                     return *this; 
 
@@ -247,13 +118,7 @@ namespace measurements {
                  */
                 constexpr unit_base& operator/=(const unit_base& other) noexcept {
 
-                    this->metre_ -= other.metre_; 
-                    this->second_ -= other.second_; 
-                    this->kilogram_ -= other.kilogram_; 
-                    this->ampere_ -= other.ampere_; 
-                    this->kelvin_ -= other.kelvin_; 
-                    this->mole_ -= other.mole_; 
-                    this->candela_ -= other.candela_; 
+                    this->data_ = unit_base::checked(this->data_ + bitwidth::bias_word - other.data_, this->data_ | other.data_); 
 
                     return *this; 
 
@@ -266,16 +131,12 @@ namespace measurements {
                  * @param other: unit_base object to multiply with as l-value const reference
                  * 
                  * @return constexpr unit_base 
+                 * 
+                 * @note All the powers are summed at once with a single integer addition of the packed words
                  */
                 constexpr unit_base operator*(const unit_base& other) const noexcept {
 
-                    return unit_base(this->metre_ + other.metre_, 
-                                     this->second_ + other.second_, 
-                                     this->kilogram_ + other.kilogram_, 
-                                     this->ampere_ + other.ampere_, 
-                                     this->kelvin_ + other.kelvin_, 
-                                     this->mole_ + other.mole_, 
-                                     this->candela_ + other.candela_); 
+                    return unit_base::from_word(unit_base::checked(this->data_ + other.data_ - bitwidth::bias_word, this->data_ | other.data_)); 
 
                 }
 
@@ -286,16 +147,12 @@ namespace measurements {
                  * @param other: unit_base object to divide with as l-value const reference
                  * 
                  * @return constexpr unit_base 
+                 * 
+                 * @note All the powers are subtracted at once with a single integer subtraction of the packed words
                  */
                 constexpr unit_base operator/(const unit_base& other) const noexcept {
                 
-                    return unit_base(this->metre_ - other.metre_, 
-                                     this->second_ - other.second_, 
-                                     this->kilogram_ - other.kilogram_, 
-                                     this->ampere_ - other.ampere_, 
-                                     this->kelvin_ - other.kelvin_, 
-                                     this->mole_ - other.mole_, 
-                                     this->candela_ - other.candela_); 
+                    return unit_base::from_word(unit_base::checked(this->data_ + bitwidth::bias_word - other.data_, this->data_ | other.data_)); 
 
                 }
 
@@ -309,13 +166,7 @@ namespace measurements {
                  */
                 constexpr bool operator==(const unit_base& other) const noexcept {
                 
-                    return this->metre_ == other.metre_ &&
-                           this->second_ == other.second_ &&
-                           this->kilogram_ == other.kilogram_ &&
-                           this->ampere_ == other.ampere_ &&
-                           this->candela_ == other.candela_ &&
-                           this->kelvin_ == other.kelvin_ &&
-                           this->mole_ == other.mole_;   
+                    return this->data_ == other.data_;   
 
                 }
 
@@ -329,13 +180,7 @@ namespace measurements {
                  */                    
                 constexpr bool operator!=(const unit_base& other) const noexcept { 
                     
-                    return this->metre_ != other.metre_ ||
-                           this->second_ != other.second_ ||
-                           this->kilogram_ != other.kilogram_ ||
-                           this->ampere_ != other.ampere_ ||
-                           this->candela_ != other.candela_ ||
-                           this->kelvin_ != other.kelvin_ ||
-                           this->mole_ != other.mole_;   
+                    return this->data_ != other.data_;   
                     
                 }
 
@@ -350,7 +195,8 @@ namespace measurements {
                  */
                 friend std::ostream& operator<<(std::ostream& os, const unit_base& base) noexcept {
 
-                    os << base.to_string(); 
+                    char buffer[unit_base::max_chars];
+                    os.write(buffer, to_chars(buffer, buffer + unit_base::max_chars, base).ptr - buffer);
 
                     return os; 
 
@@ -367,7 +213,8 @@ namespace measurements {
                  */
                 friend std::ofstream& operator<<(std::ofstream& file, const unit_base& base) noexcept {
 
-                    file << base.to_string(); 
+                    char buffer[unit_base::max_chars];
+                    file.write(buffer, to_chars(buffer, buffer + unit_base::max_chars, base).ptr - buffer);
 
                     return file; 
 
@@ -385,13 +232,7 @@ namespace measurements {
                  */
                 constexpr unit_base inv() const noexcept {
                 
-                    return unit_base(-this->metre_, 
-                                     -this->second_, 
-                                     -this->kilogram_, 
-                                     -this->ampere_, 
-                                     -this->kelvin_, 
-                                     -this->mole_, 
-                                     -this->candela_);
+                    return unit_base::from_word(unit_base::checked(2 * bitwidth::bias_word - (this->data_ & bitwidth::word_mask), this->data_));
 
                 }
 
@@ -402,16 +243,22 @@ namespace measurements {
                  * @param power 
                  * 
                  * @return constexpr unit_base 
+                 * 
+                 * @note The power is computed by repeated squaring of the packed word
                  */
                 constexpr unit_base pow(const int& power) const noexcept { 
 
-                    return unit_base(this->metre_ * power, 
-                                     this->second_ * power, 
-                                     this->kilogram_ * power, 
-                                     this->ampere_ * power, 
-                                     this->kelvin_ * power, 
-                                     this->mole_ * power, 
-                                     this->candela_ * power);
+                    unit_base base((power < 0) ? this->inv() : *this); 
+                    unit_base result; 
+                    for (int exponent{(power < 0) ? -power : power}; exponent > 0; exponent >>= 1) {
+
+                        if (exponent & 1) 
+                            result *= base; 
+                        base *= base; 
+
+                    }
+
+                    return result; 
 
                 }
 
@@ -423,13 +270,7 @@ namespace measurements {
                  */
                 constexpr unit_base square() const noexcept { 
                     
-                    return unit_base(this->metre_ * 2, 
-                                     this->second_ * 2, 
-                                     this->kilogram_ * 2, 
-                                     this->ampere_ * 2, 
-                                     this->kelvin_ * 2, 
-                                     this->mole_ * 2, 
-                                     this->candela_ * 2);
+                    return *this * *this;
 
                 }
 
@@ -441,13 +282,7 @@ namespace measurements {
                  */
                 constexpr unit_base cube() const noexcept { 
                     
-                    return unit_base(this->metre_ * 3, 
-                                     this->second_ * 3, 
-                                     this->kilogram_ * 3, 
-                                     this->ampere_ * 3, 
-                                     this->kelvin_ * 3, 
-                                     this->mole_ * 3, 
-                                     this->candela_ * 3);
+                    return *this * *this * *this;
 
                 }
 
@@ -462,13 +297,13 @@ namespace measurements {
                 constexpr unit_base root(const int& power) const {
 
                     if (this->has_valid_root(power)) 
-                        return unit_base(this->metre_ / power,
-                                         this->second_ / power,
-                                         this->kilogram_ / power,
-                                         this->ampere_ / power,
-                                         this->kelvin_ / power,
-                                         this->mole_ / power,
-                                         this->candela_ / power);
+                        return unit_base(this->metre() / power,
+                                         this->second() / power,
+                                         this->kilogram() / power,
+                                         this->ampere() / power,
+                                         this->kelvin() / power,
+                                         this->mole() / power,
+                                         this->candela() / power);
 
                     else 
                         throw std::invalid_argument("Invalid root power"); 
@@ -512,63 +347,149 @@ namespace measurements {
                  * @return bool 
                  */
                 constexpr bool has_valid_root(const int& power) const noexcept {
-                
-                    return (this->metre_ % power == 0) &&
-                           (this->second_ % power == 0) &&
-                           (this->kilogram_ % power == 0) &&
-                           (this->ampere_ % power == 0) &&
-                           (this->candela_ % power == 0) &&
-                           (this->kelvin_ % power == 0) &&
-                           (this->mole_ % power == 0);
+
+                    if (power == 0 || this->overflow()) 
+                        return false; 
+
+                    for (uint32_t i{0}; i < bitwidth::lanes; ++i) 
+                        if (this->exponent(i) % power != 0) 
+                            return false; 
+
+                    return true; 
 
                 }      
 
 
                 /**
-                 * @brief Units litterals to string
+                 * @brief Check if an exponent overflowed in the construction of this unit_base or in one of its operands
+                 * 
+                 * @return bool 
+                 * 
+                 * @note An overflowed unit_base has all the exponents set to zero
+                 */
+                constexpr bool overflow() const noexcept {
+
+                    return (this->data_ & bitwidth::overflow_flag) != 0;
+
+                }
+
+
+                /**
+                 * @brief Get the exponent stored in a lane
+                 * 
+                 * @param lane: index of the lane, see bitwidth
+                 * 
+                 * @return constexpr int 
+                 */
+                constexpr int exponent(const uint32_t& lane) const noexcept {
+
+                    return static_cast<int>((this->data_ >> (lane * bitwidth::lane)) & bitwidth::lane_mask) - bitwidth::bias;
+
+                }
+
+
+                /// @brief Get the metre exponent
+                constexpr int metre() const noexcept { return this->exponent(bitwidth::metre); }
+
+                /// @brief Get the second exponent
+                constexpr int second() const noexcept { return this->exponent(bitwidth::second); }
+
+                /// @brief Get the kilogram exponent
+                constexpr int kilogram() const noexcept { return this->exponent(bitwidth::kilogram); }
+
+                /// @brief Get the ampere exponent
+                constexpr int ampere() const noexcept { return this->exponent(bitwidth::ampere); }
+
+                /// @brief Get the kelvin exponent
+                constexpr int kelvin() const noexcept { return this->exponent(bitwidth::kelvin); }
+
+                /// @brief Get the mole exponent
+                constexpr int mole() const noexcept { return this->exponent(bitwidth::mole); }
+
+                /// @brief Get the candela exponent
+                constexpr int candela() const noexcept { return this->exponent(bitwidth::candela); }
+
+
+                /**
+                 * @brief Write the unit_base in a buffer, without allocating
                  * 
-                 * @return std::string 
+                 * @param first: begin of the buffer
+                 * @param last: end of the buffer
+                 * @param base: unit_base as l-value const reference
+                 * 
+                 * @return std::to_chars_result
+                 * 
+                 * @note The factors are joined by '*', so that the string can be read back by parse_unit
+                 * @note On std::errc::value_too_large the content of the buffer is unspecified, unit_base::max_chars is always enough
+                 */
+                friend std::to_chars_result to_chars(char* first, char* last, const unit_base& base) noexcept {
+
+                    return base.to_chars_with_prefix(first, last, bitwidth::lanes, '\0');
+
+                }
+
+
+                /**
+                 * @brief Write the unit_base in a buffer, with a prefix symbol in front of the factor of a lane
+                 * 
+                 * @param first: begin of the buffer
+                 * @param last: end of the buffer
+                 * @param prefixed_lane: lane of the factor written with the prefix, bitwidth::lanes for none
+                 * @param prefix: symbol of the prefix
+                 * 
+                 * @return std::to_chars_result
+                 * 
+                 * @note The buffer needs one more char than for the unit_base alone
+                 */
+                std::to_chars_result to_chars_with_prefix(char* first, char* last, const uint32_t& prefixed_lane, const char& prefix) const noexcept {
+
+                    constexpr std::string_view symbols[bitwidth::lanes] = { "m", "s", "kg", "A", "K", "mol", "cd" };
+                    const unit_base& base = *this;
+
+                    char* ptr = first;
+                    for (uint32_t lane{0}; lane < bitwidth::lanes; ++lane) {
+
+                        const int power = base.exponent(lane);
+                        if (power == 0) 
+                            continue;
+
+                        // separator, prefix, symbol and caret
+                        const std::size_t size = (ptr != first) + (lane == prefixed_lane) + symbols[lane].size() + (power != 1);
+                        if (static_cast<std::size_t>(last - ptr) < size) 
+                            return { last, std::errc::value_too_large };
+
+                        if (ptr != first) 
+                            *ptr++ = '*';
+                        if (lane == prefixed_lane) 
+                            *ptr++ = prefix;
+                        ptr = std::copy(symbols[lane].begin(), symbols[lane].end(), ptr);
+                        if (power != 1) {
+
+                            *ptr++ = '^';
+                            const std::to_chars_result result = std::to_chars(ptr, last, power);
+                            if (result.ec != std::errc()) 
+                                return result;
+                            ptr = result.ptr;
+
+                        }
+
+                    }
+
+                    return { ptr, std::errc() };
+
+                }
+
+
+                /**
+                 * @brief Get the string representation of the unit_base
+                 * 
+                 * @return std::string
                  */
                 std::string to_string() const noexcept {
                     
-                    std::string unit_base_string("");   
-                    
-                    if (this->metre_ == 1) 
-                        unit_base_string.append("m");
-                    else if (this->metre_ != 0) 
-                        unit_base_string.append("m^" + std::to_string(metre_)); 
-
-                    if (this->second_ == 1) 
-                        unit_base_string.append("s"); 
-                    else if (this->second_ != 0) 
-                        unit_base_string.append("s^" + std::to_string(second_)); 
-
-                    if (this->kilogram_ == 1) 
-                        unit_base_string.append("kg"); 
-                    else if (this->kilogram_ != 0)    
-                        unit_base_string.append("kg^" + std::to_string(kilogram_)); 
-
-                    if (this->ampere_ == 1) 
-                        unit_base_string.append("A"); 
-                    else if (this->ampere_ != 0)  
-                        unit_base_string.append("A^" + std::to_string(ampere_)); 
-
-                    if (this->kelvin_ == 1) 
-                        unit_base_string.append("K");
-                    else if (this->kelvin_ != 0) 
-                        unit_base_string.append("K^" + std::to_string(kelvin_)); 
-
-                    if (this->mole_ == 1) 
-                        unit_base_string.append("mol"); 
-                    else if (this->mole_ != 0) 
-                        unit_base_string.append("mol^" + std::to_string(mole_)); 
-
-                    if (this->candela_ == 1) 
-                        unit_base_string.append("cd"); 
-                    else if (this->candela_ != 0) 
-                        unit_base_string.append("cd^" + std::to_string(candela_)); 
-
-                    return unit_base_string; 
+                    char buffer[unit_base::max_chars];
+
+                    return std::string(buffer, to_chars(buffer, buffer + unit_base::max_chars, *this).ptr);
                 
                 }
 
@@ -581,32 +502,81 @@ namespace measurements {
                 }
 
 
+            // =============================================
+            // packing helpers
+            // =============================================
+
+                /**
+                 * @brief Pack the seven exponents in a word
+                 * 
+                 * @param exponents: exponents ordered as the lanes in bitwidth
+                 * 
+                 * @return constexpr uint64_t 
+                 */
+                static constexpr uint64_t pack(const std::initializer_list<int>& exponents) noexcept {
+
+                    uint64_t word{0}; 
+                    uint32_t lane{0}; 
+                    for (const int& exponent : exponents) {
+
+                        if (exponent < bitwidth::min_exponent || exponent > bitwidth::max_exponent) 
+                            return bitwidth::bias_word | bitwidth::overflow_flag; 
+
+                        word |= static_cast<uint64_t>(exponent + bitwidth::bias) << (bitwidth::lane * lane++); 
+
+                    }
+
+                    return word; 
+
+                }
+
+
+                /**
+                 * @brief Validate the result of an operation on the packed words
+                 * 
+                 * @param word: result of the operation
+                 * @param operands: bitwise or of the operands, carrying their overflow flags
+                 * 
+                 * @return constexpr uint64_t 
+                 * 
+                 * @note Every lane is range-checked at once: after adding -min_exponent, a valid lane has its top bits equal to 0b01
+                 */
+                static constexpr uint64_t checked(const uint64_t& word, const uint64_t& operands) noexcept {
+
+                    const uint64_t lanes = word & bitwidth::word_mask; 
+
+                    if (((lanes + bitwidth::range_offset) & bitwidth::range_mask) != bitwidth::range_check || (operands & bitwidth::overflow_flag)) 
+                        return bitwidth::bias_word | bitwidth::overflow_flag; 
+
+                    return lanes; 
+
+                }
+
+
+                /**
+                 * @brief Construct a new unit_base from a packed word
+                 * 
+                 * @param word: packed exponents
+                 * 
+                 * @return constexpr unit_base 
+                 */
+                static constexpr unit_base from_word(const uint64_t& word) noexcept {
+
+                    unit_base base; 
+                    base.data_ = word; 
+
+                    return base; 
+
+                }
+
+
             // =============================================
             // struct members & friends
             // =============================================
 
-                signed int metre_    : bitwidth::metre;    ///< Metre exponent
-                
-                signed int second_   : bitwidth::second;   ///< Second exponent
-                
-                signed int kilogram_ : bitwidth::kilogram; ///< Kilogram exponent
-                
-                signed int ampere_   : bitwidth::ampere;   ///< Ampere exponent
-                
-                signed int kelvin_   : bitwidth::kelvin;   ///< Kelvin exponent
-                
-                signed int mole_     : bitwidth::mole;     ///< Mole exponent
-                
-                signed int candela_  : bitwidth::candela;  ///< Candela exponent
-    
+                uint64_t data_; ///< Packed exponents of the seven SI unit_bases, see bitwidth
 
-                static constexpr uint32_t bits[7] = { bitwidth::metre, 
-                                                      bitwidth::second, 
-                                                      bitwidth::kilogram, 
-                                                      bitwidth::ampere, 
-                                                      bitwidth::kelvin, 
-                                                      bitwidth::mole, 
-                                                      bitwidth::candela }; ///< Static array with the SI exponents
+                static constexpr std::size_t max_chars{64}; ///< Size of a buffer always large enough for to_chars
 
 
                 friend struct unit; ///< unit is a friend of unit_prefix 
@@ -618,4 +588,4 @@ namespace measurements {
     } // namespace units
         
 
-} // namespace measurements
\ No newline at end of file
+} // namespace measurements
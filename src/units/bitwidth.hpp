@@ -3,7 +3,7 @@
  * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
  * @brief   Bit guidelines for encoding unit_base exponents
  * @date    2023-01-01
- * 
+ *
  * @copyright Copyright (c) 2023
  */
 
@@ -17,24 +17,71 @@ namespace measurements {
     namespace units {
 
 
+        /**
+         * @brief The unit_base exponents are packed in a single 64-bit word, one 9-bit lane per SI unit_base.
+         *        Each lane stores the exponent plus a bias of 128 and valid exponents are in [-64, 63],
+         *        so that summing or subtracting two lanes never carries or borrows into the next one.
+         */
         namespace bitwidth {
 
 
-            constexpr uint32_t base_size{sizeof(uint32_t) == 8 ? 8 : 4};
-                
-            constexpr uint32_t metre{(base_size == 8) ? 8 : 4};
-                
-            constexpr uint32_t second{(base_size == 8) ? 8 : 4};
-                
-            constexpr uint32_t kilogram{(base_size == 8) ? 6 : 3};
-                
-            constexpr uint32_t ampere{(base_size == 8) ? 6 : 3};
-                
-            constexpr uint32_t candela{(base_size == 8) ? 4 : 2};
-                
-            constexpr uint32_t kelvin{(base_size == 8) ? 6 : 3};
-                
-            constexpr uint32_t mole{(base_size == 8) ? 4 : 2};
+            constexpr uint32_t lane{9}; ///< Number of bits of each exponent lane
+
+            constexpr uint32_t lanes{7}; ///< Number of lanes, one for each SI unit_base
+
+            constexpr int32_t bias{128}; ///< Bias added to each exponent before packing
+
+            constexpr int32_t min_exponent{-64}; ///< Smallest exponent that can be stored
+
+            constexpr int32_t max_exponent{63}; ///< Largest exponent that can be stored
+
+
+            constexpr uint32_t metre{0}; ///< Lane of the metre exponent
+
+            constexpr uint32_t second{1}; ///< Lane of the second exponent
+
+            constexpr uint32_t kilogram{2}; ///< Lane of the kilogram exponent
+
+            constexpr uint32_t ampere{3}; ///< Lane of the ampere exponent
+
+            constexpr uint32_t kelvin{4}; ///< Lane of the kelvin exponent
+
+            constexpr uint32_t mole{5}; ///< Lane of the mole exponent
+
+            constexpr uint32_t candela{6}; ///< Lane of the candela exponent
+
+
+            /**
+             * @brief Replicate a value in every lane of the packed word
+             *
+             * @param value: value of each lane
+             *
+             * @return constexpr uint64_t
+             */
+            constexpr uint64_t broadcast(const uint64_t& value) noexcept {
+
+                uint64_t word{0};
+                for (uint32_t i{0}; i < lanes; ++i)
+                    word |= value << (i * lane);
+
+                return word;
+
+            }
+
+
+            constexpr uint64_t lane_mask{(uint64_t{1} << lane) - 1}; ///< Mask of a single lane
+
+            constexpr uint64_t word_mask{broadcast(lane_mask)}; ///< Mask of all the lanes
+
+            constexpr uint64_t bias_word{broadcast(bias)}; ///< Packed word of a dimensionless unit_base
+
+            constexpr uint64_t overflow_flag{uint64_t{1} << 63}; ///< Sticky flag set when an exponent overflows
+
+            constexpr uint64_t range_offset{broadcast(-min_exponent)}; ///< Shift every valid lane into [128, 255]
+
+            constexpr uint64_t range_mask{broadcast(0x180)}; ///< The two top bits of each lane
+
+            constexpr uint64_t range_check{broadcast(0x080)}; ///< Expected top bits of each valid lane after the shift
 
 
         } // namespace bitwidth
@@ -43,4 +90,4 @@ namespace measurements {
     } // namespace units
 
 
-} // namespace measurements
\ No newline at end of file
+} // namespace measurements
@@ -0,0 +1,196 @@
+/**
+ * @file    convert.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the batched conversion kernels, converting buffers of values from an unit to another
+ * @date    2023-01-21
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    namespace units {
+
+
+        /**
+         * @brief Check that a buffer of values can be converted from an unit to another and get the conversion factor
+         *
+         * @param from: unit of the values
+         * @param to: desired unit
+         *
+         * @return scalar
+         */
+        inline scalar convertion_factor(const unit& from, const unit& to) {
+
+            if (from.base() != to.base())
+                throw_conversion_error(from.base(), to.base(), "conversion of a buffer of values");
+
+            return from.convertion_factor(to);
+
+        }
+
+
+        /**
+         * @brief Convert a buffer of values from an unit to another
+         *
+         * @param in: values expressed in from
+         * @param from: unit of the values
+         * @param to: desired unit
+         * @param out: values expressed in to, as many as in
+         *
+         * @note The units are checked and the factor is computed once for the whole buffer
+         * @note The values are counted as conversions by the instrumentation with a single update of the heatmap
+         * @note in and out may be the same buffer, but must not partially overlap
+         * @note The factor is computed as scalar and then rounded to T, so a buffer of float values is scaled in single precision
+         */
+        template <typename T>
+        void convert(std::span<const T> in,
+                     const unit& from,
+                     const unit& to,
+                     std::span<T> out) {
+
+            if (in.size() != out.size())
+                throw_invalid_argument("Cannot convert values into a buffer of a different size");
+
+            const T factor = static_cast<T>(convertion_factor(from, to));
+            if (from != to)
+                instrumentation::count_conversion(from, to, in.size());
+
+            const T* src = in.data();
+            T* dst = out.data();
+            const std::size_t size = in.size();
+
+            if (factor == 1.0) {
+
+                if (src != dst)
+                    std::copy(src, src + size, dst);
+
+            } else
+                for (std::size_t i{0}; i < size; ++i)
+                    dst[i] = factor * src[i];
+
+        }
+
+
+        /// @brief Convert a buffer of scalar values from an unit to another, see the templated overload
+        inline void convert(std::span<const scalar> in,
+                            const unit& from,
+                            const unit& to,
+                            std::span<scalar> out) {
+
+            convert<scalar>(in, from, to, out);
+
+        }
+
+
+        /**
+         * @brief Convert in place a buffer of values from an unit to another
+         *
+         * @param values: values expressed in from, overwritten with the values expressed in to
+         * @param from: unit of the values
+         * @param to: desired unit
+         */
+        inline void convert(std::span<scalar> values,
+                            const unit& from,
+                            const unit& to) {
+
+            convert(values, from, to, values);
+
+        }
+
+
+        /**
+         * @brief Convert the values and the uncertainties of a buffer of umeasurements from an unit to another
+         *
+         * @param values: values expressed in from
+         * @param uncertainties: uncertainties expressed in from
+         * @param from: unit of the values
+         * @param to: desired unit
+         * @param out_values: values expressed in to
+         * @param out_uncertainties: uncertainties expressed in to
+         *
+         * @note The factor of a conversion is always positive, so the uncertainties are scaled as the values
+         */
+        template <typename T>
+        void convert(std::span<const T> values,
+                     std::span<const T> uncertainties,
+                     const unit& from,
+                     const unit& to,
+                     std::span<T> out_values,
+                     std::span<T> out_uncertainties) {
+
+            if (values.size() != uncertainties.size())
+                throw_invalid_argument("Cannot convert a different number of values and uncertainties");
+
+            if (values.size() != out_values.size() || uncertainties.size() != out_uncertainties.size())
+                throw_invalid_argument("Cannot convert values into a buffer of a different size");
+
+            const T factor = static_cast<T>(convertion_factor(from, to));
+            if (from != to)
+                instrumentation::count_conversion(from, to, values.size());
+
+            if (factor == 1.0) {
+
+                if (values.data() != out_values.data())
+                    std::copy(values.begin(), values.end(), out_values.begin());
+                if (uncertainties.data() != out_uncertainties.data())
+                    std::copy(uncertainties.begin(), uncertainties.end(), out_uncertainties.begin());
+                return;
+
+            }
+
+            const T* x = values.data();
+            const T* sx = uncertainties.data();
+            T* y = out_values.data();
+            T* sy = out_uncertainties.data();
+            const std::size_t size = values.size();
+            for (std::size_t i{0}; i < size; ++i) {
+
+                y[i] = factor * x[i];
+                sy[i] = factor * sx[i];
+
+            }
+
+        }
+
+
+        /// @brief Convert the scalar values and uncertainties of a buffer of umeasurements from an unit to another, see the templated overload
+        inline void convert(std::span<const scalar> values,
+                            std::span<const scalar> uncertainties,
+                            const unit& from,
+                            const unit& to,
+                            std::span<scalar> out_values,
+                            std::span<scalar> out_uncertainties) {
+
+            convert<scalar>(values, uncertainties, from, to, out_values, out_uncertainties);
+
+        }
+
+
+        /**
+         * @brief Convert in place the values and the uncertainties of a buffer of umeasurements from an unit to another
+         *
+         * @param values: values expressed in from, overwritten with the values expressed in to
+         * @param uncertainties: uncertainties expressed in from, overwritten with the uncertainties expressed in to
+         * @param from: unit of the values
+         * @param to: desired unit
+         */
+        inline void convert(std::span<scalar> values,
+                            std::span<scalar> uncertainties,
+                            const unit& from,
+                            const unit& to) {
+
+            convert(values, uncertainties, from, to, values, uncertainties);
+
+        }
+
+
+    } // namespace units
+
+
+} // namespace measurements
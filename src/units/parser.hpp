@@ -0,0 +1,429 @@
+/**
+ * @file    parser.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the single-pass parser reading an unit from a string
+ * @date    2023-01-21
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    namespace units {
+
+
+        /// @brief Result of parse_unit, modelled on std::from_chars_result
+        struct parse_unit_result {
+
+            unit units; ///< parsed unit, unitless if ec is set
+
+            const char* ptr; ///< first character not read by the parser
+
+            std::errc ec; ///< std::errc() on success, std::errc::invalid_argument or std::errc::result_out_of_range otherwise
+
+        };
+
+
+        /// @brief Symbol of an unit known by the parser
+        struct unit_symbol {
+
+            std::string_view symbol; ///< symbol of the unit
+
+            unit_base base; ///< unit_base of the unit
+
+        };
+
+
+        /// @brief Symbol of an unit_prefix known by the parser
+        struct prefix_symbol {
+
+            std::string_view symbol; ///< symbol of the unit_prefix
+
+            unit_prefix prefix; ///< the unit_prefix
+
+        };
+
+
+        /// @brief Units known by the parser: the SI base units and the named derived units
+        constexpr unit_symbol unit_symbols[] = {
+
+            { "m", SI::basis::metre }, { "s", SI::basis::second }, { "kg", SI::basis::kilogram }, { "A", SI::basis::Ampere },
+            { "K", SI::basis::Kelvin }, { "mol", SI::basis::mole }, { "cd", SI::basis::candela }, { "rad", SI::basis::default_type },
+            { "Hz", SI::Hz.base() }, { "V", SI::V.base() }, { "N", SI::N.base() }, { "Pa", SI::Pa.base() },
+            { "J", SI::J.base() }, { "W", SI::W.base() }, { "C", SI::C.base() }, { "F", SI::F.base() },
+            { "Wb", SI::Wb.base() }, { "T", SI::T.base() }, { "H", SI::H.base() }
+
+        };
+
+
+        /// @brief Prefixes known by the parser, "µ" is accepted as micro
+        constexpr prefix_symbol prefix_symbols[] = {
+
+            { "y", SI::prefixes::yocto }, { "z", SI::prefixes::zepto }, { "a", SI::prefixes::atto }, { "f", SI::prefixes::femto },
+            { "p", SI::prefixes::pico }, { "n", SI::prefixes::nano }, { "u", SI::prefixes::micro }, { "µ", SI::prefixes::micro },
+            { "m", SI::prefixes::milli }, { "c", SI::prefixes::centi }, { "d", SI::prefixes::deci }, { "h", SI::prefixes::hecto },
+            { "k", SI::prefixes::kilo }, { "M", SI::prefixes::mega }, { "G", SI::prefixes::giga }, { "T", SI::prefixes::tera },
+            { "P", SI::prefixes::peta }, { "E", SI::prefixes::exa }, { "Z", SI::prefixes::zetta }, { "Y", SI::prefixes::yotta }
+
+        };
+
+
+        /**
+         * @brief Write an unit in a buffer, without allocating
+         *
+         * @param first: begin of the buffer
+         * @param last: end of the buffer
+         * @param units: unit as l-value const reference
+         *
+         * @return std::to_chars_result
+         */
+        inline std::to_chars_result to_chars(char* first, char* last, const unit& units) noexcept {
+
+            const unit_prefix& prefix = units.prefix();
+            if (prefix.exact() && prefix.exponent() == 0 && prefix.numerator() == 1 && prefix.denominator() == 1)
+                return to_chars(first, last, units.base());
+
+            // the prefix symbol in front of a factor, if the parser reads it back to the same multiplier,
+            // but never in front of kg, which already has a prefix: SI does not compound prefixes, as in "kkg"
+            for (const prefix_symbol& known : prefix_symbols) {
+
+                if (known.symbol.size() != 1 || known.symbol[0] != prefix.symbol())
+                    continue;
+
+                for (uint32_t lane{0}; lane < bitwidth::lanes; ++lane) {
+
+                    if (lane == bitwidth::kilogram)
+                        continue;
+
+                    const int power = units.base().exponent(lane);
+                    if (power != 0 && known.prefix.pow(power) == prefix)
+                        return units.base().to_chars_with_prefix(first, last, lane, prefix.symbol());
+
+                }
+
+            }
+
+            // otherwise the scale as a leading number: numerator, decimal exponent and denominator, or the double multiplier
+            std::to_chars_result result{ first, std::errc() };
+            const auto put = [&](const char& c) noexcept {
+
+                if (result.ptr == last)
+                    return false;
+                *result.ptr++ = c;
+                return true;
+
+            };
+
+            if (prefix.exact()) {
+
+                result = std::to_chars(result.ptr, last, prefix.numerator());
+                if (result.ec == std::errc() && prefix.exponent() != 0 && put('e'))
+                    result = std::to_chars(result.ptr, last, prefix.exponent());
+                if (result.ec == std::errc() && prefix.denominator() != 1 && put('/'))
+                    result = std::to_chars(result.ptr, last, prefix.denominator());
+
+            } else
+                result = std::to_chars(result.ptr, last, prefix.multiplier());
+
+            if (result.ec != std::errc() || units.base() == unit_base())
+                return result;
+
+            if (!put('*'))
+                return { last, std::errc::value_too_large };
+
+            return to_chars(result.ptr, last, units.base());
+
+        }
+
+
+        /**
+         * @brief Parse a positive number used as scale of an unit, as "1", "1e3" or "0.017453292519943295"
+         *
+         * @param ptr: first character of the number, moved past it
+         * @param last: end of the string
+         * @param scale: unit_prefix set to the number, without symbol
+         *
+         * @return constexpr std::errc
+         *
+         * @note A number with at most 9 significant digits gives an exact unit_prefix, a longer one is read as a double
+         */
+        constexpr std::errc parse_scale(const char*& ptr, const char* last, unit_prefix& scale) noexcept {
+
+            const auto is_digit = [](const char& c) constexpr noexcept { return c >= '0' && c <= '9'; };
+
+            const char* const first = ptr;
+            uint64_t mantissa{0};
+            int significant{0}, exponent{0};
+            bool dot{false};
+            for (; ptr != last; ++ptr) {
+
+                if (is_digit(*ptr)) {
+
+                    if (significant < 19 && (mantissa != 0 || *ptr != '0')) {
+
+                        mantissa = 10 * mantissa + static_cast<uint64_t>(*ptr - '0');
+                        ++significant;
+                        exponent -= dot;
+
+                    } else if (mantissa == 0)
+                        exponent -= dot;
+                    else
+                        exponent += !dot;
+
+                } else if (*ptr == '.' && !dot && last - ptr >= 2 && is_digit(ptr[1]))
+                    dot = true;
+                else
+                    break;
+
+            }
+
+            // the exponent is read only if digits follow, "E" is also the symbol of exa
+            if (last - ptr >= 2 && (*ptr == 'e' || *ptr == 'E') &&
+                (is_digit(ptr[1]) || (last - ptr >= 3 && (ptr[1] == '-' || ptr[1] == '+') && is_digit(ptr[2])))) {
+
+                ++ptr;
+                const bool negative = (*ptr == '-');
+                if (*ptr == '-' || *ptr == '+')
+                    ++ptr;
+
+                int power{0};
+                for (; ptr != last && is_digit(*ptr); ++ptr) {
+
+                    power = 10 * power + (*ptr - '0');
+                    if (power > 9999)
+                        return std::errc::result_out_of_range;
+
+                }
+                exponent += negative ? -power : power;
+
+            }
+
+            if (mantissa == 0)
+                return std::errc::invalid_argument;
+
+            if (significant <= 9)
+                scale = unit_prefix('\0', exponent, static_cast<uint32_t>(mantissa));
+
+            else if (std::is_constant_evaluated())
+                scale = unit_prefix(static_cast<scalar>(mantissa) * unit_prefix::power_of_ten(exponent), '\0');
+
+            else {
+
+                scalar value{0.0};
+                std::from_chars(first, ptr, value);
+                if (!(value > 0.0) || !std::isfinite(value))
+                    return std::errc::result_out_of_range;
+                scale = unit_prefix(value, '\0');
+
+            }
+
+            return std::errc();
+
+        }
+
+
+        /**
+         * @brief Parse an unit from a string in a single pass, without allocating
+         *
+         * @param str: string represents the unit
+         *
+         * @return constexpr parse_unit_result
+         *
+         * @note The grammar is factor (separator factor)*, where a separator is '*', '.', '·' or '/'
+         *       and a factor is [prefix]symbol[^[+|-]digits] or a positive number, as "1" or "1e3", which scales the unit.
+         *       The operators are applied from left to right, so "J/kg*K" is (J/kg)*K.
+         * @note A symbol is matched as a whole before trying to split a prefix from it, so "m" is metre, "mol" is mole,
+         *       "T" is tesla, while "ms" is millisecond and "Tm" is terametre.
+         * @note The parser stops at the first character that can not begin a factor or a separator, which is returned as ptr.
+         *       An empty string is a valid unitless unit.
+         * @warning The strings written before the factors were joined by '*' are not compatible: they concatenate the factors,
+         *          as "ms^-1" for m/s. When the metre with exponent 1 is followed by a single other factor, the string reads
+         *          as a prefixed unit ("ms^-1" is 1/ms, "mkg" is g) and the value silently changes by a power of ten,
+         *          the other concatenations fail to parse. Such files must be converted by writing '*' between the factors.
+         */
+        constexpr parse_unit_result parse_unit(std::string_view str) noexcept {
+
+            instrumentation::count(instrumentation::counter::parse);
+
+            const char* const first = str.data();
+            const char* const last = first + str.size();
+            const char* ptr = first;
+
+            const auto is_letter = [](const char& c) constexpr noexcept { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); };
+            const auto is_micro = [&](const char* p) constexpr noexcept { return last - p >= 2 && p[0] == '\xc2' && p[1] == '\xb5'; };
+            const auto is_dot = [&](const char* p) constexpr noexcept { return last - p >= 2 && p[0] == '\xc2' && p[1] == '\xb7'; };
+            const auto fail = [&](const std::errc& ec) constexpr noexcept { return parse_unit_result{ unit(), ptr, ec }; };
+
+            unit_base base;
+            unit_prefix prefix;
+            bool first_prefix{true};
+            bool divide{false};
+
+            if (ptr == last)
+                return { unit(), ptr, std::errc() };
+
+            while (true) {
+
+                // symbol, with an optional prefix
+                unit_base factor_base;
+                unit_prefix factor_prefix;
+                bool has_prefix{false};
+
+                if (*ptr >= '0' && *ptr <= '9') {
+
+                    const std::errc ec = parse_scale(ptr, last, factor_prefix);
+                    if (ec != std::errc())
+                        return fail(ec);
+                    has_prefix = (factor_prefix != unit_prefix());
+
+                } else {
+
+                    const char* token = ptr;
+                    if (is_micro(ptr))
+                        ptr += 2;
+                    while (ptr != last && is_letter(*ptr))
+                        ++ptr;
+
+                    const std::string_view symbol(token, static_cast<std::size_t>(ptr - token));
+                    if (symbol.empty()) {
+
+                        ptr = token;
+                        return fail(std::errc::invalid_argument);
+
+                    }
+
+                    bool found{false};
+                    for (const unit_symbol& known : unit_symbols)
+                        if (known.symbol == symbol) {
+
+                            factor_base = known.base;
+                            found = true;
+                            break;
+
+                        }
+
+                    if (!found)
+                        for (const prefix_symbol& known_prefix : prefix_symbols) {
+
+                            if (!symbol.starts_with(known_prefix.symbol))
+                                continue;
+
+                            const std::string_view rest = symbol.substr(known_prefix.symbol.size());
+                            for (const unit_symbol& known : unit_symbols)
+                                if (known.symbol == rest) {
+
+                                    factor_base = known.base;
+                                    factor_prefix = known_prefix.prefix;
+                                    has_prefix = true;
+                                    found = true;
+                                    break;
+
+                                }
+
+                            if (found)
+                                break;
+
+                        }
+
+                    if (!found) {
+
+                        ptr = token;
+                        return fail(std::errc::invalid_argument);
+
+                    }
+
+                }
+
+                // optional signed exponent
+                int power{1};
+                if (ptr != last && *ptr == '^') {
+
+                    ++ptr;
+                    bool negative{false};
+                    if (ptr != last && (*ptr == '-' || *ptr == '+'))
+                        negative = (*ptr++ == '-');
+
+                    if (ptr == last || !(*ptr >= '0' && *ptr <= '9'))
+                        return fail(std::errc::invalid_argument);
+
+                    power = 0;
+                    for (; ptr != last && *ptr >= '0' && *ptr <= '9'; ++ptr) {
+
+                        power = 10 * power + (*ptr - '0');
+                        if (power > bitwidth::max_exponent - bitwidth::min_exponent)
+                            return fail(std::errc::result_out_of_range);
+
+                    }
+
+                    if (negative)
+                        power = -power;
+
+                }
+
+                if (divide)
+                    power = -power;
+
+                base *= factor_base.pow(power);
+                if (has_prefix) {
+
+                    // the symbol of the unit is the one of the first prefix
+                    prefix = first_prefix ? factor_prefix.pow(power) : prefix * factor_prefix.pow(power);
+                    first_prefix = false;
+
+                }
+
+                // separator
+                if (ptr == last)
+                    break;
+
+                if (*ptr == '*' || *ptr == '.')
+                    divide = false, ++ptr;
+                else if (is_dot(ptr))
+                    divide = false, ptr += 2;
+                else if (*ptr == '/')
+                    divide = true, ++ptr;
+                else
+                    break;
+
+                if (ptr == last)
+                    return fail(std::errc::invalid_argument);
+
+            }
+
+            if (base.overflow())
+                return fail(std::errc::result_out_of_range);
+
+            return { unit(prefix, base), ptr, std::errc() };
+
+        }
+
+
+        constexpr unit_base::unit_base(std::string_view unit_string) :
+
+            unit_base(unit(unit_string).base_) {}
+
+
+        constexpr unit::unit(std::string_view unit_string) :
+
+            unit() {
+
+            const parse_unit_result result = parse_unit(unit_string);
+            if (result.ec == std::errc::result_out_of_range)
+                throw std::invalid_argument("The exponents of the unit are out of range");
+            if (result.ec != std::errc() || result.ptr != unit_string.data() + unit_string.size())
+                throw std::invalid_argument("Cannot parse an unit from the string");
+
+            *this = result.units;
+
+        }
+
+
+    } // namespace units
+
+
+} // namespace measurements
@@ -4,7 +4,7 @@
  * @brief   This file contains the definition and implementation of the unit_prefix struct,
  *          with all its methods, operators and possibly operations.
  * @date    2023-01-12
- * 
+ *
  * @copyright Copyright (c) 2023
  */
 
@@ -14,17 +14,24 @@
 
 namespace measurements {
 
-    
+
     namespace units {
 
 
-        /// @brief Struct represents an unit prefix using a multiplier (double) and a symbol (char)
+        /**
+         * @brief Struct represents an unit prefix using a decimal exponent, a rational scale and a symbol (char)
+         *
+         * @note The multiplier of the unit_prefix is numerator / denominator * 10^exponent
+         * @note All the operations are exact integer operations and can be evaluated at compile time
+         * @note A multiplier that is not a 32 bit rational times a power of ten, as pi / 180, is kept as a double:
+         *       the unit_prefix is not exact and its operations are floating point operations
+         */
         struct unit_prefix {
 
 
             // =============================================
             // constructor and destructor
-            // ============================================= 
+            // =============================================
 
                 /// @brief Construct a new default unit prefix object
                 explicit constexpr unit_prefix() noexcept {}
@@ -32,351 +39,595 @@ namespace measurements {
 
                 /**
                  * @brief Create a new unit_prefix object from a multiplier and a symbol
-                 * 
-                 * @param mult: scalar multiplier for scaling the measurement 
+                 *
+                 * @param mult: scalar multiplier for scaling the measurement
                  * @param symbol: char symbol for the string reppresentation
-                 * 
+                 *
                  * @note mult must be positive (> 0)
+                 * @note The unit_prefix is exact if mult is an integer times a power of ten or the inverse of an integer
                  */
-                explicit constexpr unit_prefix(const scalar& mult, 
-                                               const char& symbol) {
+                explicit constexpr unit_prefix(const scalar& mult,
+                                               const char& symbol) :
+
+                    symbol_{symbol} {
 
-                    if (mult <= 0) 
+                    if (!(mult > 0))
                         throw std::invalid_argument("unit_prefix multiplier must be positive");
 
-                    else {
+                    this->assign(mult);
 
-                        this->multiplier_ = mult;
-                        this->symbol_ = symbol;
-                        
-                    }
+                }
+
+
+                /**
+                 * @brief Create a new unit_prefix object from a symbol, a decimal exponent and a rational scale
+                 *
+                 * @param symbol: char symbol for the string reppresentation
+                 * @param exponent: power of ten of the multiplier
+                 * @param numerator: numerator of the scale of the multiplier
+                 * @param denominator: denominator of the scale of the multiplier
+                 *
+                 * @note numerator and denominator must be positive (> 0)
+                 */
+                explicit constexpr unit_prefix(const char& symbol,
+                                               const int& exponent,
+                                               const uint32_t& numerator = 1,
+                                               const uint32_t& denominator = 1) :
+
+                    symbol_{symbol} {
+
+                    if (numerator == 0 || denominator == 0)
+                        throw std::invalid_argument("unit_prefix scale must be positive");
+
+                    this->assign(exponent, numerator, denominator);
 
                 }
 
 
                 /**
                  * @brief Copy construct a new unit_prefix object from another unit_prefix
-                 * 
+                 *
                  * @param other: unit_prefix as l-value const reference
                  */
-                constexpr unit_prefix(const unit_prefix& other) noexcept : 
-
-                    multiplier_{other.multiplier_}, 
-                    symbol_{other.symbol_} {}
+                constexpr unit_prefix(const unit_prefix& other) noexcept = default;
 
 
                 /**
                  * @brief Copy construct a new unit_prefix object from another unit_prefix
-                 * 
+                 *
                  * @param other: unit_prefix as r-value reference
                  */
-                constexpr unit_prefix(unit_prefix&& other) noexcept : 
-
-                    multiplier_{std::move(other.multiplier_)}, 
-                    symbol_{std::move(other.symbol_)} {}
+                constexpr unit_prefix(unit_prefix&& other) noexcept = default;
 
 
                 /// @brief Default destructor
-                ~unit_prefix() noexcept = default; 
+                ~unit_prefix() noexcept = default;
 
 
             // =============================================
             // operators
-            // ============================================= 
+            // =============================================
 
                 /**
                  * @brief Copy assignment operator
-                 * 
+                 *
                  * @param other: unit_prefix to copy as l-value const reference
-                 * 
+                 *
                  * @return constexpr unit_prefix&
                  */
-                constexpr unit_prefix& operator=(const unit_prefix& other) noexcept {
-
-                    this->multiplier_ = other.multiplier_; 
-                    this->symbol_ = other.symbol_; 
-
-                    return *this; 
-
-                }
+                constexpr unit_prefix& operator=(const unit_prefix& other) noexcept = default;
 
 
                 /**
                  * @brief Copy assignment operator
-                 * 
+                 *
                  * @param other: unit_prefix to copy as r-value reference
-                 * 
+                 *
                  * @return constexpr unit_prefix&
                  */
-                constexpr unit_prefix& operator=(unit_prefix&& other) noexcept {
-
-                    this->multiplier_ = std::move(other.multiplier_); 
-                    this->symbol_ = std::move(other.symbol_); 
-
-                    return *this; 
-
-                }
+                constexpr unit_prefix& operator=(unit_prefix&& other) noexcept = default;
 
 
                 /**
-                 * @brief Multiply this unit_prefix to an unit_prefix by multiplying the multipliers together
-                 * 
+                 * @brief Multiply this unit_prefix to an unit_prefix by adding the exponents together
+                 *
                  * @param other: unit_prefix object to multiply with as l-value const reference
-                 * 
+                 *
                  * @return constexpr unit_prefix&
                  */
                 constexpr unit_prefix& operator*=(const unit_prefix& other) noexcept {
 
-                    this->multiplier_ *= other.multiplier_; 
+                    if (!this->exact_ || !other.exact_)
+                        this->assign(this->multiplier() * other.multiplier());
+                    else
+                        this->assign(this->exponent_ + other.exponent_,
+                                 uint64_t{this->numerator_} * other.numerator_,
+                                 uint64_t{this->denominator_} * other.denominator_);
 
-                    return *this; 
+                    return *this;
 
                 }
 
 
                 /**
-                 * @brief Divide this unit_prefix to an unit_prefix by dividing the multipliers together
-                 * 
+                 * @brief Divide this unit_prefix to an unit_prefix by subtracting the exponents
+                 *
                  * @param other: unit_prefix object to divide with as l-value const reference
-                 * 
+                 *
                  * @return constexpr unit_prefix&
                  */
                 constexpr unit_prefix& operator/=(const unit_prefix& other) noexcept {
 
-                    this->multiplier_ /= other.multiplier_; 
+                    if (!this->exact_ || !other.exact_)
+                        this->assign(this->multiplier() / other.multiplier());
+                    else
+                        this->assign(this->exponent_ - other.exponent_,
+                                 uint64_t{this->numerator_} * other.denominator_,
+                                 uint64_t{this->denominator_} * other.numerator_);
 
-                    return *this; 
+                    return *this;
 
                 }
 
 
                 /**
-                 * @brief Perform a multiplication between unit_prefixes 
-                 * 
+                 * @brief Perform a multiplication between unit_prefixes
+                 *
                  * @param other: unit_prefix object to multiply with as l-value const reference
-                 * 
-                 * @return constexpr unit_prefix 
+                 *
+                 * @return constexpr unit_prefix
                  */
                 constexpr unit_prefix operator*(const unit_prefix& other) const noexcept {
 
-                    return unit_prefix(this->multiplier_ * other.multiplier_, this->symbol_); 
+                    unit_prefix result(*this);
+
+                    return result *= other;
 
                 }
 
 
                 /**
-                 * @brief Perform a division between unit_prefixes 
-                 * 
-                 * @param other: unit_prefix object to muldividetiply with as l-value const reference
-                 * 
-                 * @return constexpr unit_prefix 
+                 * @brief Perform a division between unit_prefixes
+                 *
+                 * @param other: unit_prefix object to divide with as l-value const reference
+                 *
+                 * @return constexpr unit_prefix
                  */
                 constexpr unit_prefix operator/(const unit_prefix& other) const noexcept {
 
-                    return unit_prefix(this->multiplier_ / other.multiplier_, this->symbol_); 
+                    unit_prefix result(*this);
+
+                    return result /= other;
 
                 }
 
 
                 /**
                  * @brief Equality operator
-                 * 
+                 *
                  * @param other: unit_prefix object to compare with as l-value const reference
-                 * 
+                 *
                  * @return bool
                  */
                 constexpr bool operator==(const unit_prefix& other) const noexcept {
-                
-                    return (this->multiplier_ == other.multiplier_ && this->symbol_ == other.symbol_);   
+
+                    return this->exact_ == other.exact_ &&
+                           this->exponent_ == other.exponent_ &&
+                           this->numerator_ == other.numerator_ &&
+                           this->denominator_ == other.denominator_ &&
+                           this->symbol_ == other.symbol_;
 
                 }
 
 
                 /**
                  * @brief Inequality operator
-                 * 
+                 *
                  * @param other: unit_prefix object to !compare with as l-value const reference
-                 * 
+                 *
                  * @return bool
-                 * 
-                 */                    
-                constexpr bool operator!=(const unit_prefix& other) const noexcept { 
-                    
-                    return (this->multiplier_ != other.multiplier_ || this->symbol_ != other.symbol_);   
-                    
+                 *
+                 */
+                constexpr bool operator!=(const unit_prefix& other) const noexcept {
+
+                    return !(*this == other);
+
                 }
 
 
                 /**
                  * @brief Printing on video the unit_prefix litterals
-                 * 
-                 * @param os: std::ostream& 
+                 *
+                 * @param os: std::ostream&
                  * @param prefix: unit_prefix as l-value const reference
                  */
                 friend std::ostream& operator<<(std::ostream& os, const unit_prefix& prefix) noexcept {
 
-                    os << prefix.symbol_; 
+                    os << prefix.symbol_;
 
-                    return os; 
+                    return os;
 
                 }
 
 
                 /**
                  * @brief Printing on file the unit_prefix litterals
-                 * 
-                 * @param file: std::ofstream& 
+                 *
+                 * @param file: std::ofstream&
                  * @param prefix: unit_prefix as l-value const reference
                  */
                 friend std::ofstream& operator<<(std::ofstream& file, const unit_prefix& prefix) noexcept {
 
-                    file << prefix.symbol_; 
+                    file << prefix.symbol_;
 
-                    return file; 
+                    return file;
 
                 }
 
 
             // =============================================
             // operations
-            // ============================================= 
+            // =============================================
 
                 /**
                  * @brief Invert the unit_prefix
-                 * 
-                 * @return constexpr unit_prefix 
+                 *
+                 * @return constexpr unit_prefix
                  */
-                constexpr unit_prefix inv() const noexcept { 
-                    
-                    return unit_prefix(1. / this->multiplier_, this->symbol_); 
-                    
+                constexpr unit_prefix inv() const noexcept {
+
+                    unit_prefix result(*this);
+                    if (this->exact_)
+                        result.assign(-this->exponent_, this->denominator_, this->numerator_);
+                    else
+                        result.assign(1. / this->multiplier());
+
+                    return result;
+
                 }
 
 
                 /**
                  * @brief Take the power of the unit_prefix
-                 * 
-                 * @param power 
-                 * 
-                 * @return unit_prefix 
-                 */
-                inline unit_prefix pow(const int& power) const noexcept { 
-                    
-                    return unit_prefix(std::pow(this->multiplier_, power), this->symbol_); 
-                    
+                 *
+                 * @param power
+                 *
+                 * @return constexpr unit_prefix
+                 */
+                constexpr unit_prefix pow(const int& power) const noexcept {
+
+                    const unit_prefix base((power < 0) ? this->inv() : *this);
+                    unit_prefix result;
+                    result.symbol_ = this->symbol_;
+                    for (int i{(power < 0) ? -power : power}; i > 0; --i)
+                        result *= base;
+
+                    return result;
+
                 }
 
 
                 /**
                  * @brief Take the square of the unit_prefix
-                 * 
-                 * @return constexpr unit_prefix 
+                 *
+                 * @return constexpr unit_prefix
                  */
-                constexpr unit_prefix square() const noexcept { 
-                    
-                    return unit_prefix(std::pow(this->multiplier_, 2), this->symbol_); 
-                    
+                constexpr unit_prefix square() const noexcept {
+
+                    return *this * *this;
+
                 }
 
 
                 /**
                  * @brief Take the cube of the unit_prefix
-                 * 
-                 * @return constexpr unit_prefix 
+                 *
+                 * @return constexpr unit_prefix
                  */
-                constexpr unit_prefix cube() const noexcept { 
-                    
-                    return unit_prefix(std::pow(this->multiplier_, 3), this->symbol_); 
-                    
+                constexpr unit_prefix cube() const noexcept {
+
+                    return *this * *this * *this;
+
                 }
 
 
                 /**
                  * @brief Take the root of the unit_prefix
-                 * 
-                 * @param power 
-                 * 
-                 * @return constexpr unit_prefix 
-                 */
-                constexpr unit_prefix root(const int& power) const noexcept { 
-                    
-                    return unit_prefix(std::pow(this->multiplier_, power), this->symbol_); 
-                    
+                 *
+                 * @param power
+                 *
+                 * @return constexpr unit_prefix
+                 *
+                 * @note The root is exact if the exponent is divisible by power and the scale is a perfect power,
+                 *       otherwise it is taken in floating point
+                 */
+                constexpr unit_prefix root(const int& power) const {
+
+                    if (power == 0)
+                        throw std::invalid_argument("Invalid root power");
+
+                    if (power < 0)
+                        return this->inv().root(-power);
+
+                    unit_prefix result(*this);
+                    if (this->exact_ && this->exponent_ % power == 0) {
+
+                        const uint64_t numerator = unit_prefix::integer_root(this->numerator_, power);
+                        const uint64_t denominator = unit_prefix::integer_root(this->denominator_, power);
+                        if (numerator != 0 && denominator != 0) {
+
+                            result.assign(this->exponent_ / power, numerator, denominator);
+                            return result;
+
+                        }
+
+                    }
+
+                    result.assign(std::pow(this->multiplier(), 1. / power));
+
+                    return result;
+
                 }
 
 
                 /**
                  * @brief Take the square root of the unit_prefix
-                 * 
-                 * @return unit_prefix 
+                 *
+                 * @return constexpr unit_prefix
                  */
-                inline unit_prefix sqrt() const noexcept { 
-                    
-                    return unit_prefix(std::pow(this->multiplier_, 1. / 2.), this->symbol_); 
-                    
+                constexpr unit_prefix sqrt() const {
+
+                    return this->root(2);
+
                 }
 
 
                 /**
                  * @brief Take the cube root of the unit_prefix
-                 * 
-                 * @return unit_prefix 
+                 *
+                 * @return constexpr unit_prefix
                  */
-                inline unit_prefix cbrt() const noexcept { 
-                    
-                    return unit_prefix(std::pow(this->multiplier_, 1. / 3.), this->symbol_); 
-                    
+                constexpr unit_prefix cbrt() const {
+
+                    return this->root(3);
+
                 }
 
 
             // =============================================
             // get methods
-            // ============================================= 
+            // =============================================
 
                 /**
                  * @brief Get the multiplier of the unit_prefix
-                 * 
-                 * @return constexpr scalar 
+                 *
+                 * @return constexpr scalar
+                 *
+                 * @note The multiplier of a decimal unit_prefix is exact
                  */
-                constexpr const scalar& multiplier() const noexcept {
+                constexpr scalar multiplier() const noexcept {
+
+                    if (!this->exact_)
+                        return std::bit_cast<scalar>((uint64_t{this->numerator_} << 32) | this->denominator_);
+
+                    if (this->numerator_ == this->denominator_)
+                        return unit_prefix::power_of_ten(this->exponent_);
 
-                    return this->multiplier_; 
+                    return unit_prefix::power_of_ten(this->exponent_) * this->numerator_ / this->denominator_;
 
                 }
 
 
                 /**
-                 * @brief Get the multiplier of the unit_prefix
-                 * 
-                 * @return constexpr scalar& 
+                 * @brief Get the factor converting a value expressed with this unit_prefix to another unit_prefix
+                 *
+                 * @param other: unit_prefix as l-value const reference
+                 *
+                 * @return constexpr scalar
+                 */
+                constexpr scalar factor(const unit_prefix& other) const noexcept {
+
+                    return (*this / other).multiplier();
+
+                }
+
+
+                /**
+                 * @brief Check if the multiplier of the unit_prefix is an exact rational times a power of ten
+                 *
+                 * @return constexpr bool
+                 */
+                constexpr bool exact() const noexcept {
+
+                    return this->exact_;
+
+                }
+
+
+                /**
+                 * @brief Get the decimal exponent of the unit_prefix
+                 *
+                 * @return constexpr int
+                 *
+                 * @note The exponent, the numerator and the denominator of an unit_prefix that is not exact are 0, 1 and 1
+                 */
+                constexpr int exponent() const noexcept {
+
+                    return this->exponent_;
+
+                }
+
+
+                /**
+                 * @brief Get the numerator of the scale of the unit_prefix
+                 *
+                 * @return constexpr uint32_t
                  */
-                constexpr scalar& multiplier() noexcept {
+                constexpr uint32_t numerator() const noexcept {
 
-                    return this->multiplier_; 
+                    return this->exact_ ? this->numerator_ : 1;
+
+                }
+
+
+                /**
+                 * @brief Get the denominator of the scale of the unit_prefix
+                 *
+                 * @return constexpr uint32_t
+                 */
+                constexpr uint32_t denominator() const noexcept {
+
+                    return this->exact_ ? this->denominator_ : 1;
 
                 }
 
 
                 /**
                  * @brief Get the symbol of the unit_prefix
-                 * 
+                 *
                  * @return constexpr char
                  */
                 constexpr char symbol() const noexcept {
 
-                    return this->symbol_; 
+                    return this->symbol_;
 
                 }
 
 
                 /**
                  * @brief Get the symbol of the unit_prefix
-                 * 
+                 *
                  * @return constexpr char&
                  */
                 constexpr char& symbol() noexcept {
 
-                    return this->symbol_; 
+                    return this->symbol_;
+
+                }
+
+
+                /**
+                 * @brief Get 10^exponent from the exact lookup table
+                 *
+                 * @param exponent: int as l-value const reference
+                 *
+                 * @return constexpr scalar
+                 *
+                 * @note Outside of [-max_exponent, max_exponent] the result is not exact
+                 */
+                static constexpr scalar power_of_ten(const int& exponent) noexcept {
+
+                    if (exponent > max_exponent)
+                        return powers_of_ten[2 * max_exponent] * unit_prefix::power_of_ten(exponent - max_exponent);
+
+                    else if (exponent < -max_exponent)
+                        return powers_of_ten[0] * unit_prefix::power_of_ten(exponent + max_exponent);
+
+                    return powers_of_ten[exponent + max_exponent];
+
+                }
+
+
+            // =============================================
+            // normalization helpers
+            // =============================================
+
+                /**
+                 * @brief Set the exponent and the scale, reducing the fraction and moving its powers of ten into the exponent
+                 *
+                 * @note A scale that does not fit in 32 bits or an exponent that does not fit in 16 bits is not rounded:
+                 *       the multiplier is kept as a double and the unit_prefix is no more exact
+                 */
+                constexpr void assign(int exponent, uint64_t numerator, uint64_t denominator) noexcept {
+
+                    const uint64_t divisor = std::gcd(numerator, denominator);
+                    numerator /= divisor;
+                    denominator /= divisor;
+
+                    while (numerator % 10 == 0) { numerator /= 10; ++exponent; }
+                    while (denominator % 10 == 0) { denominator /= 10; --exponent; }
+
+                    if (numerator > UINT32_MAX || denominator > UINT32_MAX || exponent > INT16_MAX || exponent < INT16_MIN) {
+
+                        this->assign(unit_prefix::power_of_ten(exponent) * (static_cast<scalar>(numerator) / static_cast<scalar>(denominator)));
+                        return;
+
+                    }
+
+                    this->exact_ = true;
+                    this->exponent_ = static_cast<int16_t>(exponent);
+                    this->numerator_ = static_cast<uint32_t>(numerator);
+                    this->denominator_ = static_cast<uint32_t>(denominator);
+
+                }
+
+
+                /**
+                 * @brief Set the multiplier, exactly if it is a 32 bit integer times a power of ten or the inverse of a 32 bit integer
+                 *
+                 * @note Otherwise the bits of the double are kept in the numerator and the denominator and the unit_prefix is not exact
+                 */
+                constexpr void assign(const scalar& mult) noexcept {
+
+                    for (int exponent{max_exponent}; exponent >= -max_exponent; --exponent) {
+
+                        const scalar scale = mult / unit_prefix::power_of_ten(exponent);
+                        if (scale > UINT32_MAX)
+                            break;
+
+                        const uint64_t numerator = static_cast<uint64_t>(scale + 0.5);
+                        if (numerator != 0 && unit_prefix::power_of_ten(exponent) * numerator == mult) {
+
+                            this->assign(exponent, numerator, 1);
+                            return;
+
+                        }
+
+                    }
+
+                    const scalar inverse = 1. / mult;
+                    const uint64_t denominator = (inverse <= UINT32_MAX) ? static_cast<uint64_t>(inverse + 0.5) : 0;
+                    if (denominator != 0 && 1. / denominator == mult) {
+
+                        this->assign(0, 1, denominator);
+                        return;
+
+                    }
+
+                    const uint64_t bits = std::bit_cast<uint64_t>(mult);
+                    this->exact_ = false;
+                    this->exponent_ = 0;
+                    this->numerator_ = static_cast<uint32_t>(bits >> 32);
+                    this->denominator_ = static_cast<uint32_t>(bits);
+
+                }
+
+
+                /**
+                 * @brief Get the integer root of a value
+                 *
+                 * @return constexpr uint64_t: the root or 0 if the value is not a perfect power
+                 */
+                static constexpr uint64_t integer_root(const uint64_t& value, const int& power) noexcept {
+
+                    uint64_t low{1}, high{value};
+                    while (low <= high) {
+
+                        const uint64_t middle = low + (high - low) / 2;
+                        uint64_t product{1};
+                        for (int i{0}; i < power && product <= value; ++i)
+                            product = (product > value / middle) ? value + 1 : product * middle;
+
+                        if (product == value)
+                            return middle;
+                        else if (product < value)
+                            low = middle + 1;
+                        else
+                            high = middle - 1;
+
+                    }
+
+                    return 0;
 
                 }
 
@@ -385,10 +636,42 @@ namespace measurements {
             // struct members & friends
             // =============================================
 
-                scalar multiplier_{1.0}; ///< multiplier of the unit_prefix
+                static constexpr int max_exponent{72}; ///< Largest exponent of the lookup table
+
+                static constexpr scalar powers_of_ten[2 * max_exponent + 1] = {
+                    1e-72, 1e-71, 1e-70, 1e-69, 1e-68, 1e-67, 1e-66,
+                    1e-65, 1e-64, 1e-63, 1e-62, 1e-61, 1e-60, 1e-59,
+                    1e-58, 1e-57, 1e-56, 1e-55, 1e-54, 1e-53, 1e-52,
+                    1e-51, 1e-50, 1e-49, 1e-48, 1e-47, 1e-46, 1e-45,
+                    1e-44, 1e-43, 1e-42, 1e-41, 1e-40, 1e-39, 1e-38,
+                    1e-37, 1e-36, 1e-35, 1e-34, 1e-33, 1e-32, 1e-31,
+                    1e-30, 1e-29, 1e-28, 1e-27, 1e-26, 1e-25, 1e-24,
+                    1e-23, 1e-22, 1e-21, 1e-20, 1e-19, 1e-18, 1e-17,
+                    1e-16, 1e-15, 1e-14, 1e-13, 1e-12, 1e-11, 1e-10,
+                    1e-9, 1e-8, 1e-7, 1e-6, 1e-5, 1e-4, 1e-3,
+                    1e-2, 1e-1, 1e0, 1e1, 1e2, 1e3, 1e4,
+                    1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18,
+                    1e19, 1e20, 1e21, 1e22, 1e23, 1e24, 1e25,
+                    1e26, 1e27, 1e28, 1e29, 1e30, 1e31, 1e32,
+                    1e33, 1e34, 1e35, 1e36, 1e37, 1e38, 1e39,
+                    1e40, 1e41, 1e42, 1e43, 1e44, 1e45, 1e46,
+                    1e47, 1e48, 1e49, 1e50, 1e51, 1e52, 1e53,
+                    1e54, 1e55, 1e56, 1e57, 1e58, 1e59, 1e60,
+                    1e61, 1e62, 1e63, 1e64, 1e65, 1e66, 1e67,
+                    1e68, 1e69, 1e70, 1e71, 1e72 }; ///< Correctly rounded powers of ten
+
+
+                int16_t exponent_{0}; ///< decimal exponent of the unit_prefix
 
                 char symbol_{'\0'}; ///< symbol of the unit_prefix
 
+                bool exact_{true}; ///< false if the multiplier is kept as a double in numerator_ and denominator_
+
+                uint32_t numerator_{1}; ///< numerator of the scale of the unit_prefix, or high bits of the multiplier
+
+                uint32_t denominator_{1}; ///< denominator of the scale of the unit_prefix, or low bits of the multiplier
+
 
                 friend struct unit; ///< unit is a friend of unit_prefix
 
@@ -397,6 +680,6 @@ namespace measurements {
 
 
     } // namespace units
-    
-    
-} // namespace measurements
\ No newline at end of file
+
+
+} // namespace measurements
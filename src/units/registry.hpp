@@ -0,0 +1,188 @@
+/**
+ * @file    registry.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the unit_registry, which interns the units and hands out compact 16 bit ids
+ * @date    2023-02-01
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+namespace measurements {
+
+
+    namespace units {
+
+
+        /**
+         * @brief Global append-only table of units, each one identified by a 16 bit id
+         *
+         * @note Interning takes a lock, while reading a unit from its id does not: the units are stored in pages
+         *       that are never moved or freed, so an id stays valid for the lifetime of the registry
+         * @note The id 0 is always the unitless unit
+         */
+        class unit_registry {
+
+
+            public:
+
+            // =============================================
+            // types & constants
+            // =============================================
+
+                using id_type = uint16_t; ///< Type of the ids of the units
+
+                static constexpr std::size_t page_size{256}; ///< Number of units of a page
+
+                static constexpr std::size_t capacity{std::size_t{std::numeric_limits<id_type>::max()} + 1}; ///< Maximum number of units
+
+
+            // =============================================
+            // constructors & destructor
+            // =============================================
+
+                /// @brief Construct a new unit_registry, with the unitless unit as id 0
+                unit_registry() {
+
+                    this->intern(unit());
+
+                }
+
+
+                unit_registry(const unit_registry&) = delete;
+
+                unit_registry& operator=(const unit_registry&) = delete;
+
+
+                /// @brief Default destructor
+                ~unit_registry() = default;
+
+
+                /// @brief Get the registry shared by the whole program
+                static unit_registry& global() {
+
+                    static unit_registry registry;
+
+                    return registry;
+
+                }
+
+
+            // =============================================
+            // methods
+            // =============================================
+
+                /**
+                 * @brief Get the id of a unit, registering it if it is new
+                 *
+                 * @param units: unit as l-value const reference
+                 *
+                 * @return id_type
+                 *
+                 * @note It throws if the registry is full
+                 */
+                id_type intern(const unit& units) {
+
+                    const std::lock_guard<std::mutex> lock(this->mutex_);
+
+                    const auto found = this->ids_.find(units);
+                    if (found != this->ids_.end())
+                        return found->second;
+
+                    const std::size_t id = this->size_.load(std::memory_order_relaxed);
+                    if (id == capacity)
+                        throw_runtime_error("Cannot intern a unit in a full unit_registry");
+
+                    if (id % page_size == 0) {
+
+                        this->storage_[id / page_size] = std::make_unique<unit[]>(page_size);
+                        this->pages_[id / page_size].store(this->storage_[id / page_size].get(), std::memory_order_release);
+
+                    }
+
+                    this->storage_[id / page_size][id % page_size] = units;
+                    this->ids_.emplace(units, static_cast<id_type>(id));
+                    this->size_.store(id + 1, std::memory_order_release);
+
+                    return static_cast<id_type>(id);
+
+                }
+
+
+                /**
+                 * @brief Get the unit of an id, without locking
+                 *
+                 * @param id: id returned by intern
+                 *
+                 * @return const unit&
+                 */
+                const unit& operator[](const id_type& id) const noexcept {
+
+                    return this->pages_[id / page_size].load(std::memory_order_acquire)[id % page_size];
+
+                }
+
+
+                /**
+                 * @brief Get the unit of an id, checking that it was registered
+                 *
+                 * @param id: id as l-value const reference
+                 *
+                 * @return const unit&
+                 */
+                const unit& at(const id_type& id) const {
+
+                    if (id >= this->size())
+                        throw_invalid_argument("Cannot find an unregistered unit id");
+
+                    return (*this)[id];
+
+                }
+
+
+                /**
+                 * @brief Get the factor converting the unit of an id to the unit of another id
+                 *
+                 * @param from: id of the unit to convert from
+                 * @param to: id of the unit to convert to
+                 *
+                 * @return scalar, NaN if the units have different unit_base
+                 */
+                scalar convertion_factor(const id_type& from, const id_type& to) const noexcept {
+
+                    return (from == to) ? 1.0 : (*this)[from].convertion_factor((*this)[to]);
+
+                }
+
+
+                /// @brief Get the number of registered units
+                std::size_t size() const noexcept { return this->size_.load(std::memory_order_acquire); }
+
+
+            private:
+
+            // =============================================
+            // class members
+            // =============================================
+
+                std::array<std::atomic<const unit*>, capacity / page_size> pages_{}; ///< Pages read without locking
+
+                std::array<std::unique_ptr<unit[]>, capacity / page_size> storage_{}; ///< Pages owned by the registry
+
+                std::atomic<std::size_t> size_{0}; ///< Number of registered units
+
+                std::unordered_map<unit, id_type, unit_hash> ids_{}; ///< Ids of the registered units
+
+                std::mutex mutex_{}; ///< Lock of intern
+
+
+        }; // class unit_registry
+
+
+    } // namespace units
+
+
+} // namespace measurements
@@ -158,45 +158,45 @@ namespace measurements {
             namespace prefixes {
 
 
-                constexpr unit_prefix default_type(1, '\0');
+                constexpr unit_prefix default_type('\0', 0);
 
-                constexpr unit_prefix yocto(1e-24, 'y');
+                constexpr unit_prefix yocto('y', -24);
                 
-                constexpr unit_prefix zepto(1e-21, 'z');
+                constexpr unit_prefix zepto('z', -21);
                 
-                constexpr unit_prefix atto(1e-18, 'a');
+                constexpr unit_prefix atto('a', -18);
                 
-                constexpr unit_prefix femto(1e-15, 'f');
+                constexpr unit_prefix femto('f', -15);
                 
-                constexpr unit_prefix pico(1e-12, 'p');
+                constexpr unit_prefix pico('p', -12);
                 
-                constexpr unit_prefix nano(1e-9, 'n');
+                constexpr unit_prefix nano('n', -9);
                 
-                constexpr unit_prefix micro(1e-6, 'u');
+                constexpr unit_prefix micro('u', -6);
                 
-                constexpr unit_prefix milli(1e-3, 'm');
+                constexpr unit_prefix milli('m', -3);
                 
-                constexpr unit_prefix centi(1e-2, 'c');
+                constexpr unit_prefix centi('c', -2);
                 
-                constexpr unit_prefix deci(1e-1, 'd');
+                constexpr unit_prefix deci('d', -1);
                                 
-                constexpr unit_prefix hecto(1e2, 'h');
+                constexpr unit_prefix hecto('h', 2);
                 
-                constexpr unit_prefix kilo(1e3, 'k');
+                constexpr unit_prefix kilo('k', 3);
                 
-                constexpr unit_prefix mega(1e6, 'M');
+                constexpr unit_prefix mega('M', 6);
                 
-                constexpr unit_prefix giga(1e9, 'G');
+                constexpr unit_prefix giga('G', 9);
                 
-                constexpr unit_prefix tera(1e12, 'T');
+                constexpr unit_prefix tera('T', 12);
                 
-                constexpr unit_prefix peta(1e15, 'P');
+                constexpr unit_prefix peta('P', 15);
                 
-                constexpr unit_prefix exa(1e18, 'E');
+                constexpr unit_prefix exa('E', 18);
                 
-                constexpr unit_prefix zetta(1e21, 'Z');
+                constexpr unit_prefix zetta('Z', 21);
                 
-                constexpr unit_prefix yotta(1e24, 'Y');
+                constexpr unit_prefix yotta('Y', 24);
 
 
             } // namespace prefix
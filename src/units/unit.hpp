@@ -95,10 +95,21 @@ namespace measurements {
                 explicit constexpr unit(const unit_prefix& prefix, 
                                         const unit& unit) noexcept : 
                     
-                    base_(unit.base_), 
+                    base_(unit.base_),
                     prefix_(prefix * unit.prefix_) {}
 
 
+                /**
+                 * @brief Construct a new unit object from a string
+                 *
+                 * @param unit_string: string represents the unit, as "km*s^-1" or "kN/m^2"
+                 *
+                 * @note It throws if the string is not a valid unit
+                 * @see parse_unit
+                 */
+                explicit constexpr unit(std::string_view unit_string);
+
+
                 /**
                  * @brief Copy construct a new unit from another unit object
                  * 
@@ -287,7 +298,7 @@ namespace measurements {
                 constexpr bool operator!=(const unit& other) const noexcept { 
 
                     if (this->base_ == other.base_) 
-                        return this->prefix_ == other.prefix_;
+                        return this->prefix_ != other.prefix_;
 
                     else 
                         return true;
@@ -306,7 +317,8 @@ namespace measurements {
                  */
                 friend std::ostream& operator<<(std::ostream& os, const unit& units) noexcept {
 
-                    os << units.to_string(); 
+                    char buffer[unit::max_chars];
+                    os.write(buffer, to_chars(buffer, buffer + unit::max_chars, units).ptr - buffer);
 
                     return os; 
 
@@ -324,7 +336,8 @@ namespace measurements {
                  */
                 friend std::ofstream& operator<<(std::ofstream& file, const unit& units) noexcept {
 
-                    file << units.to_string();
+                    char buffer[unit::max_chars];
+                    file.write(buffer, to_chars(buffer, buffer + unit::max_chars, units).ptr - buffer);
 
                     return file; 
 
@@ -352,9 +365,9 @@ namespace measurements {
                  * 
                  * @param power
                  * 
-                 * @return unit 
+                 * @return constexpr unit 
                  */
-                inline unit pow(const int& power) const noexcept { 
+                constexpr unit pow(const int& power) const noexcept { 
                     
                     return { this->prefix_.pow(power), this->base_.pow(power) }; 
                     
@@ -402,9 +415,9 @@ namespace measurements {
                 /**
                  * @brief Take the square root of the unit
                  * 
-                 * @return unit 
+                 * @return constexpr unit 
                  */
-                inline unit sqrt() const { 
+                constexpr unit sqrt() const { 
                     
                     return { this->prefix_.sqrt(), this->base_.sqrt() }; 
                     
@@ -414,9 +427,9 @@ namespace measurements {
                 /**
                  * @brief Take the cube root of the unit
                  * 
-                 * @return unit 
+                 * @return constexpr unit 
                  */
-                inline unit cbrt() const { 
+                constexpr unit cbrt() const { 
                     
                     return { this->prefix_.cbrt(), this->base_.cbrt() }; 
                     
@@ -509,7 +522,7 @@ namespace measurements {
                 */
                 constexpr scalar convertion_factor(const unit& other) const noexcept { 
                     
-                    return (this->base_ == other.base_) ? this->prefix_.multiplier_ / other.prefix_.multiplier_ : std::numeric_limits<scalar>::signaling_NaN();                     
+                    return (this->base_ == other.base_) ? this->prefix_.factor(other.prefix_) : std::numeric_limits<scalar>::signaling_NaN();
                 }
 
 
@@ -529,6 +542,24 @@ namespace measurements {
                 }
 
 
+                /**
+                 * @brief Write the unit in a buffer, without allocating
+                 * 
+                 * @param first: begin of the buffer
+                 * @param last: end of the buffer
+                 * @param units: unit as l-value const reference
+                 * 
+                 * @return std::to_chars_result
+                 * 
+                 * @note The string is read back by parse_unit to the same multiplier: the prefix symbol is written in front of
+                 *       a factor only if the prefix raised to the power of that factor is the prefix of the unit,
+                 *       as "km^2" or "ms^-1", otherwise the scale is written as a leading number, as "1e3*s^-1"
+                 * @note On std::errc::value_too_large the content of the buffer is unspecified, unit::max_chars is always enough
+                 * @note It is defined in parser.hpp, next to the prefix symbols known by the parser
+                 */
+                friend inline std::to_chars_result to_chars(char* first, char* last, const unit& units) noexcept;
+
+
                 /**
                  * @brief Get the unit string
                  * 
@@ -536,7 +567,9 @@ namespace measurements {
                  */
                 inline std::string to_string() const noexcept {
 
-                    return (this->prefix_.symbol_ == '\0') ? this->base_.to_string() : this->prefix_.symbol_ + this->base_.to_string(); 
+                    char buffer[unit::max_chars];
+
+                    return std::string(buffer, to_chars(buffer, buffer + unit::max_chars, *this).ptr);
 
                 }
 
@@ -557,6 +590,8 @@ namespace measurements {
 
                 unit_prefix prefix_; ///< unit prefix
 
+                static constexpr std::size_t max_chars{unit_base::max_chars + 32}; ///< Size of a buffer always large enough for to_chars
+
 
                 friend class measurement; ///< measurement class is a friend of unit
 
@@ -566,6 +601,29 @@ namespace measurements {
         }; // struct unit     
 
 
+        /// @brief Hash of a unit, consistent with its equality operator
+        struct unit_hash {
+
+            constexpr std::size_t operator()(const unit& units) const noexcept {
+
+                uint64_t hash = units.base().overflow() ? 1 : 0;
+                for (uint32_t lane{0}; lane < bitwidth::lanes; ++lane)
+                    hash = hash * 31 + static_cast<uint64_t>(units.base().exponent(lane));
+
+                hash = hash * 31 + static_cast<uint64_t>(units.prefix().exponent());
+                hash = hash * 31 + units.prefix().numerator();
+                hash = hash * 31 + units.prefix().denominator();
+                if (!units.prefix().exact())
+                    hash = hash * 31 + std::bit_cast<uint64_t>(units.prefix().multiplier());
+                hash = hash * 31 + static_cast<unsigned char>(units.prefix().symbol());
+
+                return static_cast<std::size_t>(hash ^ (hash >> 32));
+
+            }
+
+        };
+
+
     } // namespace units
     
     
@@ -0,0 +1,131 @@
+/**
+ * @file    binary.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the tests of the binary file format: the round trip through binary_writer,
+ *          binary_reader and mapped_reader, and the rejection of corrupted files
+ * @date    2023-02-06
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include "measurements.hpp"
+#include "check.hpp"
+
+#include <filesystem>
+
+
+using namespace measurements;
+
+
+namespace {
+
+
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "measurements_binary.bin";
+
+
+    /// @brief Units of the records, with an inexact unit_prefix and an overflowed unit_base
+    std::vector<unit> record_units() {
+
+        return {
+            m, km / s, unit(units::unit_prefix(0.3048, 'f'), m.base()),
+            unit(units::SI::prefixes::kilo, unit_base(bitwidth::max_exponent + 1, 0, 0, 0, 0, 0, 0))
+        };
+
+    }
+
+
+    /// @brief Write three records for each unit, in segments of two records
+    void write_file() {
+
+        binary_writer writer(path.string(), true, 2);
+        for (const unit& units : record_units())
+            for (int i{0}; i < 3; ++i)
+                writer.write(umeasurement(1.5 + i, 0.25, units));
+
+    }
+
+
+    void round_trip() {
+
+        write_file();
+        const std::vector<unit> units = record_units();
+
+        binary_reader reader(path.string());
+        CHECK(reader.size() == 3 * units.size());
+        CHECK(reader.units().size() == units.size());
+        for (std::size_t i{0}; i < std::min(reader.units().size(), units.size()); ++i) {
+
+            CHECK(reader.units()[i].base().overflow() == units[i].base().overflow());
+            CHECK(reader.units()[i].prefix().exact() == units[i].prefix().exact());
+            CHECK(reader.units()[i].prefix().multiplier() == units[i].prefix().multiplier());
+
+        }
+
+        umeasurement umeas;
+        for (std::size_t i{0}; i < 3 * units.size(); ++i) {
+
+            CHECK(reader.read(umeas));
+            CHECK(umeas.value() == 1.5 + static_cast<scalar>(i % 3));
+            CHECK(umeas.uncertainty() == 0.25);
+            CHECK(umeas.units() == units[i / 3]);
+
+        }
+        CHECK(!reader.read(umeas));
+
+        const mapped_reader mapped(path.string());
+        CHECK(mapped.size() == 3 * units.size());
+        CHECK(mapped.segments() == 2 * units.size());
+        CHECK(mapped.values(0).size() == 2 && mapped.values(1).size() == 1);
+        CHECK(mapped.uncertainties(1)[0] == 0.25);
+        CHECK(mapped.units(2).prefix().multiplier() == units[1].prefix().multiplier());
+
+    }
+
+
+    /// @brief Overwrite bytes of the file
+    void patch(const std::size_t& offset, const void* bytes, const std::size_t& size) {
+
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(offset));
+        file.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(size));
+
+    }
+
+
+    void corrupted() {
+
+        // a segment count larger than the rest of the file is rejected before the column is allocated
+        write_file();
+        const unsigned char count[8] = { 0, 0, 0, 0, 0, 0, 0, 0x10 };
+        patch(binary::header_size, count, sizeof(count));
+        CHECK_THROWS(std::runtime_error, [] { binary_reader reader(path.string()); measurement meas; return reader.read(meas); }());
+        CHECK_THROWS(std::runtime_error, mapped_reader(path.string()));
+
+        // a segment count larger than the number of segment headers that fit in the file
+        write_file();
+        patch(24, count, sizeof(count));
+        CHECK_THROWS(std::runtime_error, mapped_reader(path.string()));
+
+        // unknown unit flags
+        write_file();
+        const unsigned char flags{0x80};
+        patch(binary::preamble_size + 10, &flags, 1);
+        CHECK_THROWS(std::runtime_error, binary_reader(path.string()));
+
+        std::filesystem::remove(path);
+
+    }
+
+
+} // namespace
+
+
+int main() {
+
+    round_trip();
+    corrupted();
+
+    return test::failures;
+
+}
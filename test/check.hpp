@@ -0,0 +1,47 @@
+/**
+ * @file    check.hpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the minimal checks used by the tests: each test is an executable
+ *          that returns the number of failed checks, registered in ctest
+ * @date    2023-02-06
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#pragma once
+
+
+#include <iostream>
+
+
+namespace test {
+
+
+    /// @brief Number of failed checks of the test
+    inline int failures{0};
+
+
+    /// @brief Report a failed check
+    inline void fail(const char* expression, const char* file, const int& line) {
+
+        std::cerr << file << ':' << line << ": check failed: " << expression << '\n';
+        ++failures;
+
+    }
+
+
+} // namespace test
+
+
+/// @brief Check a condition, reporting it without stopping the test if it is false
+#define CHECK(...) ((__VA_ARGS__) ? void() : test::fail(#__VA_ARGS__, __FILE__, __LINE__))
+
+
+/// @brief Check that an expression throws an exception of a type
+#define CHECK_THROWS(exception, ...) \
+    do { \
+        bool thrown_{false}; \
+        try { (void)(__VA_ARGS__); } catch (const exception&) { thrown_ = true; } catch (...) {} \
+        if (!thrown_) test::fail("throws " #exception ": " #__VA_ARGS__, __FILE__, __LINE__); \
+    } while (false)
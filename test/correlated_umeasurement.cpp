@@ -0,0 +1,103 @@
+/**
+ * @file    correlated_umeasurement.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the tests of the correlated_umeasurement: the merge of the uncertainty_components
+ *          beyond their inline capacity, the cancellation of a shared source and the correlation coefficient
+ * @date    2023-02-06
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include "measurements.hpp"
+#include "check.hpp"
+
+
+using namespace measurements;
+
+
+namespace {
+
+
+    bool close(const scalar& lhs, const scalar& rhs) { return std::fabs(lhs - rhs) <= 1e-12 * std::max(1.0, std::fabs(rhs)); }
+
+
+    void spill() {
+
+        // the sum of more independent sources than inline_capacity moves its components to the heap, sorted by source
+        const std::size_t sources{uncertainty_components::inline_capacity + 3};
+        correlated_umeasurement sum(umeasurement(1.0, 0.5, m), sources - 1);
+        for (std::size_t i{sources - 1}; i-- > 0; )
+            sum = sum + correlated_umeasurement(umeasurement(1.0, 0.5, m), i);
+
+        CHECK(sum.value() == static_cast<scalar>(sources));
+        CHECK(sum.components().size() == sources);
+        CHECK(!sum.components().is_inline());
+        CHECK(close(sum.uncertainty(), 0.5 * std::sqrt(static_cast<scalar>(sources))));
+        for (std::size_t i{0}; i < sum.components().size(); ++i)
+            CHECK(sum.components().entries()[i].source == i);
+
+        // the merge of two spilled sets of components with shared sources
+        const correlated_umeasurement twice = sum + sum;
+        CHECK(twice.components().size() == sources);
+        CHECK(close(twice.uncertainty(), 2.0 * sum.uncertainty()));
+        CHECK(close(twice.components().entries()[sources - 1].component, 1.0));
+
+    }
+
+
+    void cancellation() {
+
+        const correlated_umeasurement x(umeasurement(2.0, 0.1, m), 0);
+        const correlated_umeasurement y(umeasurement(3.0, 0.2, m), 1);
+
+        const correlated_umeasurement zero = x - x;
+        CHECK(zero.value() == 0.0);
+        CHECK(zero.uncertainty() == 0.0);
+        CHECK(zero.components().size() == 0);
+
+        // the components of x cancel, only the ones of y are left
+        const correlated_umeasurement difference = (x + y) - x;
+        CHECK(difference.components().size() == 1);
+        CHECK(difference.uncertainty() == 0.2);
+
+        // the power 0 is a constant, also at x = 0
+        const correlated_umeasurement origin(umeasurement(0.0, 0.1, m), 2);
+        CHECK(pow(origin, 0).value() == 1.0);
+        CHECK(pow(origin, 0).components().size() == 0);
+        CHECK(pow(origin, 0).uncertainty() == 0.0);
+
+    }
+
+
+    void correlation_coefficient() {
+
+        const correlated_umeasurement x(umeasurement(2.0, 0.3, m), 0);
+        const correlated_umeasurement y(umeasurement(3.0, 0.4, m), 1);
+
+        CHECK(close(correlation(x, x), 1.0));
+        CHECK(close(correlation(x, -x), -1.0));
+        CHECK(correlation(x, y) == 0.0);
+
+        // corr(x + y, x - y) = (σx² - σy²) / (σx² + σy²)
+        CHECK(close(covariance(x + y, x - y), 0.09 - 0.16));
+        CHECK(close(correlation(x + y, x - y), (0.09 - 0.16) / (0.09 + 0.16)));
+
+        // x and x² share their only source
+        CHECK(close(correlation(x, pow(x, 2)), 1.0));
+
+    }
+
+
+} // namespace
+
+
+int main() {
+
+    spill();
+    cancellation();
+    correlation_coefficient();
+
+    return test::failures;
+
+}
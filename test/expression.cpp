@@ -0,0 +1,122 @@
+/**
+ * @file    expression.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the tests of the expression templates of the measurement_arrays: the conversion of the operands,
+ *          the broadcast of measurements and scalars, the evaluation into an operand and the check of the divisors
+ * @date    2023-02-06
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include "measurements.hpp"
+#include "check.hpp"
+
+
+using namespace measurements;
+
+
+namespace {
+
+
+    void conversion() {
+
+        const measurement_array kilometers({ 1.0, 2.0, 3.0 }, km);
+        const measurement_array meters({ 500.0, 250.0, 0.0 }, m);
+
+        // the factor converting the right operand is computed once, when the node is built
+        const auto sum = lazy(kilometers) + lazy(meters);
+        CHECK(sum.factor == 1e-3);
+        CHECK(sum.units == km);
+
+        const measurement_array result = evaluate(sum);
+        CHECK(result.units() == km);
+        CHECK(result.value(0) == 1.5);
+        CHECK(result.value(1) == 2.25);
+        CHECK(result.value(2) == 3.0);
+
+        const measurement_array difference = evaluate(lazy(meters) - lazy(kilometers));
+        CHECK(difference.units() == m);
+        CHECK(difference.value(0) == -500.0);
+
+        CHECK_THROWS(std::invalid_argument, lazy(kilometers) + lazy(measurement_array({ 1.0, 2.0, 3.0 }, s)));
+        CHECK_THROWS(std::invalid_argument, lazy(kilometers) * lazy(measurement_array({ 1.0, 2.0 }, s)));
+
+    }
+
+
+    void broadcast() {
+
+        const measurement_array lengths({ 1.0, 2.0, 4.0 }, m);
+
+        const measurement_array speeds = evaluate(lazy(lengths) / measurement(2.0, s));
+        CHECK(speeds.units() == m / s);
+        CHECK(speeds.value(2) == 2.0);
+
+        const measurement_array shifted = evaluate(measurement(1.0, km) + lazy(lengths));
+        CHECK(shifted.units() == km);
+        CHECK(shifted.value(0) == 1.001);
+
+        const measurement_array scaled = evaluate(-(3.0 * lazy(lengths)) / 2.0);
+        CHECK(scaled.units() == m);
+        CHECK(scaled.value(1) == -3.0);
+
+        CHECK_THROWS(std::invalid_argument, evaluate(lazy(lengths) + 1.0));
+
+    }
+
+
+    void in_place() {
+
+        // every element is read before it is overwritten, so the result can be an operand
+        measurement_array x({ 1.0, 2.0, 3.0 }, m);
+        const measurement_array y({ 10.0, 20.0, 30.0 }, m);
+        const scalar* storage = x.values().data();
+
+        evaluate(lazy(x) * lazy(x) + lazy(y) * lazy(x), x);
+        CHECK(x.values().data() == storage);
+        CHECK(x.units() == m.pow(2));
+        CHECK(x.value(0) == 11.0);
+        CHECK(x.value(1) == 44.0);
+        CHECK(x.value(2) == 99.0);
+
+        evaluate_checked(lazy(x) / lazy(y), x);
+        CHECK(x.units() == m);
+        CHECK(x.value(2) == 3.3);
+
+    }
+
+
+    void divisors() {
+
+        const measurement_array x({ 1.0, 2.0, 3.0 }, m);
+        const measurement_array y({ 1.0, 0.0, 2.0 }, s);
+
+        // evaluate does not check the divisors, as the division of measurement_arrays
+        const measurement_array unchecked = evaluate(lazy(x) / lazy(y));
+        CHECK(std::isinf(unchecked.value(1)));
+
+        CHECK_THROWS(std::runtime_error, evaluate_checked(lazy(x) / lazy(y)));
+        CHECK_THROWS(std::runtime_error, evaluate_checked(-(lazy(x) * (lazy(x) / (lazy(y) - lazy(y))))));
+        CHECK_THROWS(std::runtime_error, evaluate_checked(lazy(x) / measurement(0.0, s)));
+
+        // the divisors are checked, not the dividends
+        const measurement_array checked = evaluate_checked((lazy(y) - lazy(y)) / lazy(x));
+        CHECK(checked.value(1) == 0.0);
+
+    }
+
+
+} // namespace
+
+
+int main() {
+
+    conversion();
+    broadcast();
+    in_place();
+    divisors();
+
+    return test::failures;
+
+}
@@ -0,0 +1,81 @@
+/**
+ * @file    fixed_measurement.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the tests of the exact sums of the fixed_measurement and of their overflows
+ * @date    2023-02-06
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include "measurements.hpp"
+#include "check.hpp"
+
+
+using namespace measurements;
+
+
+namespace {
+
+
+    constexpr int64_t max_count{std::numeric_limits<int64_t>::max()};
+
+    constexpr int64_t min_count{std::numeric_limits<int64_t>::min()};
+
+
+    void operators() {
+
+        const fixed_measurement top(max_count, ns);
+        const fixed_measurement one(1, ns);
+
+        CHECK((fixed_measurement(measurement(1.5, s), ns) + one).count() == 1'500'000'001);
+        CHECK(fixed_measurement(measurement(2.5, ns), ns).count() == 3);
+        CHECK(fixed_measurement(measurement(-2.5, ns), ns).count() == -3);
+
+        CHECK_THROWS(std::runtime_error, top + one);
+        CHECK_THROWS(std::runtime_error, fixed_measurement(min_count, ns) - one);
+        CHECK_THROWS(std::runtime_error, top * 2);
+        CHECK_THROWS(std::runtime_error, -fixed_measurement(min_count, ns));
+        CHECK_THROWS(std::invalid_argument, fixed_measurement(measurement(1e300, s), ns));
+        CHECK_THROWS(std::invalid_argument, one + fixed_measurement(1, us));
+
+        fixed_measurement saturated = top;
+        CHECK(saturated.saturating_add(one).count() == max_count);
+        CHECK(saturated.saturating_subtract(fixed_measurement(-1, ns)).count() == max_count);
+        CHECK(fixed_measurement(min_count, ns).saturating_subtract(one).count() == min_count);
+
+    }
+
+
+    void accumulate() {
+
+        // the sum is exact, so it does not depend on the order of the terms
+        const measurement_array forward(std::vector<scalar>{ 1e9, 0.4, -1e9, 0.4, 2.6 }, s);
+        const measurement_array backward(std::vector<scalar>{ 2.6, 0.4, -1e9, 0.4, 1e9 }, s);
+        CHECK(fixed_measurement::accumulate(forward, ms).count() == 3400);
+        CHECK(fixed_measurement::accumulate(forward, ms) == fixed_measurement::accumulate(backward, ms));
+
+        CHECK_THROWS(std::invalid_argument, fixed_measurement::accumulate(forward, m));
+
+        // the values that do not fit in the count are rejected instead of being saturated or dropped
+        const scalar nan = std::numeric_limits<scalar>::quiet_NaN();
+        const scalar inf = std::numeric_limits<scalar>::infinity();
+        CHECK_THROWS(std::runtime_error, fixed_measurement::accumulate(measurement_array(std::vector<scalar>{ 1.0, nan }, s), ns));
+        CHECK_THROWS(std::runtime_error, fixed_measurement::accumulate(measurement_array(std::vector<scalar>{ -inf, 1.0 }, s), ns));
+        CHECK_THROWS(std::runtime_error, fixed_measurement::accumulate(measurement_array(std::vector<scalar>{ 1e10, -1e10 }, s), ns));
+        CHECK_THROWS(std::runtime_error, fixed_measurement::accumulate(measurement_array(std::vector<scalar>{ 0x1.0p62, 0x1.0p62 }, ns), ns));
+
+    }
+
+
+} // namespace
+
+
+int main() {
+
+    operators();
+    accumulate();
+
+    return test::failures;
+
+}
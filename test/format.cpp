@@ -0,0 +1,96 @@
+/**
+ * @file    format.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the tests of the format specifications and, where <format> is available,
+ *          of the std::formatter specializations
+ * @date    2023-02-06
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include "measurements.hpp"
+#include "check.hpp"
+
+#include <cstring>
+
+
+using namespace measurements;
+
+
+namespace {
+
+
+    /// @brief Write a measurement or an umeasurement with a format specification
+    template <typename T>
+    std::string write(const T& meas, const char* text) {
+
+        format_spec spec;
+        const char* last = text + std::strlen(text);
+        CHECK(parse_format_spec(text, last, spec) == last);
+
+        char buffer[umeasurement::max_chars];
+
+        return std::string(buffer, to_chars(buffer, buffer + umeasurement::max_chars, meas, spec).ptr);
+
+    }
+
+
+    void format_specs() {
+
+        const measurement meas(1234.5678, m);
+        const umeasurement umeas(1.23456, 0.0052, m);
+
+        // the default specification is the shortest round-tripping value, and the text of operator<< for an umeasurement
+        char buffer[umeasurement::max_chars];
+        CHECK(write(meas, "") == std::string(buffer, to_chars(buffer, buffer + umeasurement::max_chars, meas).ptr));
+
+        std::ostringstream os;
+        os << umeas;
+        CHECK(os.str() == write(umeas, ""));
+
+        CHECK(write(meas, ".3e") == "1.23e+03 m");
+        CHECK(write(meas, ".3") == "1.23e+03 m");
+        CHECK(write(umeas, ".2") == "(1.2346 ± 0.0052) m");
+        CHECK(write(umeas, ".2p") == "1.2346(52) m");
+        CHECK(write(umeasurement(123456., 52., km), ".2p") == "1.23456(52)e5 km");
+
+        format_spec spec;
+        const char* invalid = "x}";
+        CHECK(parse_format_spec(invalid, invalid + 2, spec) == invalid);
+
+    }
+
+
+    void formatters() {
+
+        #ifdef __cpp_lib_format
+
+            const umeasurement umeas(1.23456, 0.0052, m);
+
+            CHECK(std::format("{}", km) == "km");
+            CHECK(std::format("{:.3e}", measurement(1234.5678, m)) == "1.23e+03 m");
+            CHECK(std::format("{}", umeas) == write(umeas, ""));
+            CHECK(std::format("{:.2p}", umeas) == "1.2346(52) m");
+            CHECK_THROWS(std::format_error, std::vformat("{:x}", std::make_format_args(umeas)));
+
+        #else
+
+            std::cout << "<format> is not available, the std::formatter specializations are not tested\n";
+
+        #endif
+
+    }
+
+
+} // namespace
+
+
+int main() {
+
+    format_specs();
+    formatters();
+
+    return test::failures;
+
+}
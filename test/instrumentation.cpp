@@ -0,0 +1,163 @@
+/**
+ * @file    instrumentation.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the tests of the counters and of the conversion heatmap of the instrumentation,
+ *          built with MEASUREMENTS_INSTRUMENTATION
+ * @date    2023-02-06
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include "measurements.hpp"
+#include "check.hpp"
+
+
+using namespace measurements;
+
+
+namespace {
+
+
+    void throws() {
+
+        instrumentation::reset();
+
+        CHECK_THROWS(std::invalid_argument, measurement(1.0, m) + measurement(1.0, s));
+        CHECK_THROWS(std::runtime_error, measurement(1.0, m) / measurement(0.0, s));
+        CHECK_THROWS(std::invalid_argument, umeasurement(1.0, 0.1, m) - umeasurement(1.0, 0.1, s));
+        CHECK_THROWS(std::invalid_argument, measurement_array(m) += measurement_array(std::vector<scalar>{ 1.0 }, m));
+
+        const instrumentation::snapshot snap = instrumentation::take_snapshot();
+        CHECK(snap[instrumentation::counter::throws] == 4);
+        CHECK(snap[instrumentation::counter::unit_mismatch] == 2);
+        CHECK(snap[instrumentation::counter::division_by_zero] == 1);
+
+    }
+
+
+    void counted_sites() {
+
+        instrumentation::reset();
+
+        // mismatches of the batch kernels and of the quantities
+        std::vector<scalar> buffer{ 1.0, 2.0 }, out(2);
+        CHECK_THROWS(std::invalid_argument, units::convert(buffer, m, s, out));
+        CHECK_THROWS(std::invalid_argument, units::convert(buffer, buffer, m, s, out, out));
+        CHECK_THROWS(std::invalid_argument, measurement_array(std::vector<scalar>{ 1.0 }, m).convert_to(s));
+
+        // divisions by a zero divisor of every type
+        uncertainty_tape tape;
+        const tracked_umeasurement y = tape.variable(umeasurement(1.0, 0.1, m));
+        const tracked_umeasurement x = tape.variable(umeasurement(0.0, 0.1, s));
+        CHECK_THROWS(std::runtime_error, 1.0 / umeasurement(0.0, 0.1, m));
+        CHECK_THROWS(std::runtime_error, measurement(1.0, m) / umeasurement(0.0, 0.1, m));
+        CHECK_THROWS(std::runtime_error, y / x);
+        CHECK_THROWS(std::runtime_error, measurement(1.0, m) / x);
+        CHECK_THROWS(std::runtime_error, 1.0 / x);
+        CHECK_THROWS(std::runtime_error, correlated_umeasurement::source(umeasurement(1.0, 0.1, m)) / correlated_umeasurement(measurement(0.0, s)));
+        CHECK_THROWS(std::runtime_error, compact_measurement(1.0, m) / compact_measurement(0.0, s));
+
+        const instrumentation::snapshot snap = instrumentation::take_snapshot();
+        CHECK(snap[instrumentation::counter::throws] == 10);
+        CHECK(snap[instrumentation::counter::unit_mismatch] == 3);
+        CHECK(snap[instrumentation::counter::division_by_zero] == 7);
+
+    }
+
+
+    void nothrow_results() {
+
+        instrumentation::reset();
+
+        // an error reported by a result is counted once, also when it is thrown later by the error_flag or by value()
+        error_flag flag;
+        flag(nothrow::add(measurement(1.0, m), measurement(1.0, s)));
+        flag(nothrow::divide(measurement(1.0, m), 0.0));
+        CHECK(flag.error() == measurement_errc::unit_mismatch);
+        CHECK_THROWS(std::invalid_argument, flag.check());
+
+        const result<measurement> quotient = nothrow::divide(measurement(1.0, m), measurement(0.0, s));
+        CHECK(!quotient);
+        CHECK_THROWS(std::runtime_error, quotient.value());
+
+        const instrumentation::snapshot snap = instrumentation::take_snapshot();
+        CHECK(snap[instrumentation::counter::unit_mismatch] == 1);
+        CHECK(snap[instrumentation::counter::division_by_zero] == 2);
+        CHECK(snap[instrumentation::counter::throws] == 2);
+
+    }
+
+
+    void conversions() {
+
+        instrumentation::reset();
+
+        const measurement_array lengths(std::vector<scalar>{ 1.0, 2.0, 3.0 }, km);
+        const umeasurement_array times(std::vector<scalar>{ 1.0, 2.0 }, std::vector<scalar>{ 0.1, 0.1 }, s);
+        CHECK(lengths.convert_to(m).values()[2] == 3000.0);
+        CHECK(times.convert_to(ms).uncertainties()[1] == 100.0);
+        CHECK(measurement(1.0, km).value_as(m) == 1000.0);
+        CHECK(lengths.convert_to(km).size() == 3);
+
+        std::vector<scalar> buffer{ 1.0, 2.0 };
+        units::convert(buffer, m, km);
+
+        // the conversions of another thread are merged in the snapshot when the thread exits
+        std::thread([] { (void)measurement(1.0, km).value_as(m); }).join();
+
+        const instrumentation::snapshot snap = instrumentation::take_snapshot();
+        CHECK(snap[instrumentation::counter::conversion] == 9);
+        CHECK(snap.conversions.size() == 3);
+        if (snap.conversions.size() == 3) {
+
+            CHECK(snap.conversions[0].from == km && snap.conversions[0].to == m && snap.conversions[0].count == 5);
+            CHECK(snap.conversions[1].count == 2 && snap.conversions[2].count == 2);
+
+        }
+
+    }
+
+
+    void concurrent_snapshots() {
+
+        instrumentation::reset();
+
+        // the hooks do not lock, so the snapshots can run while other threads convert
+        constexpr int threads{4}, conversions{10000};
+        std::vector<std::thread> workers;
+        for (int t{0}; t < threads; ++t)
+            workers.emplace_back([] {
+
+                for (int i{0}; i < conversions; ++i)
+                    (void)measurement(i, km).value_as(m);
+
+            });
+
+        for (int i{0}; i < 100; ++i)
+            CHECK(instrumentation::take_snapshot()[instrumentation::counter::conversion] <= threads * conversions);
+
+        for (std::thread& worker : workers)
+            worker.join();
+
+        const instrumentation::snapshot snap = instrumentation::take_snapshot();
+        CHECK(snap[instrumentation::counter::conversion] == threads * conversions);
+        CHECK(snap.conversions.size() == 1 && snap.conversions[0].count == threads * conversions);
+
+    }
+
+
+} // namespace
+
+
+int main() {
+
+    throws();
+    counted_sites();
+    nothrow_results();
+    conversions();
+    concurrent_snapshots();
+
+    return test::failures;
+
+}
@@ -0,0 +1,97 @@
+/**
+ * @file    measurement_array.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the tests of the measurement_arrays and of the umeasurement_arrays
+ *          instantiated on the value types other than scalar
+ * @date    2023-02-06
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include "measurements.hpp"
+#include "check.hpp"
+
+
+using namespace measurements;
+
+
+// every member is compiled for every value type, not only the ones called by the tests
+template class measurements::basic_measurement_view<float>;
+template class measurements::basic_measurement_array<float>;
+template class measurements::basic_umeasurement_view<float>;
+template class measurements::basic_umeasurement_array<float>;
+template class measurements::basic_measurement_array<long double>;
+template class measurements::basic_umeasurement_array<long double>;
+
+
+namespace {
+
+
+    void layout() {
+
+        static_assert(std::is_same_v<float_measurement_array::container::value_type, float>);
+        static_assert(std::is_same_v<decltype(float_measurement_array().values()), std::span<float>>);
+        static_assert(std::is_same_v<decltype(float_umeasurement_array().uncertainties()), std::span<float>>);
+        static_assert(std::is_same_v<decltype(float_measurement_array()[0]), float_measurement>);
+        static_assert(std::is_same_v<decltype(float_umeasurement_array()[0]), float_umeasurement>);
+        static_assert(std::is_same_v<measurement_array, basic_measurement_array<scalar>>);
+
+    }
+
+
+    void float_array() {
+
+        float_measurement_array lengths({ 1.5f, 2.5f, 3.0f, 4.0f, 5.0f }, km);
+        CHECK(lengths.sum() == float_measurement(16.0f, km));
+        CHECK(lengths.mean() == float_measurement(3.2f, km));
+        CHECK(lengths.max().value() == 5.0f);
+
+        const float_measurement_array meters = lengths.convert_to(m);
+        CHECK(meters.units() == m);
+        CHECK(meters.value(0) == 1500.0f);
+
+        lengths += meters;
+        CHECK(std::fabs(lengths.value(1) - 5.0f) < 1e-6f);
+        CHECK(std::fabs((lengths * 2.0f).value(4) - 20.0f) < 1e-5f);
+        CHECK((lengths / float_measurement(2.0f, s)).units() == km / s);
+        CHECK_THROWS(std::invalid_argument, lengths += float_measurement_array({ 1.0f }, s));
+
+    }
+
+
+    void float_uarray() {
+
+        const float_umeasurement_array x({ 3.0f, 6.0f }, { 0.3f, 0.8f }, m);
+        const float_umeasurement_array y({ 4.0f, 8.0f }, { 0.4f, 0.6f }, m);
+
+        const float_umeasurement_array product = x * y;
+        CHECK(product.units() == m.pow(2));
+        CHECK(product[0].value() == 12.0f);
+        CHECK(std::fabs(product[0].uncertainty() - std::sqrt(2.0f) * 1.2f) < 1e-5f);
+
+        const float_umeasurement_array sum = x + y.convert_to(cm);
+        CHECK(std::fabs(sum[1].value() - 14.0f) < 1e-5f);
+        CHECK(std::fabs(sum[1].uncertainty() - 1.0f) < 1e-6f);
+
+        const float_umeasurement_array cube = pow(x, 3);
+        CHECK(cube[0].value() == 27.0f);
+        CHECK(std::fabs(cube[0].uncertainty() - 8.1f) < 1e-5f);
+
+        CHECK_THROWS(std::runtime_error, x / 0.0f);
+
+    }
+
+
+} // namespace
+
+
+int main() {
+
+    layout();
+    float_array();
+    float_uarray();
+
+    return test::failures;
+
+}
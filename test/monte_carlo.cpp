@@ -0,0 +1,87 @@
+/**
+ * @file    monte_carlo.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the tests of the Monte Carlo propagation: the independence of the result
+ *          from the number of threads and the rejection of the non-finite outputs
+ * @date    2023-02-06
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include "measurements.hpp"
+#include "check.hpp"
+
+#include <cstring>
+
+
+using namespace measurements;
+
+
+namespace {
+
+
+    /// @brief Check that two scalars have the same bits
+    bool identical(const scalar& lhs, const scalar& rhs) { return std::memcmp(&lhs, &rhs, sizeof(scalar)) == 0; }
+
+
+    void threads() {
+
+        const umeasurement x(2.0, 0.1, m);
+        const umeasurement t(4.0, 0.2, s);
+        const auto function = [](const measurement& length, const measurement& time) { return length / time + length * length / (time * measurement(1.0, m)); };
+
+        // the last batch is partial, and there are more batches than threads
+        monte_carlo_options options;
+        options.samples = 100'003;
+        options.batch = 1'000;
+        options.seed = 42;
+        options.probabilities = { 0.0, 0.025, 0.5, 0.975, 1.0 };
+
+        options.threads = 1;
+        const monte_carlo_result serial = monte_carlo(function, options, x, t);
+        options.threads = 4;
+        const monte_carlo_result parallel = monte_carlo(function, options, x, t);
+
+        CHECK(identical(serial.estimate.value(), parallel.estimate.value()));
+        CHECK(identical(serial.estimate.uncertainty(), parallel.estimate.uncertainty()));
+        CHECK(serial.estimate.units() == m / s);
+        CHECK(parallel.estimate.units() == m / s);
+        CHECK(serial.quantiles.size() == options.probabilities.size());
+        CHECK(parallel.quantiles.size() == options.probabilities.size());
+        for (std::size_t i{0}; i < std::min(serial.quantiles.size(), parallel.quantiles.size()); ++i)
+            CHECK(identical(serial.quantiles[i].value(), parallel.quantiles[i].value()));
+
+        // x / t + x^2 / t at first order
+        CHECK(std::fabs(serial.estimate.value() - 1.5) < 0.01);
+
+    }
+
+
+    void non_finite() {
+
+        // about half of the samples of x are negative, where the square root is NaN and the exponential overflows
+        const umeasurement x(0.0, 1.0, m.pow(2));
+        monte_carlo_options options;
+        options.samples = 10'000;
+        options.batch = 512;
+        options.threads = 4;
+        options.probabilities = { 0.5 };
+
+        CHECK_THROWS(std::runtime_error, monte_carlo([](const measurement& area) { return measurement(std::sqrt(area.value()), m); }, options, x));
+        CHECK_THROWS(std::runtime_error, monte_carlo([](const measurement& area) { return measurement(std::exp(-1e3 * area.value()), m); }, options, x));
+
+    }
+
+
+} // namespace
+
+
+int main() {
+
+    threads();
+    non_finite();
+
+    return test::failures;
+
+}
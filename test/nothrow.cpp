@@ -0,0 +1,74 @@
+/**
+ * @file    nothrow.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the tests of the operations that do not throw: their results agree with the operators,
+ *          and value() throws the same exceptions as the operators
+ * @date    2023-02-06
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include "measurements.hpp"
+#include "check.hpp"
+
+
+using namespace measurements;
+
+
+namespace {
+
+
+    bool close(const scalar& lhs, const scalar& rhs) { return std::fabs(lhs - rhs) <= 1e-15 * std::max(1.0, std::fabs(rhs)); }
+
+
+    void agreement() {
+
+        const umeasurement u(3.0, 0.3, m);
+        const umeasurement v(4.0, 0.2, s);
+
+        const umeasurement quotient = nothrow::divide(u, v).value();
+        CHECK(quotient.value() == (u / v).value());
+        CHECK(close(quotient.uncertainty(), (u / v).uncertainty()));
+        CHECK(quotient.units() == (u / v).units());
+
+        const umeasurement scaled = nothrow::divide(u, 4.0).value();
+        CHECK(scaled.value() == (u / 4.0).value());
+        CHECK(scaled.uncertainty() == (u / 4.0).uncertainty());
+
+        const measurement sum = nothrow::add(measurement(1.0, km), measurement(1.0, m)).value();
+        CHECK(sum == measurement(1.0, km) + measurement(1.0, m));
+
+    }
+
+
+    void exceptions() {
+
+        // value() throws the exception the operator would throw for the same error
+        const umeasurement u(3.0, 0.3, m);
+        const umeasurement zero(0.0, 0.2, s);
+
+        CHECK_THROWS(std::runtime_error, u / zero);
+        CHECK_THROWS(std::runtime_error, nothrow::divide(u, zero).value());
+        CHECK_THROWS(std::runtime_error, u / 0.0);
+        CHECK_THROWS(std::runtime_error, nothrow::divide(u, 0.0).value());
+        CHECK_THROWS(std::runtime_error, measurement(1.0, m) / measurement(0.0, s));
+        CHECK_THROWS(std::runtime_error, nothrow::divide(measurement(1.0, m), measurement(0.0, s)).value());
+
+        CHECK_THROWS(std::invalid_argument, u + zero);
+        CHECK_THROWS(std::invalid_argument, nothrow::add(u, zero).value());
+
+    }
+
+
+} // namespace
+
+
+int main() {
+
+    agreement();
+    exceptions();
+
+    return test::failures;
+
+}
@@ -0,0 +1,107 @@
+/**
+ * @file    statistics.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the tests of the statistics of umeasurements: the weighted mean, the chi square
+ *          and the Birge ratio on a small dataset, with mixed units and with any number of threads
+ * @date    2023-02-06
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include "measurements.hpp"
+#include "check.hpp"
+
+#include <cstring>
+
+
+using namespace measurements;
+
+
+namespace {
+
+
+    bool close(const scalar& lhs, const scalar& rhs) { return std::fabs(lhs - rhs) <= 1e-14 * std::max(1.0, std::fabs(rhs)); }
+
+    /// @brief Check that two scalars have the same bits
+    bool identical(const scalar& lhs, const scalar& rhs) { return std::memcmp(&lhs, &rhs, sizeof(scalar)) == 0; }
+
+
+    void closed_form() {
+
+        // weights 1, 1, 1/4: the mean is 4 / (9/4) = 16/9 with uncertainty 1 / sqrt(9/4) = 2/3,
+        // and the chi square is (7/9)² + (2/9)² + (10/9)² = 153/81
+        const umeasurement_array data({ 1.0, 2.0, 4.0 }, { 1.0, 1.0, 2.0 }, m);
+
+        const umeasurement mean = weighted_mean(data);
+        CHECK(mean.units() == m);
+        CHECK(close(mean.value(), 16.0 / 9.0));
+        CHECK(close(mean.uncertainty(), 2.0 / 3.0));
+
+        CHECK(close(chi_square(data), 153.0 / 81.0));
+        CHECK(close(chi_square(data, measurement(2.0, m)), 1.0 + 0.0 + 1.0));
+        CHECK(close(chi_square(data, measurement(200.0, cm)), 2.0));
+        CHECK(close(birge_ratio(data), std::sqrt(153.0 / 81.0 / 2.0)));
+
+        CHECK_THROWS(std::invalid_argument, weighted_mean(umeasurement_array({ 1.0, 2.0 }, { 1.0, 0.0 }, m)));
+        CHECK_THROWS(std::invalid_argument, weighted_mean(umeasurement_array(m)));
+        CHECK_THROWS(std::invalid_argument, chi_square(data, measurement(2.0, s)));
+
+    }
+
+
+    void mixed_units() {
+
+        // the same dataset, every umeasurement in different units, converted to the units of the first one
+        const std::vector<umeasurement> data{ umeasurement(1.0, 1.0, m), umeasurement(200.0, 100.0, cm), umeasurement(4e-3, 2e-3, km) };
+
+        const umeasurement mean = weighted_mean(std::span<const umeasurement>(data));
+        CHECK(mean.units() == m);
+        CHECK(close(mean.value(), 16.0 / 9.0));
+        CHECK(close(mean.uncertainty(), 2.0 / 3.0));
+        CHECK(close(chi_square(std::span<const umeasurement>(data)), 153.0 / 81.0));
+        CHECK(close(birge_ratio(std::span<const umeasurement>(data)), std::sqrt(153.0 / 81.0 / 2.0)));
+
+        const std::vector<umeasurement> mismatch{ umeasurement(1.0, 1.0, m), umeasurement(1.0, 1.0, s) };
+        CHECK_THROWS(std::invalid_argument, weighted_mean(std::span<const umeasurement>(mismatch)));
+
+    }
+
+
+    void threads() {
+
+        // several chunks, the last one partial
+        const std::size_t size{5 * statistics::chunk_size + 123};
+        umeasurement_array data(m);
+        data.reserve(size);
+        for (std::size_t i{0}; i < size; ++i)
+            data.push_back(umeasurement(1.0 + std::sin(static_cast<scalar>(i)), 0.1 + 0.01 * static_cast<scalar>(i % 7), m));
+
+        const umeasurement mean = weighted_mean(data, 1);
+        const scalar chi2 = chi_square(data, 1);
+        const scalar birge = birge_ratio(data, 1);
+        for (const unsigned threads : { 2u, 3u, 8u, 0u }) {
+
+            const umeasurement other = weighted_mean(data, threads);
+            CHECK(identical(other.value(), mean.value()));
+            CHECK(identical(other.uncertainty(), mean.uncertainty()));
+            CHECK(identical(chi_square(data, threads), chi2));
+            CHECK(identical(birge_ratio(data, threads), birge));
+
+        }
+
+    }
+
+
+} // namespace
+
+
+int main() {
+
+    closed_form();
+    mixed_units();
+    threads();
+
+    return test::failures;
+
+}
@@ -0,0 +1,96 @@
+/**
+ * @file    tracked_umeasurement.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the tests of the uncertainty_tape: the propagation through repeated inputs,
+ *          the covariance of two outputs and the reuse of the tape after clear()
+ * @date    2023-02-06
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include "measurements.hpp"
+#include "check.hpp"
+
+
+using namespace measurements;
+
+
+namespace {
+
+
+    bool close(const scalar& lhs, const scalar& rhs) { return std::fabs(lhs - rhs) <= 1e-12 * std::max(1.0, std::fabs(rhs)); }
+
+
+    void repeated_inputs() {
+
+        uncertainty_tape tape;
+        const tracked_umeasurement x = tape.variable(umeasurement(3.0, 0.1, m));
+
+        // x * x is not the product of two independent inputs: its uncertainty is |2x| σ, not sqrt(2) |x| σ
+        CHECK(close(tape.uncertainty(x * x), 2.0 * 3.0 * 0.1));
+        CHECK(close(tape.uncertainty(pow(x, 2)), 2.0 * 3.0 * 0.1));
+
+        const umeasurement zero = tape.evaluate(x - x);
+        CHECK(zero.value() == 0.0);
+        CHECK(zero.uncertainty() == 0.0);
+
+        // the power 0 is a constant, also at x = 0
+        const tracked_umeasurement origin = tape.variable(umeasurement(0.0, 0.1, m));
+        CHECK(tape.uncertainty(pow(origin, 0)) == 0.0);
+        CHECK(tape.gradient(pow(origin, 0)) == std::vector<scalar>({ 0.0, 0.0 }));
+
+    }
+
+
+    void covariance() {
+
+        uncertainty_tape tape;
+        const tracked_umeasurement x = tape.variable(umeasurement(3.0, 0.3, m));
+        const tracked_umeasurement y = tape.variable(umeasurement(4.0, 0.4, m));
+
+        // cov(x + y, x - y) = σx² - σy²
+        const tracked_umeasurement sum = x + y;
+        const tracked_umeasurement difference = x - y;
+        CHECK(close(tape.covariance(sum, difference), 0.09 - 0.16));
+        CHECK(close(tape.covariance(sum, sum), tape.uncertainty(sum) * tape.uncertainty(sum)));
+
+        const std::vector<scalar> gradient = tape.gradient(x * y);
+        CHECK(gradient.size() == 2);
+        CHECK(gradient == std::vector<scalar>({ 4.0, 3.0 }));
+
+    }
+
+
+    void clear() {
+
+        uncertainty_tape tape;
+        const tracked_umeasurement x = tape.variable(umeasurement(2.0, 0.2, s));
+        const scalar first = tape.uncertainty(x * x * x);
+        CHECK(tape.inputs() == 1);
+
+        // the storage is reused, and the same computation gives the same result
+        tape.clear();
+        CHECK(tape.size() == 0);
+        CHECK(tape.inputs() == 0);
+
+        const tracked_umeasurement y = tape.variable(umeasurement(2.0, 0.2, s));
+        CHECK(tape.uncertainty(y * y * y) == first);
+        CHECK(close(first, 3.0 * 4.0 * 0.2));
+        CHECK(tape.inputs() == 1);
+
+    }
+
+
+} // namespace
+
+
+int main() {
+
+    repeated_inputs();
+    covariance();
+    clear();
+
+    return test::failures;
+
+}
@@ -0,0 +1,180 @@
+/**
+ * @file    units_io.cpp
+ * @author  Lorenzo Liuzzo (lorenzoliuzzo@outlook.com)
+ * @brief   This file contains the round-trip tests of the units through to_chars and parse_unit,
+ *          the stream operators and read_table
+ * @date    2023-02-06
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+
+#include "measurements.hpp"
+#include "check.hpp"
+
+#include <filesystem>
+
+
+using namespace measurements;
+
+
+namespace {
+
+
+    /// @brief Check that two units have the same unit_base and the same multiplier
+    bool same_scale(const unit& lhs, const unit& rhs) {
+
+        return lhs.base() == rhs.base() &&
+               lhs.prefix().exact() == rhs.prefix().exact() &&
+               lhs.prefix().multiplier() == rhs.prefix().multiplier();
+
+    }
+
+
+    /// @brief Prefixed derived units, whose prefix can not always be written in front of their first factor
+    std::vector<unit> prefixed_units() {
+
+        using namespace units::SI::prefixes;
+
+        return {
+            m, km, kg, ms, us,
+            unit(kilo, Hz.base()), unit(mega, Hz.base()), unit(kilo, Pa.base()), unit(milli, J.base()), unit(mega, J.base()), unit(kilo, N.base()),
+            km.square(), km.cube(), ms.inv(), km / s, km / ms, mm * kg / s.square(), (km * m).sqrt(),
+            unit(kilo, unitless.base()), unit(units::unit_prefix('\0', 2, 3, 7), m.base()),
+            unit(units::unit_prefix(std::numbers::pi / 180., 'd'), unitless.base()),
+            unit(units::unit_prefix(0.3048, 'f'), m.base())
+        };
+
+    }
+
+
+    void to_chars_parse_unit() {
+
+        for (const unit& units : prefixed_units()) {
+
+            const std::string text = units.to_string();
+            const units::parse_unit_result parsed = parse_unit(text);
+
+            CHECK(parsed.ec == std::errc());
+            CHECK(parsed.ptr == text.data() + text.size());
+            CHECK(same_scale(parsed.units, units));
+            if (!same_scale(parsed.units, units))
+                std::cerr << "  " << text << " reads back as " << parsed.units.prefix().multiplier() << ' ' << parsed.units.base() << '\n';
+
+        }
+
+        CHECK(unit(units::SI::prefixes::kilo, Hz.base()).to_string() == "1e3*s^-1");
+        CHECK(unit(units::SI::prefixes::kilo, Pa.base()).to_string() == "1e3*m^-1*s^-2*kg");
+        CHECK(unit(units::SI::prefixes::mega, J.base()).to_string() == "1e6*m^2*s^-2*kg");
+        CHECK(unit(units::SI::prefixes::kilo, N.base()).to_string() == "km*s^-2*kg");
+        CHECK(km.square().to_string() == "km^2");
+        CHECK(ms.inv().to_string() == "ms^-1");
+
+    }
+
+
+    void legacy_format() {
+
+        // the concatenated strings written before the '*' separator are not read as the units that wrote them
+        CHECK(parse_unit("ms^-1").units == ms.inv());
+        CHECK(parse_unit("mkg").units.prefix().multiplier() == 1e-3);
+        CHECK(parse_unit("m*s^-1").units == m / s);
+        CHECK(parse_unit("m/s").units == m / s);
+        CHECK_THROWS(std::invalid_argument, unit("m^2kg"));
+        CHECK_THROWS(std::invalid_argument, unit("mskg"));
+
+    }
+
+
+    /// @brief Get the message of the error thrown by parse_table, empty if it does not throw
+    std::string table_error(std::string_view text) {
+
+        try {
+
+            parse_table(text);
+
+        } catch (const std::runtime_error& error) {
+
+            return error.what();
+
+        }
+
+        return {};
+
+    }
+
+
+    void table_errors() {
+
+        CHECK(table_error("1.5\t0.25\tm\n").empty());
+        CHECK(table_error("1.5\t0.25\tm\nx\t0.25\tm\n") == "Cannot parse the value at line 2");
+        CHECK(table_error("1.5\tx\tm\n") == "Cannot parse the uncertainty at line 1");
+        CHECK(table_error("1.5\t0.25x\tm\n") == "Unexpected character after the uncertainty at line 1");
+
+    }
+
+
+    void streams() {
+
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / "measurements_units_io.txt";
+        const std::vector<unit> units = prefixed_units();
+
+        {
+
+            std::ofstream file(path);
+            for (std::size_t i{0}; i < units.size(); ++i)
+                file << umeasurement(1.5 + i, 0.25, units[i]) << '\n';
+
+        }
+
+        std::ifstream file(path);
+        for (std::size_t i{0}; i < units.size(); ++i) {
+
+            umeasurement umeas;
+            file >> umeas;
+            CHECK(file.good());
+            CHECK(umeas.value() == 1.5 + i);
+            CHECK(umeas.uncertainty() == 0.25);
+            CHECK(same_scale(umeas.units(), units[i]));
+
+        }
+
+        const umeasurement_table table = read_table(path.string());
+        CHECK(table.size() == units.size());
+        for (std::size_t i{0}; i < std::min(table.size(), units.size()); ++i) {
+
+            CHECK(table[i].value() == 1.5 + i);
+            CHECK(same_scale(table[i].units(), units[i]));
+
+        }
+
+        std::filesystem::remove(path);
+
+        for (const unit& meas_units : units) {
+
+            std::stringstream text;
+            text << measurement(2.5, meas_units);
+
+            measurement meas;
+            text >> meas;
+            CHECK(meas.value() == 2.5);
+            CHECK(same_scale(meas.units(), meas_units));
+
+        }
+
+    }
+
+
+} // namespace
+
+
+int main() {
+
+    to_chars_parse_unit();
+    legacy_format();
+    table_errors();
+    streams();
+
+    return test::failures;
+
+}